@@ -0,0 +1,62 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef DYNAMIC_BITSET_BENCHMARK_HPP
+#define DYNAMIC_BITSET_BENCHMARK_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace benchmark
+{
+    // prevent the compiler from optimizing away a computed value
+    template<typename T>
+    inline void do_not_optimize(const T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const T* sink;
+        sink = &value;
+#endif
+    }
+
+    // run function repetitions times and print the best duration in milliseconds
+    template<typename Function>
+    inline double measure(const std::string& name, size_t repetitions, Function&& function)
+    {
+        double best = 0;
+        for(size_t i = 0; i < repetitions; ++i)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            function();
+            const auto end = std::chrono::steady_clock::now();
+            const double duration = std::chrono::duration<double, std::milli>(end - start).count();
+            best = i == 0 ? duration : std::min(best, duration);
+        }
+        std::cout << std::left << std::setw(48) << name << std::right << std::fixed << std::setprecision(3)
+                  << std::setw(12) << best << " ms" << std::endl;
+        return best;
+    }
+
+    // parse the argument at index or return default_value
+    inline size_t argument(int argc, char* argv[], int index, size_t default_value)
+    {
+        if(index < argc)
+        {
+            return static_cast<size_t>(std::strtoull(argv[index], nullptr, 10));
+        }
+        return default_value;
+    }
+} // namespace benchmark
+
+#endif //DYNAMIC_BITSET_BENCHMARK_HPP
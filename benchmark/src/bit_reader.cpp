@@ -0,0 +1,93 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include <sul/dynamic_bitset.hpp>
+
+#include "benchmark.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// usage: dynamic_bitset_benchmark_bit_reader [fields_number] [repetitions]
+int main(int argc, char* argv[])
+{
+    const size_t fields_number = benchmark::argument(argc, argv, 1, size_t(1) << 26);
+    const size_t repetitions = benchmark::argument(argc, argv, 2, 5);
+
+    // fields of 1 to 64 bits
+    std::vector<uint8_t> widths(fields_number);
+    std::mt19937_64 engine(42);
+    std::uniform_int_distribution<unsigned int> width_distribution(1, 64);
+    sul::dynamic_bitset<uint64_t> bitset;
+    {
+        sul::dynamic_bitset<uint64_t>::bit_writer writer(bitset);
+        for(size_t i = 0; i < fields_number; ++i)
+        {
+            widths[i] = static_cast<uint8_t>(width_distribution(engine));
+            writer.write(engine(), widths[i]);
+        }
+    }
+    std::cout << fields_number << " fields, " << bitset.size() << " bits, best of " << repetitions << " repetitions"
+              << std::endl;
+
+    const double fields = static_cast<double>(fields_number);
+    const auto report = [fields](double milliseconds) {
+        std::cout << "    " << fields / (milliseconds * 1e3) << " million fields/s" << std::endl;
+    };
+
+    uint64_t expected_sum = 0;
+    report(benchmark::measure("test() per bit", repetitions, [&]() {
+        uint64_t sum = 0;
+        size_t pos = 0;
+        for(size_t i = 0; i < fields_number; ++i)
+        {
+            uint64_t value = 0;
+            for(size_t bit = 0; bit < widths[i]; ++bit)
+            {
+                value |= uint64_t(bitset.test(pos + bit)) << bit;
+            }
+            pos += widths[i];
+            sum += value;
+        }
+        benchmark::do_not_optimize(sum);
+        expected_sum = sum;
+    }));
+
+    uint64_t extract_bits_sum = 0;
+    report(benchmark::measure("extract_bits", repetitions, [&]() {
+        uint64_t sum = 0;
+        size_t pos = 0;
+        for(size_t i = 0; i < fields_number; ++i)
+        {
+            sum += bitset.extract_bits(pos, widths[i]);
+            pos += widths[i];
+        }
+        benchmark::do_not_optimize(sum);
+        extract_bits_sum = sum;
+    }));
+
+    uint64_t bit_reader_sum = 0;
+    report(benchmark::measure("bit_reader", repetitions, [&]() {
+        uint64_t sum = 0;
+        sul::dynamic_bitset<uint64_t>::bit_reader reader(bitset);
+        for(size_t i = 0; i < fields_number; ++i)
+        {
+            sum += reader.read(widths[i]);
+        }
+        benchmark::do_not_optimize(sum);
+        bit_reader_sum = sum;
+    }));
+
+    if(extract_bits_sum != expected_sum || bit_reader_sum != expected_sum)
+    {
+        std::cerr << "extract_bits or bit_reader result differs from test()" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,76 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include <sul/dynamic_bitset.hpp>
+
+#include "benchmark.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// usage: dynamic_bitset_benchmark_bit_writer [fields_number] [repetitions]
+int main(int argc, char* argv[])
+{
+    const size_t fields_number = benchmark::argument(argc, argv, 1, size_t(1) << 26);
+    const size_t repetitions = benchmark::argument(argc, argv, 2, 5);
+
+    // fields of 3 to 17 bits
+    std::vector<uint32_t> values(fields_number);
+    std::vector<uint8_t> widths(fields_number);
+    std::mt19937_64 engine(42);
+    std::uniform_int_distribution<unsigned int> width_distribution(3, 17);
+    size_t bits_number = 0;
+    for(size_t i = 0; i < fields_number; ++i)
+    {
+        widths[i] = static_cast<uint8_t>(width_distribution(engine));
+        values[i] = static_cast<uint32_t>(engine()) & ((uint32_t(1) << widths[i]) - 1);
+        bits_number += widths[i];
+    }
+    std::cout << fields_number << " fields, " << bits_number << " bits, best of " << repetitions << " repetitions"
+              << std::endl;
+
+    const double bytes = static_cast<double>(bits_number) / 8;
+    const auto report = [bytes](double milliseconds) {
+        std::cout << "    " << bytes / (milliseconds * 1e6) << " GB/s" << std::endl;
+    };
+
+    sul::dynamic_bitset<uint64_t> bitset;
+    report(benchmark::measure("push_back per bit", repetitions, [&]() {
+        bitset.clear();
+        bitset.reserve(bits_number);
+        for(size_t i = 0; i < fields_number; ++i)
+        {
+            for(size_t bit = 0; bit < widths[i]; ++bit)
+            {
+                bitset.push_back((values[i] >> bit) & 1);
+            }
+        }
+        benchmark::do_not_optimize(bitset.data());
+    }));
+    const sul::dynamic_bitset<uint64_t> push_back_bitset = bitset;
+
+    report(benchmark::measure("bit_writer", repetitions, [&]() {
+        bitset.clear();
+        sul::dynamic_bitset<uint64_t>::bit_writer writer(bitset);
+        writer.reserve(bits_number);
+        for(size_t i = 0; i < fields_number; ++i)
+        {
+            writer.write(values[i], widths[i]);
+        }
+        writer.flush();
+        benchmark::do_not_optimize(bitset.data());
+    }));
+
+    if(bitset != push_back_bitset)
+    {
+        std::cerr << "bit_writer result differs from push_back" << std::endl;
+        return 1;
+    }
+    return 0;
+}
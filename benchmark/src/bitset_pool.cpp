@@ -0,0 +1,93 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include <sul/bitset_pool.hpp>
+#include <sul/dynamic_bitset.hpp>
+
+#include "benchmark.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+
+namespace
+{
+    size_t allocations = 0;
+} // namespace
+
+// count the calls to the global operator new
+void* operator new(size_t size)
+{
+    ++allocations;
+    if(void* p = std::malloc(size == 0 ? 1 : size))
+    {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    std::free(p);
+}
+
+template<typename Allocator>
+void benchmark_queries(const std::string& name, size_t bits_number, size_t queries, size_t repetitions)
+{
+    using bitset_type = sul::dynamic_bitset<uint64_t, Allocator>;
+    std::mt19937_64 engine(42);
+    bitset_type a;
+    bitset_type b;
+    bitset_type c;
+    for(size_t i = 0; i < bits_number / 64; ++i)
+    {
+        a.append(engine());
+        b.append(engine());
+        c.append(engine());
+    }
+
+    size_t count = 0;
+    const size_t allocations_before = allocations;
+    const double milliseconds = benchmark::measure(name, repetitions, [&]() {
+        for(size_t i = 0; i < queries; ++i)
+        {
+            // temporaries of the same size created and destroyed by each query
+            const bitset_type result = ~((a & b) | (c >> 3)) ^ (a << 1);
+            count += result.count();
+        }
+    });
+    benchmark::do_not_optimize(count);
+    std::cout << "    " << milliseconds * 1e6 / static_cast<double>(queries) << " ns per query, "
+              << static_cast<double>(allocations - allocations_before) / static_cast<double>(queries * repetitions)
+              << " allocations per query" << std::endl;
+}
+
+// usage: dynamic_bitset_benchmark_bitset_pool [bits_number] [queries] [repetitions]
+int main(int argc, char* argv[])
+{
+    const size_t bits_number = benchmark::argument(argc, argv, 1, 4096);
+    const size_t queries = benchmark::argument(argc, argv, 2, 100000);
+    const size_t repetitions = benchmark::argument(argc, argv, 3, 5);
+    std::cout << queries << " queries on bitsets of " << bits_number << " bits, best of " << repetitions
+              << " repetitions" << std::endl;
+
+    benchmark_queries<std::allocator<uint64_t>>("std::allocator", bits_number, queries, repetitions);
+    benchmark_queries<sul::recycling_allocator<uint64_t>>("sul::recycling_allocator",
+                                                          bits_number,
+                                                          queries,
+                                                          repetitions);
+
+    return 0;
+}
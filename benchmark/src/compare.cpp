@@ -0,0 +1,83 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include <sul/dynamic_bitset.hpp>
+
+#include "benchmark.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// usage: dynamic_bitset_benchmark_compare [bitset_bytes] [bitsets_number] [repetitions]
+int main(int argc, char* argv[])
+{
+    const size_t bitset_bytes = benchmark::argument(argc, argv, 1, 512);
+    const size_t bitsets_number = benchmark::argument(argc, argv, 2, 100000);
+    const size_t repetitions = benchmark::argument(argc, argv, 3, 5);
+    std::cout << bitsets_number << " pairs of bitsets of " << bitset_bytes
+              << " bytes differing only by their lowest block, best of " << repetitions << " repetitions"
+              << std::endl;
+
+    // worst case for the comparison: the most significant blocks are equal
+    std::vector<sul::dynamic_bitset<uint64_t>> lhs(bitsets_number);
+    std::vector<sul::dynamic_bitset<uint64_t>> rhs(bitsets_number);
+    std::mt19937_64 engine(42);
+    for(size_t i = 0; i < bitsets_number; ++i)
+    {
+        for(size_t j = 0; j < bitset_bytes / sizeof(uint64_t); ++j)
+        {
+            lhs[i].append(engine());
+        }
+        rhs[i] = lhs[i];
+        rhs[i].flip(0);
+    }
+
+    const auto report = [&](double milliseconds) {
+        std::cout << "    " << milliseconds * 1e6 / static_cast<double>(bitsets_number) << " ns per comparison"
+                  << std::endl;
+    };
+
+    report(benchmark::measure("block by block loop", repetitions, [&]() {
+        size_t less = 0;
+        for(size_t i = 0; i < bitsets_number; ++i)
+        {
+            const uint64_t* const lhs_blocks = lhs[i].data();
+            const uint64_t* const rhs_blocks = rhs[i].data();
+            size_t block = lhs[i].num_blocks() - 1;
+            while(block > 0 && lhs_blocks[block] == rhs_blocks[block])
+            {
+                --block;
+            }
+            less += static_cast<size_t>(lhs_blocks[block] < rhs_blocks[block]);
+        }
+        benchmark::do_not_optimize(less);
+    }));
+
+    report(benchmark::measure("operator<", repetitions, [&]() {
+        size_t less = 0;
+        for(size_t i = 0; i < bitsets_number; ++i)
+        {
+            less += static_cast<size_t>(lhs[i] < rhs[i]);
+        }
+        benchmark::do_not_optimize(less);
+    }));
+
+#if DYNAMIC_BITSET_CAN_USE_THREE_WAY_COMPARISON
+    report(benchmark::measure("operator<=>", repetitions, [&]() {
+        size_t less = 0;
+        for(size_t i = 0; i < bitsets_number; ++i)
+        {
+            less += static_cast<size_t>((lhs[i] <=> rhs[i]) < 0);
+        }
+        benchmark::do_not_optimize(less);
+    }));
+#endif
+
+    return 0;
+}
@@ -0,0 +1,68 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include <sul/dynamic_bitset.hpp>
+#include <sul/fingerprinted_dynamic_bitset.hpp>
+
+#include "benchmark.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// usage: dynamic_bitset_benchmark_fingerprint [bitset_bytes] [bitsets_number] [repetitions]
+int main(int argc, char* argv[])
+{
+    const size_t bitset_bytes = benchmark::argument(argc, argv, 1, 4096);
+    const size_t bitsets_number = benchmark::argument(argc, argv, 2, 10000);
+    const size_t repetitions = benchmark::argument(argc, argv, 3, 5);
+    std::cout << bitsets_number << " pairs of bitsets of " << bitset_bytes
+              << " bytes differing only by their last bit, best of " << repetitions << " repetitions" << std::endl;
+
+    std::vector<sul::dynamic_bitset<uint64_t>> bitsets(bitsets_number);
+    std::vector<sul::dynamic_bitset<uint64_t>> others(bitsets_number);
+    std::vector<sul::fingerprinted_dynamic_bitset<uint64_t>> fingerprinted_bitsets;
+    std::vector<sul::fingerprinted_dynamic_bitset<uint64_t>> fingerprinted_others;
+    std::mt19937_64 engine(42);
+    for(size_t i = 0; i < bitsets_number; ++i)
+    {
+        for(size_t j = 0; j < bitset_bytes / sizeof(uint64_t); ++j)
+        {
+            bitsets[i].append(engine());
+        }
+        others[i] = bitsets[i];
+        others[i].flip(others[i].size() - 1);
+        fingerprinted_bitsets.emplace_back(bitsets[i]);
+        fingerprinted_others.emplace_back(others[i]);
+    }
+
+    const auto report = [&](double milliseconds) {
+        std::cout << "    " << milliseconds * 1e6 / static_cast<double>(bitsets_number) << " ns per comparison"
+                  << std::endl;
+    };
+
+    report(benchmark::measure("dynamic_bitset::operator==", repetitions, [&]() {
+        size_t equals = 0;
+        for(size_t i = 0; i < bitsets_number; ++i)
+        {
+            equals += static_cast<size_t>(bitsets[i] == others[i]);
+        }
+        benchmark::do_not_optimize(equals);
+    }));
+
+    report(benchmark::measure("fingerprinted_dynamic_bitset::operator==", repetitions, [&]() {
+        size_t equals = 0;
+        for(size_t i = 0; i < bitsets_number; ++i)
+        {
+            equals += static_cast<size_t>(fingerprinted_bitsets[i] == fingerprinted_others[i]);
+        }
+        benchmark::do_not_optimize(equals);
+    }));
+
+    return 0;
+}
@@ -0,0 +1,85 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include <sul/dynamic_bitset.hpp>
+
+#include "benchmark.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// usage: dynamic_bitset_benchmark_hash [bitset_bytes] [bitsets_number] [repetitions]
+int main(int argc, char* argv[])
+{
+    const size_t bitset_bytes = benchmark::argument(argc, argv, 1, 4096);
+    const size_t bitsets_number = benchmark::argument(argc, argv, 2, 10000);
+    const size_t repetitions = benchmark::argument(argc, argv, 3, 5);
+    std::cout << bitsets_number << " bitsets of " << bitset_bytes << " bytes, best of " << repetitions
+              << " repetitions" << std::endl;
+
+    std::vector<sul::dynamic_bitset<uint64_t>> bitsets(bitsets_number);
+    std::mt19937_64 engine(42);
+    for(sul::dynamic_bitset<uint64_t>& bitset: bitsets)
+    {
+        for(size_t i = 0; i < bitset_bytes / sizeof(uint64_t); ++i)
+        {
+            bitset.append(engine());
+        }
+    }
+
+    const auto report = [](double milliseconds, size_t hashes) {
+        std::cout << "    " << milliseconds * 1e6 / static_cast<double>(hashes) << " ns per hash" << std::endl;
+    };
+
+    // to_string() is much slower, only a fraction of the bitsets are hashed
+    const size_t string_bitsets_number = std::max(bitsets_number / 100, size_t(1));
+    report(benchmark::measure("std::hash<std::string>(to_string())", repetitions, [&]() {
+        size_t result = 0;
+        for(size_t i = 0; i < string_bitsets_number; ++i)
+        {
+            result ^= std::hash<std::string>()(bitsets[i].to_string());
+        }
+        benchmark::do_not_optimize(result);
+    }), string_bitsets_number);
+
+    report(benchmark::measure("std::hash<dynamic_bitset>", repetitions, [&]() {
+        size_t result = 0;
+        for(const sul::dynamic_bitset<uint64_t>& bitset: bitsets)
+        {
+            result ^= std::hash<sul::dynamic_bitset<uint64_t>>()(bitset);
+        }
+        benchmark::do_not_optimize(result);
+    }), bitsets_number);
+
+    // blocks narrower than the 64 bits words of the hash
+    const auto narrow_blocks = [&](auto block, const char* name) {
+        typedef decltype(block) block_type;
+        std::vector<sul::dynamic_bitset<block_type>> narrow_bitsets;
+        narrow_bitsets.reserve(bitsets.size());
+        for(const sul::dynamic_bitset<uint64_t>& bitset: bitsets)
+        {
+            narrow_bitsets.emplace_back(bitset.to_string());
+        }
+        report(benchmark::measure(name, repetitions, [&]() {
+            size_t result = 0;
+            for(const sul::dynamic_bitset<block_type>& bitset: narrow_bitsets)
+            {
+                result ^= static_cast<size_t>(bitset.hash());
+            }
+            benchmark::do_not_optimize(result);
+        }), bitsets_number);
+    };
+    narrow_blocks(uint32_t(), "hash() with uint32_t blocks");
+    narrow_blocks(uint16_t(), "hash() with uint16_t blocks");
+
+    return 0;
+}
@@ -0,0 +1,65 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include <sul/dynamic_bitset.hpp>
+#include <sul/mmap_allocator.hpp>
+
+#include "benchmark.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+
+// usage: dynamic_bitset_benchmark_mmap_allocator [bits_number] [repetitions]
+namespace
+{
+    template<typename Allocator>
+    void run(const std::string& name, size_t bits_number, size_t repetitions)
+    {
+        benchmark::measure(name + " construction", repetitions, [&]() {
+            sul::dynamic_bitset<uint64_t, Allocator> bitset(bits_number, 0);
+            benchmark::do_not_optimize(bitset.data());
+        });
+
+        sul::dynamic_bitset<uint64_t, Allocator> lhs(bits_number, 0);
+        sul::dynamic_bitset<uint64_t, Allocator> rhs(bits_number, 0);
+        benchmark::measure(name + " first write", 1, [&]() {
+            lhs.set();
+        });
+        rhs.set();
+        for(size_t i = 0; i < bits_number; i += 3)
+        {
+            rhs.reset(i);
+        }
+
+        benchmark::measure(name + " count()", repetitions, [&]() {
+            benchmark::do_not_optimize(lhs.count());
+        });
+        benchmark::measure(name + " operator&=", repetitions, [&]() {
+            lhs &= rhs;
+            benchmark::do_not_optimize(lhs.data());
+        });
+    }
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const size_t bits_number = benchmark::argument(argc, argv, 1, size_t(1) << 33);
+    const size_t repetitions = benchmark::argument(argc, argv, 2, 5);
+    std::cout << bits_number << " bits, best of " << repetitions << " repetitions" << std::endl;
+
+    run<std::allocator<uint64_t>>("std::allocator", bits_number, repetitions);
+#if SUL_MMAP_ALLOCATOR_AVAILABLE
+    run<sul::mmap_allocator<uint64_t>>("mmap_allocator", bits_number, repetitions);
+    run<sul::mmap_allocator<uint64_t, true>>("mmap_allocator (populate)", bits_number, repetitions);
+#else
+    std::cout << "mmap_allocator not available on this platform" << std::endl;
+#endif
+
+    return 0;
+}
@@ -0,0 +1,88 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include <sul/dynamic_bitset.hpp>
+
+#include "benchmark.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#if DYNAMIC_BITSET_CAN_USE_PMR
+#    include <memory_resource>
+#endif
+
+namespace
+{
+    // one request: load the bitsets of the query terms and combine them
+    template<typename Bitset, typename Allocator>
+    size_t query(const std::vector<std::vector<uint64_t>>& terms, const Allocator& allocator)
+    {
+        std::vector<Bitset> loaded;
+        loaded.reserve(terms.size());
+        for(const std::vector<uint64_t>& term: terms)
+        {
+            Bitset& bitset = loaded.emplace_back(allocator);
+            bitset.append(term.begin(), term.end());
+        }
+        const Bitset result = ((loaded[0] & loaded[1]) | (loaded[2] - loaded[3])) ^ ~(loaded[0] << 7);
+        return result.count();
+    }
+} // namespace
+
+// usage: dynamic_bitset_benchmark_pmr [bits_number] [requests] [repetitions]
+int main(int argc, char* argv[])
+{
+    const size_t bits_number = benchmark::argument(argc, argv, 1, 4096);
+    const size_t requests = benchmark::argument(argc, argv, 2, 100000);
+    const size_t repetitions = benchmark::argument(argc, argv, 3, 5);
+    std::cout << requests << " requests on 4 bitsets of " << bits_number << " bits, best of " << repetitions
+              << " repetitions" << std::endl;
+
+    std::mt19937_64 engine(42);
+    std::vector<std::vector<uint64_t>> terms(4, std::vector<uint64_t>(bits_number / 64));
+    for(std::vector<uint64_t>& term: terms)
+    {
+        for(uint64_t& block: term)
+        {
+            block = engine();
+        }
+    }
+
+    const auto report = [&](double milliseconds) {
+        std::cout << "    " << milliseconds * 1e6 / static_cast<double>(requests) << " ns per request" << std::endl;
+    };
+
+    report(benchmark::measure("std::allocator", repetitions, [&]() {
+        size_t count = 0;
+        for(size_t i = 0; i < requests; ++i)
+        {
+            count += query<sul::dynamic_bitset<uint64_t>>(terms, std::allocator<uint64_t>());
+        }
+        benchmark::do_not_optimize(count);
+    }));
+
+#if DYNAMIC_BITSET_CAN_USE_PMR
+    // per request arena, released at once at the end of the request
+    std::vector<std::byte> buffer(64 * bits_number);
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size());
+    report(benchmark::measure("std::pmr::monotonic_buffer_resource", repetitions, [&]() {
+        size_t count = 0;
+        for(size_t i = 0; i < requests; ++i)
+        {
+            count += query<sul::pmr::dynamic_bitset<uint64_t>>(terms,
+                                                                std::pmr::polymorphic_allocator<uint64_t>(&arena));
+            arena.release();
+        }
+        benchmark::do_not_optimize(count);
+    }));
+#endif
+
+    return 0;
+}
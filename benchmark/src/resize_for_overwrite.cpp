@@ -0,0 +1,75 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include <sul/dynamic_bitset.hpp>
+
+#include "benchmark.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace
+{
+    // receive a serialized bitset: size the bitset then copy the blocks from the buffer
+    template<typename Bitset, typename Resize>
+    size_t load(const std::vector<uint64_t>& buffer, size_t bits_number, Resize&& resize)
+    {
+        Bitset bitset;
+        resize(bitset, bits_number);
+        std::memcpy(bitset.data(), buffer.data(), bitset.num_blocks() * sizeof(uint64_t));
+        return bitset.num_blocks();
+    }
+} // namespace
+
+// usage: dynamic_bitset_benchmark_resize_for_overwrite [bits_number] [loads] [repetitions]
+int main(int argc, char* argv[])
+{
+    const size_t bits_number = benchmark::argument(argc, argv, 1, 1 << 28);
+    const size_t loads = benchmark::argument(argc, argv, 2, 10);
+    const size_t repetitions = benchmark::argument(argc, argv, 3, 5);
+    std::cout << loads << " loads of " << bits_number << " bits, best of " << repetitions << " repetitions"
+              << std::endl;
+
+    std::mt19937_64 engine(42);
+    std::vector<uint64_t> buffer(bits_number / 64);
+    for(uint64_t& block: buffer)
+    {
+        block = engine();
+    }
+
+    const auto report = [&](double milliseconds) {
+        std::cout << "    " << milliseconds / static_cast<double>(loads) << " ms per load" << std::endl;
+    };
+
+    report(benchmark::measure("resize", repetitions, [&]() {
+        size_t blocks = 0;
+        for(size_t i = 0; i < loads; ++i)
+        {
+            blocks += load<sul::dynamic_bitset<uint64_t>>(buffer, bits_number, [](auto& bitset, size_t nbits) {
+                bitset.resize(nbits);
+            });
+        }
+        benchmark::do_not_optimize(blocks);
+    }));
+
+    report(benchmark::measure("resize_for_overwrite", repetitions, [&]() {
+        size_t blocks = 0;
+        for(size_t i = 0; i < loads; ++i)
+        {
+            blocks += load<sul::dynamic_bitset<uint64_t, sul::default_init_allocator<uint64_t>>>(
+              buffer, bits_number, [](auto& bitset, size_t nbits) {
+                  bitset.resize_for_overwrite(nbits);
+              });
+        }
+        benchmark::do_not_optimize(blocks);
+    }));
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include <sul/dynamic_bitset.hpp>
+
+#include "benchmark.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// usage: dynamic_bitset_benchmark_segment_counts [bits_number] [segment_bits] [repetitions]
+int main(int argc, char* argv[])
+{
+    const size_t bits_number = benchmark::argument(argc, argv, 1, size_t(1) << 30);
+    const size_t segment_bits = benchmark::argument(argc, argv, 2, 4096);
+    const size_t repetitions = benchmark::argument(argc, argv, 3, 5);
+    std::cout << bits_number << " bits, " << segment_bits << " bits segments, best of " << repetitions
+              << " repetitions" << std::endl;
+
+    sul::dynamic_bitset<uint64_t> bitset;
+    bitset.reserve(bits_number);
+    std::mt19937_64 engine(42);
+    while(bitset.size() < bits_number)
+    {
+        bitset.append(engine());
+    }
+    bitset.resize(bits_number);
+
+    std::vector<size_t> counts;
+    counts.reserve(bits_number / segment_bits + 1);
+
+    const double bytes = static_cast<double>(bitset.num_blocks() * sizeof(uint64_t));
+    const auto report = [bytes](double milliseconds) {
+        std::cout << "    " << bytes / (milliseconds * 1e6) << " GB/s" << std::endl;
+    };
+
+    report(benchmark::measure("count(pos, len) per segment", repetitions, [&]() {
+        counts.clear();
+        for(size_t pos = 0; pos < bits_number; pos += segment_bits)
+        {
+            counts.push_back(bitset.count(pos, std::min(segment_bits, bits_number - pos)));
+        }
+        benchmark::do_not_optimize(counts.data());
+    }));
+
+    report(benchmark::measure("segment_counts", repetitions, [&]() {
+        counts.clear();
+        bitset.segment_counts(segment_bits, std::back_inserter(counts));
+        benchmark::do_not_optimize(counts.data());
+    }));
+
+    // without the cost of the vector growth, significant for small segments
+    std::vector<size_t> preallocated_counts(bits_number / segment_bits + 1);
+    report(benchmark::measure("segment_counts (preallocated)", repetitions, [&]() {
+        bitset.segment_counts(segment_bits, preallocated_counts.data());
+        benchmark::do_not_optimize(preallocated_counts.data());
+    }));
+
+    report(benchmark::measure("count() (reference)", repetitions, [&]() {
+        benchmark::do_not_optimize(bitset.count());
+    }));
+
+    return 0;
+}
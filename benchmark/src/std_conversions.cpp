@@ -0,0 +1,99 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include <sul/dynamic_bitset.hpp>
+
+#include "benchmark.hpp"
+
+#include <bitset>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+// usage: dynamic_bitset_benchmark_std_conversions [bits_number] [repetitions]
+int main(int argc, char* argv[])
+{
+    const size_t bits_number = benchmark::argument(argc, argv, 1, 100000000);
+    const size_t repetitions = benchmark::argument(argc, argv, 2, 5);
+    std::cout << "conversions of " << bits_number << " bits, best of " << repetitions << " repetitions"
+              << std::endl;
+
+    std::mt19937_64 engine(42);
+    sul::dynamic_bitset<uint64_t> bitset;
+    bitset.reserve(bits_number);
+    while(bitset.size() < bits_number)
+    {
+        bitset.append(engine());
+    }
+    bitset.resize(bits_number);
+    const std::vector<bool> vector = bitset.to_vector_bool();
+
+    benchmark::measure("std::vector<bool> to dynamic_bitset, bit by bit", repetitions, [&]() {
+        sul::dynamic_bitset<uint64_t> result(vector.size());
+        for(size_t i = 0; i < vector.size(); ++i)
+        {
+            result[i] = vector[i];
+        }
+        benchmark::do_not_optimize(result.data());
+    });
+    benchmark::measure("std::vector<bool> to dynamic_bitset", repetitions, [&]() {
+        const sul::dynamic_bitset<uint64_t> result(vector);
+        benchmark::do_not_optimize(result.data());
+    });
+
+    benchmark::measure("dynamic_bitset to std::vector<bool>, bit by bit", repetitions, [&]() {
+        std::vector<bool> result(bitset.size());
+        for(size_t i = 0; i < bitset.size(); ++i)
+        {
+            result[i] = bitset[i];
+        }
+        benchmark::do_not_optimize(result);
+    });
+    benchmark::measure("dynamic_bitset to std::vector<bool>", repetitions, [&]() {
+        const std::vector<bool> result = bitset.to_vector_bool();
+        benchmark::do_not_optimize(result);
+    });
+
+    // the std::bitset does not fit on the stack
+    constexpr size_t std_bits_number = 1 << 24;
+    sul::dynamic_bitset<uint64_t> prefix;
+    prefix.append(bitset.data(), bitset.data() + std_bits_number / 64);
+    const std::unique_ptr<std::bitset<std_bits_number>> std_bitset =
+      std::make_unique<std::bitset<std_bits_number>>(prefix.to_std_bitset<std_bits_number>());
+    std::cout << "std::bitset of " << std_bits_number << " bits" << std::endl;
+
+    benchmark::measure("std::bitset to dynamic_bitset, bit by bit", repetitions, [&]() {
+        sul::dynamic_bitset<uint64_t> result(std_bits_number);
+        for(size_t i = 0; i < std_bits_number; ++i)
+        {
+            result[i] = (*std_bitset)[i];
+        }
+        benchmark::do_not_optimize(result.data());
+    });
+    benchmark::measure("std::bitset to dynamic_bitset", repetitions, [&]() {
+        const sul::dynamic_bitset<uint64_t> result(*std_bitset);
+        benchmark::do_not_optimize(result.data());
+    });
+
+    const auto result = std::make_unique<std::bitset<std_bits_number>>();
+    benchmark::measure("dynamic_bitset to std::bitset, bit by bit", repetitions, [&]() {
+        result->reset();
+        for(size_t i = 0; i < std_bits_number; ++i)
+        {
+            (*result)[i] = prefix[i];
+        }
+        benchmark::do_not_optimize(result.get());
+    });
+    benchmark::measure("dynamic_bitset to std::bitset", repetitions, [&]() {
+        *result = prefix.to_std_bitset<std_bits_number>();
+        benchmark::do_not_optimize(result.get());
+    });
+
+    return 0;
+}
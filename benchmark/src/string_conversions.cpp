@@ -0,0 +1,54 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include <sul/dynamic_bitset.hpp>
+
+#include "benchmark.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+
+// usage: dynamic_bitset_benchmark_string_conversions [bits_number] [repetitions]
+int main(int argc, char* argv[])
+{
+    const size_t bits_number = benchmark::argument(argc, argv, 1, 100000000);
+    const size_t repetitions = benchmark::argument(argc, argv, 2, 5);
+    std::cout << "string conversions of " << bits_number << " bits, best of " << repetitions << " repetitions"
+              << std::endl;
+
+    std::mt19937_64 engine(42);
+    sul::dynamic_bitset<uint64_t> bitset;
+    bitset.reserve(bits_number);
+    while(bitset.size() < bits_number)
+    {
+        bitset.append(engine());
+    }
+    bitset.resize(bits_number);
+    const std::string str = bitset.to_string();
+    const std::string custom_str = bitset.to_string('.', '#');
+
+    benchmark::measure("to_string", repetitions, [&]() {
+        const std::string result = bitset.to_string();
+        benchmark::do_not_optimize(result.data());
+    });
+    benchmark::measure("to_string('.', '#')", repetitions, [&]() {
+        const std::string result = bitset.to_string('.', '#');
+        benchmark::do_not_optimize(result.data());
+    });
+    benchmark::measure("string constructor", repetitions, [&]() {
+        const sul::dynamic_bitset<uint64_t> result(str);
+        benchmark::do_not_optimize(result.data());
+    });
+    benchmark::measure("string constructor('.', '#')", repetitions, [&]() {
+        const sul::dynamic_bitset<uint64_t> result(custom_str, 0, std::string::npos, '.', '#');
+        benchmark::do_not_optimize(result.data());
+    });
+
+    return 0;
+}
@@ -0,0 +1,238 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef SUL_BITSET_INTERN_POOL_HPP
+#define SUL_BITSET_INTERN_POOL_HPP
+
+/** @file
+ * @brief      @ref sul::bitset_intern_pool declaration and implementation.
+ *
+ * @details    Depends on @a sul/dynamic_bitset.hpp.
+ *
+ * @remark     Include multiple standard library headers.
+ *
+ * @since      1.4.0
+ */
+
+#include "dynamic_bitset.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+#ifndef DYNAMIC_BITSET_NO_NAMESPACE
+namespace sul
+{
+#endif
+
+    /**
+     * @brief      Pool deduplicating identical @ref sul::dynamic_bitset.
+     *
+     * @details    Each distinct content is stored once, @ref intern() gives a shared immutable handle
+     *             to the stored @ref sul::dynamic_bitset, so two handles given by the same pool are
+     *             equal if and only if they point to the same @ref sul::dynamic_bitset. The bitsets
+     *             are looked up by their @ref sul::dynamic_bitset::hash() and only compared to the
+     *             stored bitsets with the same hash.
+     *
+     *             The handles remain valid after the pool is cleared or destroyed, the stored bitsets
+     *             no longer referenced by any handle are freed by @ref release_unused().
+     *
+     * @remark     Not thread-safe, concurrent accesses to a pool must be synchronized by the caller.
+     *
+     * @tparam     Block      Block type to use for storing the bits, must be an unsigned integral type
+     * @tparam     Allocator  Allocator type to use for memory management, must meet the standard
+     *                        requirements of @a Allocator
+     *
+     * @since      1.4.0
+     */
+    template<typename Block = unsigned long long, typename Allocator = std::allocator<Block>>
+    class bitset_intern_pool
+    {
+    public:
+        /**
+         * @brief      Type of the interned @ref sul::dynamic_bitset.
+         *
+         * @since      1.4.0
+         */
+        typedef dynamic_bitset<Block, Allocator> bitset_type;
+
+        /**
+         * @brief      Shared immutable handle to an interned @ref sul::dynamic_bitset, handles of
+         *             the same pool compare equal if and only if the bitsets have the same content.
+         *
+         * @since      1.4.0
+         */
+        typedef std::shared_ptr<const bitset_type> handle;
+
+        /**
+         * @brief      Type used to represent the number of bitsets of the pool.
+         *
+         * @since      1.4.0
+         */
+        typedef size_t size_type;
+
+        /**
+         * @brief      Get the handle to the bitset of the pool with the same content as @p bitset,
+         *             adding a copy of @p bitset to the pool if there is none.
+         *
+         * @param[in]  bitset  @ref sul::dynamic_bitset to intern
+         *
+         * @return     Handle to the interned @ref sul::dynamic_bitset
+         *
+         * @complexity Linear in the size of @p bitset on average.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] handle intern(const bitset_type& bitset);
+
+        /**
+         * @brief      Get the handle to the bitset of the pool with the same content as @p bitset,
+         *             moving @p bitset into the pool if there is none.
+         *
+         * @param[in]  bitset  @ref sul::dynamic_bitset to intern
+         *
+         * @return     Handle to the interned @ref sul::dynamic_bitset
+         *
+         * @complexity Linear in the size of @p bitset on average.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] handle intern(bitset_type&& bitset);
+
+        /**
+         * @brief      Gives the number of distinct bitsets in the pool.
+         *
+         * @return     The number of distinct bitsets
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] size_type size() const noexcept;
+
+        /**
+         * @brief      Checks if the pool contains no bitset.
+         *
+         * @return     @a true if the pool is empty, @a false otherwise
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] bool empty() const noexcept;
+
+        /**
+         * @brief      Remove from the pool the bitsets no longer referenced by any handle.
+         *
+         * @return     The number of bitsets removed
+         *
+         * @complexity Linear in the number of bitsets of the pool.
+         *
+         * @since      1.4.0
+         */
+        size_type release_unused();
+
+        /**
+         * @brief      Remove all the bitsets from the pool, the existing handles remain valid.
+         *
+         * @details    Bitsets interned after the call get new handles, different from the handles
+         *             given before the call even for the same content.
+         *
+         * @complexity Linear in the number of bitsets of the pool.
+         *
+         * @since      1.4.0
+         */
+        void clear() noexcept;
+
+    private:
+        template<typename Bitset>
+        handle intern_impl(Bitset&& bitset);
+
+        std::unordered_multimap<size_t, handle> m_bitsets;
+    };
+
+    //=================================================================================================
+    // bitset_intern_pool functions implementations
+    //=================================================================================================
+
+    template<typename Block, typename Allocator>
+    typename bitset_intern_pool<Block, Allocator>::handle
+    bitset_intern_pool<Block, Allocator>::intern(const bitset_type& bitset)
+    {
+        return intern_impl(bitset);
+    }
+
+    template<typename Block, typename Allocator>
+    typename bitset_intern_pool<Block, Allocator>::handle
+    bitset_intern_pool<Block, Allocator>::intern(bitset_type&& bitset)
+    {
+        return intern_impl(std::move(bitset));
+    }
+
+    template<typename Block, typename Allocator>
+    typename bitset_intern_pool<Block, Allocator>::size_type
+    bitset_intern_pool<Block, Allocator>::size() const noexcept
+    {
+        return m_bitsets.size();
+    }
+
+    template<typename Block, typename Allocator>
+    bool bitset_intern_pool<Block, Allocator>::empty() const noexcept
+    {
+        return m_bitsets.empty();
+    }
+
+    template<typename Block, typename Allocator>
+    typename bitset_intern_pool<Block, Allocator>::size_type bitset_intern_pool<Block, Allocator>::release_unused()
+    {
+        size_type removed = 0;
+        for(auto it = m_bitsets.begin(); it != m_bitsets.end();)
+        {
+            if(it->second.use_count() == 1)
+            {
+                it = m_bitsets.erase(it);
+                ++removed;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        return removed;
+    }
+
+    template<typename Block, typename Allocator>
+    void bitset_intern_pool<Block, Allocator>::clear() noexcept
+    {
+        m_bitsets.clear();
+    }
+
+    template<typename Block, typename Allocator>
+    template<typename Bitset>
+    typename bitset_intern_pool<Block, Allocator>::handle
+    bitset_intern_pool<Block, Allocator>::intern_impl(Bitset&& bitset)
+    {
+        const size_t hash = static_cast<size_t>(bitset.hash());
+        const auto range = m_bitsets.equal_range(hash);
+        for(auto it = range.first; it != range.second; ++it)
+        {
+            if(*it->second == bitset)
+            {
+                return it->second;
+            }
+        }
+        handle interned = std::make_shared<const bitset_type>(std::forward<Bitset>(bitset));
+        m_bitsets.emplace(hash, interned);
+        return interned;
+    }
+
+#ifndef DYNAMIC_BITSET_NO_NAMESPACE
+} // namespace sul
+#endif
+
+#endif // SUL_BITSET_INTERN_POOL_HPP
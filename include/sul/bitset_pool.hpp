@@ -0,0 +1,483 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef SUL_BITSET_POOL_HPP
+#define SUL_BITSET_POOL_HPP
+
+/** @file
+ * @brief      @ref sul::bitset_pool and @ref sul::recycling_allocator declaration and implementation.
+ *
+ * @details    Standalone file, does not depend on other implementation files or dependencies other
+ *             than the standard library.
+ *
+ * @remark     Include multiple standard library headers.
+ *
+ * @since      1.4.0
+ */
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+// define SUL_BITSET_POOL_MALLOC
+// the recycled storages are not known by the compiler to be unaliased like the ones returned by operator
+// new, which prevents it from turning the copies into the storages into memcpy
+#if defined(__GNUC__) // also defined by clang
+#    define SUL_BITSET_POOL_MALLOC __attribute__((malloc))
+#elif defined(_MSC_VER)
+#    define SUL_BITSET_POOL_MALLOC __declspec(restrict)
+#else
+#    define SUL_BITSET_POOL_MALLOC
+#endif
+
+#ifndef DYNAMIC_BITSET_NO_NAMESPACE
+namespace sul
+{
+#endif
+
+    template<typename T>
+    class recycling_allocator;
+
+    /**
+     * @brief      Pool recycling the deallocated storages, keyed by size.
+     *
+     * @details    Keeps up to @ref max_cached_per_size deallocated storages of each size, for up to
+     *             @ref max_sizes different sizes, the least recently used sizes being evicted, to
+     *             serve the next allocations of the same size without calling operator new. The
+     *             cached storages are linked through their first bytes, so caching a storage never
+     *             allocates. Used by @ref recycling_allocator through the pool of the calling thread,
+     *             see @ref thread_pool().
+     *
+     * @remark     Not thread-safe, each thread uses its own pool.
+     *
+     * @since      1.4.0
+     */
+    class bitset_pool
+    {
+    public:
+        /**
+         * @brief      Maximum number of deallocated storages of the same size kept in the pool.
+         *
+         * @since      1.4.0
+         */
+        static constexpr size_t max_cached_per_size = 64;
+
+        /**
+         * @brief      Maximum number of different sizes of storages kept in the pool, the storages
+         *             of the least recently used size are freed to cache a new size.
+         *
+         * @since      1.4.0
+         */
+        static constexpr size_t max_sizes = 16;
+
+        /**
+         * @brief      Constructs an empty @ref bitset_pool.
+         *
+         * @since      1.4.0
+         */
+        bitset_pool() = default;
+
+        bitset_pool(const bitset_pool&) = delete;
+        bitset_pool& operator=(const bitset_pool&) = delete;
+
+        /**
+         * @brief      Destroys the @ref bitset_pool, freeing the cached storages.
+         *
+         * @since      1.4.0
+         */
+        ~bitset_pool();
+
+        /**
+         * @brief      Allocate @p size bytes, reusing a cached storage of the same size if any.
+         *
+         * @param[in]  size  Number of bytes to allocate
+         *
+         * @return     Pointer to the storage, aligned as by operator new
+         *
+         * @throws     std::bad_alloc  if the allocation fails
+         *
+         * @complexity Constant on average.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] SUL_BITSET_POOL_MALLOC void* allocate(size_t size);
+
+        /**
+         * @brief      Deallocate the storage pointed by @p p, caching it for reuse if there are less
+         *             than @ref max_cached_per_size cached storages of @p size bytes.
+         *
+         * @details    If @ref max_sizes different sizes are already cached and @p size is not one of
+         *             them, the storages of the least recently used size are freed to cache @p size.
+         *
+         * @param      p     Pointer obtained from @ref allocate() of any @ref bitset_pool
+         * @param[in]  size  Number of bytes passed to @ref allocate()
+         *
+         * @complexity Constant on average.
+         *
+         * @since      1.4.0
+         */
+        void deallocate(void* p, size_t size) noexcept;
+
+        /**
+         * @brief      Gives the number of storages cached in the pool.
+         *
+         * @return     The number of cached storages
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] size_t cached() const noexcept;
+
+        /**
+         * @brief      Free all the cached storages.
+         *
+         * @complexity Linear in the number of cached storages.
+         *
+         * @since      1.4.0
+         */
+        void release() noexcept;
+
+        /**
+         * @brief      Gives the pool of the calling thread.
+         *
+         * @return     Pointer to the pool of the calling thread, @a nullptr if called while the
+         *             thread local objects of the thread are destroyed after the pool
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] static bitset_pool* thread_pool() noexcept;
+
+    private:
+        template<typename T>
+        friend class recycling_allocator;
+
+        struct free_list
+        {
+            size_t size = 0;
+            void* head = nullptr;
+            size_t count = 0;
+            // value of m_uses at the last allocation or deallocation of the size
+            size_t last_use = 0;
+        };
+
+        explicit bitset_pool(bool* destroyed) noexcept;
+
+        // storages are at least as large as the pointer linking them when cached, including the storages
+        // allocated without a pool which may be cached by the pool of another thread on deallocation
+        static constexpr size_t storage_size(size_t size) noexcept;
+        // free list of the storages of size bytes, nullptr if none
+        free_list* find_free_list(size_t size) noexcept;
+        // free list of the storages of size bytes, evicting the least recently used size if needed
+        free_list* make_free_list(size_t size) noexcept;
+        // free the storages cached in list and empty it
+        void free_storages(free_list& list) noexcept;
+
+        // a few sizes are expected, searched linearly
+        free_list m_free_lists[max_sizes];
+        size_t m_sizes = 0;
+        size_t m_cached = 0;
+        // number of allocations and deallocations of cached sizes, to find the least recently used size
+        size_t m_uses = 0;
+        // set to true on destruction, for the thread pool
+        bool* m_destroyed = nullptr;
+    };
+
+    /**
+     * @brief      Allocator recycling the storages through the @ref bitset_pool of the calling
+     *             thread.
+     *
+     * @details    Meet the standard requirements of @a Allocator and can be used as @p Allocator of
+     *             @ref sul::dynamic_bitset so that temporaries of the same size (results of the
+     *             binary operators, copies, ...) reuse the storages of the previously destroyed ones
+     *             instead of calling operator new and operator delete each time. Storages
+     *             deallocated by another thread than the one which allocated them are recycled by
+     *             the pool of the deallocating thread.
+     *
+     * @tparam     T     Type of the allocated elements, must not require an alignment greater than
+     *                   the one guaranteed by operator new
+     *
+     * @since      1.4.0
+     */
+    template<typename T>
+    class recycling_allocator
+    {
+        static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "T is over-aligned");
+
+    public:
+        /**
+         * @brief      Type of the allocated elements.
+         *
+         * @since      1.4.0
+         */
+        typedef T value_type;
+
+        /**
+         * @brief      All @ref recycling_allocator instances are equal.
+         *
+         * @since      1.4.0
+         */
+        typedef std::true_type is_always_equal;
+
+        /**
+         * @brief      Constructs a @ref recycling_allocator.
+         *
+         * @since      1.4.0
+         */
+        constexpr recycling_allocator() noexcept = default;
+
+        /**
+         * @brief      Constructs a @ref recycling_allocator from an allocator of another type of
+         *             elements.
+         *
+         * @tparam     U     Type of the elements allocated by the other allocator
+         *
+         * @since      1.4.0
+         */
+        template<typename U>
+        constexpr recycling_allocator(const recycling_allocator<U>&) noexcept;
+
+        /**
+         * @brief      Allocate storage for @p n elements of type @p T.
+         *
+         * @param[in]  n     Number of elements to allocate storage for
+         *
+         * @return     Pointer to the first element of the storage
+         *
+         * @throws     std::bad_alloc  if the allocation fails
+         *
+         * @complexity Constant on average.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] SUL_BITSET_POOL_MALLOC T* allocate(size_t n);
+
+        /**
+         * @brief      Deallocate the storage pointed by @p p, for reuse by the next allocations of
+         *             the same size.
+         *
+         * @param      p     Pointer obtained from @ref allocate()
+         * @param[in]  n     Number of elements passed to @ref allocate()
+         *
+         * @complexity Constant on average.
+         *
+         * @since      1.4.0
+         */
+        void deallocate(T* p, size_t n) noexcept;
+
+        /**
+         * @brief      Test if two @ref recycling_allocator are equal, always @a true.
+         *
+         * @since      1.4.0
+         */
+        template<typename U>
+        [[nodiscard]] constexpr bool operator==(const recycling_allocator<U>&) const noexcept;
+
+        /**
+         * @brief      Test if two @ref recycling_allocator are different, always @a false.
+         *
+         * @since      1.4.0
+         */
+        template<typename U>
+        [[nodiscard]] constexpr bool operator!=(const recycling_allocator<U>&) const noexcept;
+    };
+
+    //=================================================================================================
+    // bitset_pool functions implementations
+    //=================================================================================================
+
+    inline bitset_pool::bitset_pool(bool* destroyed) noexcept : m_destroyed(destroyed)
+    {
+    }
+
+    inline bitset_pool::~bitset_pool()
+    {
+        release();
+        if(m_destroyed != nullptr)
+        {
+            *m_destroyed = true;
+        }
+    }
+
+    inline void* bitset_pool::allocate(size_t size)
+    {
+        free_list* const list = find_free_list(size);
+        if(list != nullptr)
+        {
+            list->last_use = ++m_uses;
+        }
+        if(list != nullptr && list->head != nullptr)
+        {
+            void* const p = list->head;
+            list->head = *static_cast<void**>(p);
+            --list->count;
+            --m_cached;
+            return p;
+        }
+        return ::operator new(storage_size(size));
+    }
+
+    inline void bitset_pool::deallocate(void* p, size_t size) noexcept
+    {
+        free_list* list = find_free_list(size);
+        if(list == nullptr)
+        {
+            list = make_free_list(size);
+        }
+        list->last_use = ++m_uses;
+        if(list->count == max_cached_per_size)
+        {
+            ::operator delete(p, storage_size(size));
+            return;
+        }
+        *static_cast<void**>(p) = list->head;
+        list->head = p;
+        ++list->count;
+        ++m_cached;
+    }
+
+    inline size_t bitset_pool::cached() const noexcept
+    {
+        return m_cached;
+    }
+
+    inline void bitset_pool::release() noexcept
+    {
+        for(size_t i = 0; i < m_sizes; ++i)
+        {
+            free_storages(m_free_lists[i]);
+            m_free_lists[i] = free_list();
+        }
+        m_sizes = 0;
+        m_uses = 0;
+    }
+
+    inline bitset_pool* bitset_pool::thread_pool() noexcept
+    {
+        // trivially destructible, so still usable when the thread local pool is destroyed
+        thread_local bool destroyed = false;
+        if(destroyed)
+        {
+            return nullptr;
+        }
+        thread_local bitset_pool pool(&destroyed);
+        return &pool;
+    }
+
+    constexpr size_t bitset_pool::storage_size(size_t size) noexcept
+    {
+        return size < sizeof(void*) ? sizeof(void*) : size;
+    }
+
+    inline bitset_pool::free_list* bitset_pool::find_free_list(size_t size) noexcept
+    {
+        for(size_t i = 0; i < m_sizes; ++i)
+        {
+            if(m_free_lists[i].size == size)
+            {
+                return &m_free_lists[i];
+            }
+        }
+        return nullptr;
+    }
+
+    inline bitset_pool::free_list* bitset_pool::make_free_list(size_t size) noexcept
+    {
+        free_list* list = nullptr;
+        if(m_sizes < max_sizes)
+        {
+            list = &m_free_lists[m_sizes++];
+        }
+        else
+        {
+            // sizes used once, such as the sizes of a growing storage, must not keep their slot
+            list = &m_free_lists[0];
+            for(size_t i = 1; i < m_sizes; ++i)
+            {
+                if(m_free_lists[i].last_use < list->last_use)
+                {
+                    list = &m_free_lists[i];
+                }
+            }
+            free_storages(*list);
+        }
+        *list = free_list();
+        list->size = size;
+        return list;
+    }
+
+    inline void bitset_pool::free_storages(free_list& list) noexcept
+    {
+        while(list.head != nullptr)
+        {
+            void* const p = list.head;
+            list.head = *static_cast<void**>(p);
+            ::operator delete(p, storage_size(list.size));
+        }
+        m_cached -= list.count;
+        list.count = 0;
+    }
+
+    //=================================================================================================
+    // recycling_allocator functions implementations
+    //=================================================================================================
+
+    template<typename T>
+    template<typename U>
+    constexpr recycling_allocator<T>::recycling_allocator(const recycling_allocator<U>&) noexcept
+    {
+    }
+
+    template<typename T>
+    T* recycling_allocator<T>::allocate(size_t n)
+    {
+        if(n > std::numeric_limits<size_t>::max() / sizeof(T))
+        {
+            throw std::bad_alloc();
+        }
+        bitset_pool* const pool = bitset_pool::thread_pool();
+        if(pool == nullptr)
+        {
+            return static_cast<T*>(::operator new(bitset_pool::storage_size(n * sizeof(T))));
+        }
+        return static_cast<T*>(pool->allocate(n * sizeof(T)));
+    }
+
+    template<typename T>
+    void recycling_allocator<T>::deallocate(T* p, size_t n) noexcept
+    {
+        bitset_pool* const pool = bitset_pool::thread_pool();
+        if(pool == nullptr)
+        {
+            ::operator delete(p, bitset_pool::storage_size(n * sizeof(T)));
+            return;
+        }
+        pool->deallocate(p, n * sizeof(T));
+    }
+
+    template<typename T>
+    template<typename U>
+    constexpr bool recycling_allocator<T>::operator==(const recycling_allocator<U>&) const noexcept
+    {
+        return true;
+    }
+
+    template<typename T>
+    template<typename U>
+    constexpr bool recycling_allocator<T>::operator!=(const recycling_allocator<U>&) const noexcept
+    {
+        return false;
+    }
+
+#ifndef DYNAMIC_BITSET_NO_NAMESPACE
+} // namespace sul
+#endif
+
+#endif // SUL_BITSET_POOL_HPP
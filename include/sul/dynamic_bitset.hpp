@@ -38,21 +38,31 @@
  *             Can optionally include and use libpopcnt if @a DYNAMIC_BITSET_NO_LIBPOPCNT is not
  *             defined and @a __has_include(\<libpopcnt.h\>) is @a true.
  *
+ *             Can optionally report the memory reallocations and the hot operations to an
+ *             instrumentation hook if @a DYNAMIC_BITSET_INSTRUMENTATION is defined, see @ref
+ *             sul::dynamic_bitset_record_event().
+ *
  * @remark     Include multiple standard library headers and optionally @a libpopcnt.h.
  *
  * @since      1.0.0
  */
 
 #include <algorithm>
+#include <bitset>
 #include <cassert>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <functional>
+#include <ios>
 #include <limits>
 #include <memory>
+#include <new>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 // define DYNAMIC_BITSET_CAN_USE_LIBPOPCNT
@@ -81,11 +91,84 @@
 #    define DYNAMIC_BITSET_CAN_USE_STD_BITOPS false
 #endif
 
+// define DYNAMIC_BITSET_CAN_USE_THREE_WAY_COMPARISON
+// https://en.cppreference.com/w/cpp/header/compare
+#if __has_include(<compare>)
+#    include <compare>
+#    if defined(__cpp_impl_three_way_comparison) && defined(__cpp_lib_three_way_comparison)
+#        define DYNAMIC_BITSET_CAN_USE_THREE_WAY_COMPARISON true
+#    endif
+#endif
+#if !defined(DYNAMIC_BITSET_CAN_USE_THREE_WAY_COMPARISON)
+#    define DYNAMIC_BITSET_CAN_USE_THREE_WAY_COMPARISON false
+#endif
+
+// define DYNAMIC_BITSET_CAN_USE_PMR
+// https://en.cppreference.com/w/cpp/header/memory_resource
+#if __has_include(<memory_resource>)
+#    include <memory_resource>
+#    if defined(__cpp_lib_memory_resource)
+#        define DYNAMIC_BITSET_CAN_USE_PMR true
+#    endif
+#endif
+#if !defined(DYNAMIC_BITSET_CAN_USE_PMR)
+#    define DYNAMIC_BITSET_CAN_USE_PMR false
+#endif
+
+// define DYNAMIC_BITSET_CAN_COPY_STD_BITSET_WORDS
+// define DYNAMIC_BITSET_CAN_COPY_VECTOR_BOOL_WORDS
+// the standard libraries store the bits of std::bitset, and libstdc++ the ones of std::vector<bool>, in arrays of
+// unsigned integers with the bit i in the bit i % digits of the word i / digits, on little endian targets they have
+// the same bytes as the blocks
+#if !defined(DYNAMIC_BITSET_NO_STD_WORDS_COPY)
+#    if(defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || defined(_MSC_VER)
+#        if defined(__GLIBCXX__) || defined(_LIBCPP_VERSION) || defined(_MSVC_STL_VERSION)
+#            define DYNAMIC_BITSET_CAN_COPY_STD_BITSET_WORDS true
+#        endif
+#        if defined(__GLIBCXX__)
+#            define DYNAMIC_BITSET_CAN_COPY_VECTOR_BOOL_WORDS true
+#        endif
+#    endif
+#endif
+#if !defined(DYNAMIC_BITSET_CAN_COPY_STD_BITSET_WORDS)
+#    define DYNAMIC_BITSET_CAN_COPY_STD_BITSET_WORDS false
+#endif
+#if !defined(DYNAMIC_BITSET_CAN_COPY_VECTOR_BOOL_WORDS)
+#    define DYNAMIC_BITSET_CAN_COPY_VECTOR_BOOL_WORDS false
+#endif
+
+// define DYNAMIC_BITSET_CAN_USE_SWAR_PARSING
+// strings of bytes are parsed 8 characters at a time loaded in a 64 bits integer, the first character being the least
+// significant byte on little endian targets
+#if !defined(DYNAMIC_BITSET_NO_SWAR_PARSING)
+#    if(defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || defined(_MSC_VER)
+#        define DYNAMIC_BITSET_CAN_USE_SWAR_PARSING true
+#    endif
+#endif
+#if !defined(DYNAMIC_BITSET_CAN_USE_SWAR_PARSING)
+#    define DYNAMIC_BITSET_CAN_USE_SWAR_PARSING false
+#endif
+
+// define DYNAMIC_BITSET_CAN_LOAD_BLOCKS_AS_WORDS
+// consecutive blocks narrower than 64 bits are loaded at once as the 64 bits integer with the same bytes, the first
+// block being the least significant on little endian targets
+#if !defined(DYNAMIC_BITSET_NO_WORDS_LOAD)
+#    if(defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || defined(_MSC_VER)
+#        define DYNAMIC_BITSET_CAN_LOAD_BLOCKS_AS_WORDS true
+#    endif
+#endif
+#if !defined(DYNAMIC_BITSET_CAN_LOAD_BLOCKS_AS_WORDS)
+#    define DYNAMIC_BITSET_CAN_LOAD_BLOCKS_AS_WORDS false
+#endif
+
 // define DYNAMIC_BITSET_CAN_USE_CLANG_BUILTIN_POPCOUNT
 // define DYNAMIC_BITSET_CAN_USE_CLANG_BUILTIN_CTZ
+// define DYNAMIC_BITSET_CAN_USE_CLANG_BUILTIN_CLZ
 // define DYNAMIC_BITSET_CAN_USE_GCC_BUILTIN
 // define DYNAMIC_BITSET_CAN_USE_MSVC_BUILTIN_BITSCANFORWARD
 // define DYNAMIC_BITSET_CAN_USE_MSVC_BUILTIN_BITSCANFORWARD64
+// define DYNAMIC_BITSET_CAN_USE_MSVC_BUILTIN_BITSCANREVERSE
+// define DYNAMIC_BITSET_CAN_USE_MSVC_BUILTIN_BITSCANREVERSE64
 #if !DYNAMIC_BITSET_CAN_USE_STD_BITOPS && !defined(DYNAMIC_BITSET_NO_COMPILER_BUILTIN)
 #    if defined(__clang__)
 // https://clang.llvm.org/docs/LanguageExtensions.html#feature-checking-macros
@@ -98,24 +181,35 @@
 #            if __has_builtin(__builtin_ctz) && __has_builtin(__builtin_ctzl) && __has_builtin(__builtin_ctzll)
 #                define DYNAMIC_BITSET_CAN_USE_CLANG_BUILTIN_CTZ true
 #            endif
+#            if __has_builtin(__builtin_clz) && __has_builtin(__builtin_clzl) && __has_builtin(__builtin_clzll)
+#                define DYNAMIC_BITSET_CAN_USE_CLANG_BUILTIN_CLZ true
+#            endif
 #        endif
 #    elif defined(__GNUC__) // also defined by clang
 // https://gcc.gnu.org/onlinedocs/gcc/Other-Builtins.html
 #        define DYNAMIC_BITSET_CAN_USE_GCC_BUILTIN true
 #    elif defined(_MSC_VER)
 // https://docs.microsoft.com/en-us/cpp/intrinsics/bitscanforward-bitscanforward64
+// https://docs.microsoft.com/en-us/cpp/intrinsics/bitscanreverse-bitscanreverse64
 // __popcnt16, __popcnt, __popcnt64 not used because it require to check the hardware support at runtime
 // (https://docs.microsoft.com/fr-fr/cpp/intrinsics/popcnt16-popcnt-popcnt64?view=msvc-160#remarks)
 #        if defined(_M_IX86) || defined(_M_ARM) || defined(_M_X64) || defined(_M_ARM64)
 #            include <intrin.h>
 #            pragma intrinsic(_BitScanForward)
+#            pragma intrinsic(_BitScanReverse)
 #            define DYNAMIC_BITSET_CAN_USE_MSVC_BUILTIN_BITSCANFORWARD true
+#            define DYNAMIC_BITSET_CAN_USE_MSVC_BUILTIN_BITSCANREVERSE true
 #        endif
 #        if(defined(_M_X64) || defined(_M_ARM64)) \
           && !defined(DYNAMIC_BITSET_NO_MSVC_BUILTIN_BITSCANFORWARD64) // for testing purposes
 #            pragma intrinsic(_BitScanForward64)
 #            define DYNAMIC_BITSET_CAN_USE_MSVC_BUILTIN_BITSCANFORWARD64 true
 #        endif
+#        if(defined(_M_X64) || defined(_M_ARM64)) \
+          && !defined(DYNAMIC_BITSET_NO_MSVC_BUILTIN_BITSCANREVERSE64) // for testing purposes
+#            pragma intrinsic(_BitScanReverse64)
+#            define DYNAMIC_BITSET_CAN_USE_MSVC_BUILTIN_BITSCANREVERSE64 true
+#        endif
 #    endif
 #endif
 #if !defined(DYNAMIC_BITSET_CAN_USE_CLANG_BUILTIN_POPCOUNT)
@@ -124,6 +218,9 @@
 #if !defined(DYNAMIC_BITSET_CAN_USE_CLANG_BUILTIN_CTZ)
 #    define DYNAMIC_BITSET_CAN_USE_CLANG_BUILTIN_CTZ false
 #endif
+#if !defined(DYNAMIC_BITSET_CAN_USE_CLANG_BUILTIN_CLZ)
+#    define DYNAMIC_BITSET_CAN_USE_CLANG_BUILTIN_CLZ false
+#endif
 #if !defined(DYNAMIC_BITSET_CAN_USE_GCC_BUILTIN)
 #    define DYNAMIC_BITSET_CAN_USE_GCC_BUILTIN false
 #endif
@@ -133,10 +230,27 @@
 #if !defined(DYNAMIC_BITSET_CAN_USE_MSVC_BUILTIN_BITSCANFORWARD64)
 #    define DYNAMIC_BITSET_CAN_USE_MSVC_BUILTIN_BITSCANFORWARD64 false
 #endif
+#if !defined(DYNAMIC_BITSET_CAN_USE_MSVC_BUILTIN_BITSCANREVERSE)
+#    define DYNAMIC_BITSET_CAN_USE_MSVC_BUILTIN_BITSCANREVERSE false
+#endif
+#if !defined(DYNAMIC_BITSET_CAN_USE_MSVC_BUILTIN_BITSCANREVERSE64)
+#    define DYNAMIC_BITSET_CAN_USE_MSVC_BUILTIN_BITSCANREVERSE64 false
+#endif
 #if !defined(DYNAMIC_BITSET_CAN_USE_MSVC_BUILTIN)
 #    define DYNAMIC_BITSET_CAN_USE_MSVC_BUILTIN false
 #endif
 
+// define DYNAMIC_BITSET_USE_INSTRUMENTATION
+// define DYNAMIC_BITSET_INSTRUMENTATION_HOOK
+#if defined(DYNAMIC_BITSET_INSTRUMENTATION)
+#    define DYNAMIC_BITSET_USE_INSTRUMENTATION true
+#    if !defined(DYNAMIC_BITSET_INSTRUMENTATION_HOOK)
+#        define DYNAMIC_BITSET_INSTRUMENTATION_HOOK(event, blocks) dynamic_bitset_record_event(event, blocks)
+#    endif
+#else
+#    define DYNAMIC_BITSET_USE_INSTRUMENTATION false
+#endif
+
 #ifndef DYNAMIC_BITSET_NO_NAMESPACE
 /**
  * @brief      Simple Useful Libraries.
@@ -148,137 +262,580 @@ namespace sul
 #endif
 
     /**
-     * @brief      Dynamic bitset.
-     *
-     * @details    Data structure used to store a vector of bits and apply binary operations to it. The
-     *             bits are stored in an optimized way in an underling block type. It is highly inspired
-     *             by std\::bitset but with a run-time changeable size.
+     * @brief      Operations of @ref sul::dynamic_bitset reported to the instrumentation hook.
      *
-     *             Preconditions are checked with @a assert but no exception will be thrown if one is
-     *             violated (as with std\::bitset).
+     * @details    Only used if @a DYNAMIC_BITSET_INSTRUMENTATION is defined, see @ref
+     *             dynamic_bitset_record_event() for more informations.
      *
-     * @remark     It is not a Container as it does not provide iterators because of the reference proxy
-     *             class used to access the bits.
+     * @since      1.4.0
+     */
+    enum class dynamic_bitset_event : unsigned int
+    {
+        reallocation, ///< The blocks storage capacity changed, reported blocks: new capacity
+        resize, ///< @ref sul::dynamic_bitset::resize(), reported blocks: new number of blocks
+        bitwise_operation, ///< Bitwise and shift operators, reported blocks: number of blocks
+        count, ///< @ref sul::dynamic_bitset::count(), reported blocks: number of blocks
+        find, ///< @a find_* functions, reported blocks: number of blocks scanned
+        to_string, ///< @ref sul::dynamic_bitset::to_string(), reported blocks: number of blocks
+    };
+
+    /**
+     * @brief      Number of @ref dynamic_bitset_event values.
      *
-     * @tparam     Block      Block type to use for storing the bits, must be an unsigned integral type
-     * @tparam     Allocator  Allocator type to use for memory management, must meet the standard
-     *                        requirements of @a Allocator
+     * @since      1.4.0
+     */
+    constexpr size_t dynamic_bitset_events_number = 6;
+
+    /**
+     * @brief      Counters of the @ref dynamic_bitset_event reported by the default instrumentation
+     *             hook.
      *
-     * @since      1.0.0
+     * @since      1.4.0
      */
-    template<typename Block = unsigned long long, typename Allocator = std::allocator<Block>>
-    class dynamic_bitset
+    struct dynamic_bitset_counters
     {
-        static_assert(std::is_unsigned<Block>::value, "Block is not an unsigned integral type");
+        /**
+         * @brief      Counters of a single @ref dynamic_bitset_event.
+         *
+         * @since      1.4.0
+         */
+        struct event_counters
+        {
+            /**
+             * @brief      Number of times the event was reported.
+             */
+            size_t calls = 0;
+
+            /**
+             * @brief      Sum of the number of blocks reported with the event.
+             */
+            size_t blocks = 0;
+        };
 
-    public:
         /**
-         * @brief      Type used to represent the size of a @ref sul::dynamic_bitset.
+         * @brief      Counters of each @ref dynamic_bitset_event, indexed by event value.
+         */
+        event_counters events[dynamic_bitset_events_number] = {};
+
+        /**
+         * @brief      Access the counters of @p event.
          *
-         * @since      1.0.0
+         * @param[in]  event  Event to get the counters of
+         *
+         * @return     The counters of @p event
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
          */
-        typedef size_t size_type;
+        [[nodiscard]] constexpr event_counters& operator[](dynamic_bitset_event event) noexcept
+        {
+            return events[static_cast<size_t>(event)];
+        }
 
         /**
-         * @brief      Same type as @p Block.
+         * @brief      Access the counters of @p event.
          *
-         * @since      1.0.0
+         * @param[in]  event  Event to get the counters of
+         *
+         * @return     The counters of @p event
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
          */
-        typedef Block block_type;
+        [[nodiscard]] constexpr const event_counters& operator[](dynamic_bitset_event event) const noexcept
+        {
+            return events[static_cast<size_t>(event)];
+        }
 
         /**
-         * @brief      Same type as @p Allocator.
+         * @brief      Reset all the counters to 0.
          *
-         * @since      1.0.0
+         * @complexity Constant.
+         *
+         * @since      1.4.0
          */
-        typedef Allocator allocator_type;
+        constexpr void reset() noexcept
+        {
+            for(event_counters& counters: events)
+            {
+                counters = event_counters();
+            }
+        }
+    };
+
+    /**
+     * @brief      Get the instrumentation counters of the calling thread.
+     *
+     * @return     The @ref dynamic_bitset_counters of the calling thread
+     *
+     * @complexity Constant.
+     *
+     * @since      1.4.0
+     */
+    [[nodiscard]] inline dynamic_bitset_counters& dynamic_bitset_thread_counters() noexcept
+    {
+        thread_local dynamic_bitset_counters counters;
+        return counters;
+    }
+
+    /**
+     * @brief      Default instrumentation hook, record @p event in the counters of the calling thread.
+     *
+     * @details    If @a DYNAMIC_BITSET_INSTRUMENTATION is defined, the @ref sul::dynamic_bitset
+     *             operations listed in @ref dynamic_bitset_event call the
+     *             @a DYNAMIC_BITSET_INSTRUMENTATION_HOOK(event, blocks) macro, which by default
+     *             calls this function. It can be defined before including the header to call a
+     *             user-supplied hook instead, the hook must not throw. If
+     *             @a DYNAMIC_BITSET_INSTRUMENTATION is not defined, no instrumentation code is
+     *             generated.
+     *
+     * @param[in]  event   Reported event
+     * @param[in]  blocks  Number of blocks associated with the event
+     *
+     * @complexity Constant.
+     *
+     * @since      1.4.0
+     */
+    inline void dynamic_bitset_record_event(dynamic_bitset_event event, size_t blocks) noexcept
+    {
+        dynamic_bitset_counters::event_counters& counters = dynamic_bitset_thread_counters()[event];
+        ++counters.calls;
+        counters.blocks += blocks;
+    }
+
+    /**
+     * @brief      Allocator returning memory aligned on @p Alignment bytes.
+     *
+     * @details    Meet the standard requirements of @a Allocator and can be used as @p Allocator of
+     *             @ref sul::dynamic_bitset to get blocks storage aligned on cache lines or SIMD
+     *             registers width. The size of the allocations is rounded up to a multiple of @p
+     *             Alignment bytes, so whole @p Alignment bytes wide loads and stores starting in the
+     *             storage never cross the end of the allocation.\n\n @ref sul::dynamic_bitset detects
+     *             the alignment guaranteed by this allocator and let the compiler assume it in the
+     *             bitwise operators loops.
+     *
+     * @tparam     T          Type of the allocated elements
+     * @tparam     Alignment  Alignment of the allocated memory in bytes, must be a power of two not
+     *                        less than alignof(@p T)
+     *
+     * @since      1.4.0
+     */
+    template<typename T, size_t Alignment = 64>
+    class aligned_allocator
+    {
+        static_assert(Alignment > 0 && (Alignment & (Alignment - 1)) == 0, "Alignment is not a power of two");
+        static_assert(Alignment >= alignof(T), "Alignment is less than the alignment of T");
 
+    public:
         /**
-         * @brief      Number of bits that can be stored in a block.
+         * @brief      Type of the allocated elements.
          *
-         * @since      1.0.0
+         * @since      1.4.0
          */
-        static constexpr size_type bits_per_block = std::numeric_limits<block_type>::digits;
+        typedef T value_type;
 
         /**
-         * @brief      Maximum value of @ref size_type, returned for invalid positions.
+         * @brief      Alignment of the allocated memory in bytes.
          *
-         * @since      1.0.0
+         * @since      1.4.0
          */
-        static constexpr size_type npos = std::numeric_limits<size_type>::max();
+        static constexpr size_t alignment = Alignment;
 
         /**
-         * @brief      Reference to a @ref sul::dynamic_bitset bit.
+         * @brief      All @ref aligned_allocator instances are equal.
          *
-         * @details    As the bits in the @ref sul::dynamic_bitset class are stored in an optimized way
-         *             in blocks, it is not possible for the subscript operators to return a reference
-         *             to a boolean. Hence this class is used as a proxy to enable subscript operator of
-         *             the @ref sul::dynamic_bitset class to be used as if it was an array of bools.
+         * @since      1.4.0
+         */
+        typedef std::true_type is_always_equal;
+
+        /**
+         * @brief      Rebind the allocator to another type of elements, keeping the alignment.
          *
-         * @since      1.0.0
+         * @tparam     U     Type of the allocated elements of the rebound allocator
+         *
+         * @since      1.4.0
          */
-        class reference
+        template<typename U>
+        struct rebind
         {
-        public:
             /**
-             * @brief      Constructs a @ref reference to a bit from a @ref sul::dynamic_bitset and a
-             *             bit position.
-             *
-             * @param      bitset   @ref sul::dynamic_bitset containing the bit
-             * @param[in]  bit_pos  Position of the bit to reference in the @ref sul::dynamic_bitset
-             *
-             * @complexity Constant.
-             *
-             * @since      1.0.0
+             * @brief      Rebound allocator type.
              */
-            constexpr reference(dynamic_bitset<Block, Allocator>& bitset, size_type bit_pos);
+            typedef aligned_allocator<U, Alignment> other;
+        };
 
-            /**
-             * @brief      Copy constructor.
-             *
-             * @since      1.0.0
-             */
-            constexpr reference(const reference&) noexcept = default;
+        /**
+         * @brief      Constructs an @ref aligned_allocator.
+         *
+         * @since      1.4.0
+         */
+        constexpr aligned_allocator() noexcept = default;
 
-            /**
-             * @brief      Move constructor.
-             *
-             * @since      1.0.0
-             */
-            constexpr reference(reference&&) noexcept = default;
+        /**
+         * @brief      Constructs an @ref aligned_allocator from an allocator of another type of
+         *             elements.
+         *
+         * @tparam     U     Type of the elements allocated by the other allocator
+         *
+         * @since      1.4.0
+         */
+        template<typename U>
+        constexpr aligned_allocator(const aligned_allocator<U, Alignment>&) noexcept
+        {
+        }
 
-            /**
-             * @brief      Destructor.
-             *
-             * @since      1.0.0
-             */
-            ~reference() noexcept = default;
+        /**
+         * @brief      Allocate storage for @p n elements of type @p T.
+         *
+         * @param[in]  n     Number of elements to allocate storage for
+         *
+         * @return     Pointer to the first element of the storage, aligned on @p Alignment bytes
+         *
+         * @throws     std::bad_alloc  if the allocation fails
+         *
+         * @complexity Same as aligned operator new.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] T* allocate(size_t n)
+        {
+            if(n > (std::numeric_limits<size_t>::max() - Alignment) / sizeof(T))
+            {
+                throw std::bad_alloc();
+            }
+            return static_cast<T*>(::operator new(padded_size(n), std::align_val_t(Alignment)));
+        }
 
-            /**
-             * @brief      Assign a value to the referenced bit.
-             *
-             * @param[in]  v     Value to assign to the referenced bit
-             *
-             * @return     The @ref reference
-             *
-             * @complexity Constant.
-             *
-             * @since      1.0.0
-             */
-            constexpr reference& operator=(bool v);
+        /**
+         * @brief      Deallocate the storage pointed by @p p.
+         *
+         * @param      p     Pointer obtained from @ref allocate()
+         * @param[in]  n     Number of elements passed to @ref allocate()
+         *
+         * @complexity Same as aligned operator delete.
+         *
+         * @since      1.4.0
+         */
+        void deallocate(T* p, size_t n) noexcept
+        {
+            ::operator delete(p, padded_size(n), std::align_val_t(Alignment));
+        }
+
+        /**
+         * @brief      Test if two @ref aligned_allocator are equal, always @a true.
+         *
+         * @since      1.4.0
+         */
+        template<typename U>
+        [[nodiscard]] constexpr bool operator==(const aligned_allocator<U, Alignment>&) const noexcept
+        {
+            return true;
+        }
+
+        /**
+         * @brief      Test if two @ref aligned_allocator are different, always @a false.
+         *
+         * @since      1.4.0
+         */
+        template<typename U>
+        [[nodiscard]] constexpr bool operator!=(const aligned_allocator<U, Alignment>&) const noexcept
+        {
+            return false;
+        }
+
+    private:
+        // allocated bytes, rounded up to a multiple of the alignment
+        static constexpr size_t padded_size(size_t n) noexcept
+        {
+            return (n * sizeof(T) + Alignment - 1) & ~(Alignment - 1);
+        }
+    };
+
+    /**
+     * @brief      Allocator adapter default-initializing the elements constructed without arguments.
+     *
+     * @details    Meet the standard requirements of @a Allocator and forward everything to @p
+     *             Allocator, except the construction of elements without arguments which is a
+     *             default-initialization instead of a value-initialization. Used as @p Allocator of
+     *             @ref sul::dynamic_bitset, the new blocks of @ref
+     *             sul::dynamic_bitset::resize_for_overwrite() are left uninitialized instead of being
+     *             zeroed.
+     *
+     * @tparam     T          Type of the allocated elements
+     * @tparam     Allocator  Adapted allocator type, must meet the standard requirements of @a
+     *                        Allocator
+     *
+     * @since      1.4.0
+     */
+    template<typename T, typename Allocator = std::allocator<T>>
+    class default_init_allocator : public Allocator
+    {
+        static_assert(std::is_same_v<T, typename std::allocator_traits<Allocator>::value_type>,
+                      "Allocator value_type is not T");
 
+        typedef std::allocator_traits<Allocator> allocator_traits;
+
+    public:
+        /**
+         * @brief      Rebind the allocator to another type of elements, rebinding the adapted
+         *             allocator.
+         *
+         * @tparam     U     Type of the allocated elements of the rebound allocator
+         *
+         * @since      1.4.0
+         */
+        template<typename U>
+        struct rebind
+        {
             /**
-             * @brief      Assign a value to the referenced bit from another @ref reference.
-             *
-             * @param[in]  rhs   @ref reference to the bit to assign value from
-             *
-             * @return     The @ref reference
-             *
-             * @complexity Constant.
-             *
-             * @since      1.0.0
+             * @brief      Rebound allocator type.
              */
-            constexpr reference& operator=(const reference& rhs);
+            typedef default_init_allocator<U, typename allocator_traits::template rebind_alloc<U>> other;
+        };
+
+        /**
+         * @brief      Constructs a @ref default_init_allocator from the adapted allocator
+         *             constructor arguments.
+         *
+         * @since      1.4.0
+         */
+        using Allocator::Allocator;
+
+        /**
+         * @brief      Constructs a @ref default_init_allocator with a default constructed adapted
+         *             allocator.
+         *
+         * @since      1.4.0
+         */
+        constexpr default_init_allocator() noexcept(std::is_nothrow_default_constructible_v<Allocator>) = default;
+
+        /**
+         * @brief      Constructs a @ref default_init_allocator adapting @p allocator.
+         *
+         * @param[in]  allocator  Allocator to adapt
+         *
+         * @since      1.4.0
+         */
+        constexpr default_init_allocator(const Allocator& allocator) noexcept : Allocator(allocator)
+        {
+        }
+
+        /**
+         * @brief      Constructs a @ref default_init_allocator from an adapter of another type of
+         *             elements.
+         *
+         * @tparam     U                Type of the elements allocated by the other adapter
+         * @tparam     OtherAllocator   Allocator adapted by the other adapter
+         *
+         * @since      1.4.0
+         */
+        template<typename U, typename OtherAllocator>
+        constexpr default_init_allocator(const default_init_allocator<U, OtherAllocator>& other) noexcept
+            : Allocator(static_cast<const OtherAllocator&>(other))
+        {
+        }
+
+        /**
+         * @brief      Default-initialize an element of type @p U at @p p.
+         *
+         * @param      p     Pointer to the uninitialized storage of the element
+         *
+         * @tparam     U     Type of the element
+         *
+         * @complexity Constant, nothing is done for trivial types.
+         *
+         * @since      1.4.0
+         */
+        template<typename U>
+        void construct(U* p) noexcept(std::is_nothrow_default_constructible_v<U>)
+        {
+            ::new(static_cast<void*>(p)) U;
+        }
+
+        /**
+         * @brief      Construct an element of type @p U at @p p from @p args, with the adapted
+         *             allocator.
+         *
+         * @param      p     Pointer to the uninitialized storage of the element
+         * @param      args  Arguments of the element constructor
+         *
+         * @tparam     U     Type of the element
+         * @tparam     Args  Type of @p args
+         *
+         * @complexity Same as the adapted allocator construct.
+         *
+         * @since      1.4.0
+         */
+        template<typename U, typename... Args>
+        constexpr void construct(U* p, Args&&... args) noexcept(std::is_nothrow_constructible_v<U, Args...>)
+        {
+            allocator_traits::construct(static_cast<Allocator&>(*this), p, std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief      Gives the allocator to use for a copy of a container using this allocator.
+         *
+         * @return     The adapter of the allocator given by the adapted allocator
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] constexpr default_init_allocator select_on_container_copy_construction() const
+        {
+            return default_init_allocator(
+              allocator_traits::select_on_container_copy_construction(static_cast<const Allocator&>(*this)));
+        }
+    };
+
+    // allocator of the temporaries computed from a bitset using allocator: the allocator of a copy, so that
+    // allocators bound to a storage (such as mapped_file_allocator) are not shared, except for the
+    // polymorphic allocators which keep the memory resource of the operand
+    template<typename Allocator>
+    [[nodiscard]] constexpr Allocator temporary_allocator(const Allocator& allocator)
+    {
+#if DYNAMIC_BITSET_CAN_USE_PMR
+        typedef typename std::allocator_traits<Allocator>::value_type value_type;
+        if constexpr(std::is_same_v<Allocator, std::pmr::polymorphic_allocator<value_type>>)
+        {
+            return allocator;
+        }
+#endif
+        return std::allocator_traits<Allocator>::select_on_container_copy_construction(allocator);
+    }
+
+    /**
+     * @brief      Dynamic bitset.
+     *
+     * @details    Data structure used to store a vector of bits and apply binary operations to it. The
+     *             bits are stored in an optimized way in an underling block type. It is highly inspired
+     *             by std\::bitset but with a run-time changeable size.
+     *
+     *             Preconditions are checked with @a assert but no exception will be thrown if one is
+     *             violated (as with std\::bitset).
+     *
+     * @remark     It is not a Container as it does not provide iterators because of the reference proxy
+     *             class used to access the bits.
+     *
+     * @tparam     Block      Block type to use for storing the bits, must be an unsigned integral type
+     * @tparam     Allocator  Allocator type to use for memory management, must meet the standard
+     *                        requirements of @a Allocator
+     *
+     * @since      1.0.0
+     */
+    template<typename Block = unsigned long long, typename Allocator = std::allocator<Block>>
+    class dynamic_bitset
+    {
+        static_assert(std::is_unsigned<Block>::value, "Block is not an unsigned integral type");
+
+    public:
+        /**
+         * @brief      Type used to represent the size of a @ref sul::dynamic_bitset.
+         *
+         * @since      1.0.0
+         */
+        typedef size_t size_type;
+
+        /**
+         * @brief      Same type as @p Block.
+         *
+         * @since      1.0.0
+         */
+        typedef Block block_type;
+
+        /**
+         * @brief      Same type as @p Allocator.
+         *
+         * @since      1.0.0
+         */
+        typedef Allocator allocator_type;
+
+        /**
+         * @brief      Number of bits that can be stored in a block.
+         *
+         * @since      1.0.0
+         */
+        static constexpr size_type bits_per_block = std::numeric_limits<block_type>::digits;
+
+        /**
+         * @brief      Maximum value of @ref size_type, returned for invalid positions.
+         *
+         * @since      1.0.0
+         */
+        static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+        /**
+         * @brief      Reference to a @ref sul::dynamic_bitset bit.
+         *
+         * @details    As the bits in the @ref sul::dynamic_bitset class are stored in an optimized way
+         *             in blocks, it is not possible for the subscript operators to return a reference
+         *             to a boolean. Hence this class is used as a proxy to enable subscript operator of
+         *             the @ref sul::dynamic_bitset class to be used as if it was an array of bools.
+         *
+         * @since      1.0.0
+         */
+        class reference
+        {
+        public:
+            /**
+             * @brief      Constructs a @ref reference to a bit from a @ref sul::dynamic_bitset and a
+             *             bit position.
+             *
+             * @param      bitset   @ref sul::dynamic_bitset containing the bit
+             * @param[in]  bit_pos  Position of the bit to reference in the @ref sul::dynamic_bitset
+             *
+             * @complexity Constant.
+             *
+             * @since      1.0.0
+             */
+            constexpr reference(dynamic_bitset<Block, Allocator>& bitset, size_type bit_pos);
+
+            /**
+             * @brief      Copy constructor.
+             *
+             * @since      1.0.0
+             */
+            constexpr reference(const reference&) noexcept = default;
+
+            /**
+             * @brief      Move constructor.
+             *
+             * @since      1.0.0
+             */
+            constexpr reference(reference&&) noexcept = default;
+
+            /**
+             * @brief      Destructor.
+             *
+             * @since      1.0.0
+             */
+            ~reference() noexcept = default;
+
+            /**
+             * @brief      Assign a value to the referenced bit.
+             *
+             * @param[in]  v     Value to assign to the referenced bit
+             *
+             * @return     The @ref reference
+             *
+             * @complexity Constant.
+             *
+             * @since      1.0.0
+             */
+            constexpr reference& operator=(bool v);
+
+            /**
+             * @brief      Assign a value to the referenced bit from another @ref reference.
+             *
+             * @param[in]  rhs   @ref reference to the bit to assign value from
+             *
+             * @return     The @ref reference
+             *
+             * @complexity Constant.
+             *
+             * @since      1.0.0
+             */
+            constexpr reference& operator=(const reference& rhs);
 
             /**
              * @brief      Assign a value to the referenced bit from another @ref reference.
@@ -440,1229 +997,2555 @@ namespace sul
         typedef bool const_reference;
 
         /**
-         * @brief      Copy constructor.
+         * @brief      Writer appending variable-width fields of bits at the end of a @ref
+         *             sul::dynamic_bitset.
          *
-         * @since      1.0.0
-         */
-        constexpr dynamic_bitset(const dynamic_bitset<Block, Allocator>& other) = default;
-
-        /**
-         * @brief      Move constructor.
+         * @details    The bits written are accumulated in a register-sized buffer, only whole buffers
+         *             are transferred to the blocks of the @ref sul::dynamic_bitset, avoiding the
+         *             per-bit resize of @ref push_back(). The bits written are visible in the @ref
+         *             sul::dynamic_bitset after a call to @ref flush() or the destruction of the
+         *             writer. The @ref sul::dynamic_bitset must not be modified by other means while
+         *             the writer is alive, even between two calls to @ref flush(), as the writer
+         *             keeps the position of its buffer in the blocks.
          *
-         * @since      1.0.0
-         */
-        constexpr dynamic_bitset(dynamic_bitset<Block, Allocator>&& other) noexcept = default;
-
-        /**
-         * @brief      Copy assignment operator.
+         *             @code
+         *             sul::dynamic_bitset<> bitset;
+         *             {
+         *                 sul::dynamic_bitset<>::bit_writer writer(bitset);
+         *                 writer.reserve(3 + 17);
+         *                 writer.write(0b101, 3);
+         *                 writer.write(0x1ffff, 17);
+         *             } // flushed
+         *             @endcode
          *
-         * @since      1.0.0
+         * @since      1.4.0
          */
-        constexpr dynamic_bitset<Block, Allocator>& operator=(const dynamic_bitset<Block, Allocator>& other) = default;
+        class bit_writer
+        {
+        public:
+            /**
+             * @brief      Type of the buffer and of the values written, the largest of @ref
+             *             block_type and @a unsigned @a long @a long.
+             *
+             * @since      1.4.0
+             */
+            typedef std::common_type_t<block_type, unsigned long long> buffer_type;
 
-        /**
-         * @brief      Move assignment operator.
-         *
-         * @since      1.0.0
-         */
-        constexpr dynamic_bitset<Block, Allocator>&
-        operator=(dynamic_bitset<Block, Allocator>&& other) noexcept = default;
+            /**
+             * @brief      Number of bits of the buffer, maximum number of bits written at once.
+             *
+             * @since      1.4.0
+             */
+            static constexpr size_type buffer_bits = std::numeric_limits<buffer_type>::digits;
 
-        /**
-         * @brief      Constructs an empty @ref sul::dynamic_bitset.
-         *
-         * @details    A copy of @p allocator will be used for memory management.
-         *
-         * @param[in]  allocator  Allocator to use for memory management
-         *
-         * @complexity Constant.
-         *
-         * @since      1.0.0
-         */
-        constexpr explicit dynamic_bitset(const allocator_type& allocator = allocator_type());
+            /**
+             * @brief      Constructs a @ref bit_writer appending bits at the end of @p bitset.
+             *
+             * @param      bitset  @ref sul::dynamic_bitset to append the bits to
+             *
+             * @complexity Constant.
+             *
+             * @since      1.4.0
+             */
+            constexpr explicit bit_writer(dynamic_bitset<Block, Allocator>& bitset);
 
-        /**
-         * @brief      Constructs a @ref sul::dynamic_bitset of @p nbits bits from an initial value.
-         *
-         * @details    The first bits are initialized with the bits from @p init_val, if @p nbits \>
-         *             std\::numeric_limits\<unsigned long long\>\::digits , all other bits are
-         *             initialized to @a false. A copy of @p allocator will be used for memory
-         *             management.
-         *
-         * @param[in]  nbits      Number of bits of the @ref sul::dynamic_bitset
-         * @param[in]  init_val   Value to initialize the @ref sul::dynamic_bitset with
-         * @param[in]  allocator  Allocator to use for memory management
-         *
-         * @complexity Linear in @p nbits / @ref bits_per_block.
-         *
-         * @since      1.0.0
-         */
-        constexpr explicit dynamic_bitset(size_type nbits,
-                                          unsigned long long init_val = 0,
-                                          const allocator_type& allocator = allocator_type());
+            /**
+             * @brief      Deleted, a @ref bit_writer cannot be copied.
+             *
+             * @since      1.4.0
+             */
+            bit_writer(const bit_writer&) = delete;
 
-        /**
-         * @brief      Constructs a @ref sul::dynamic_bitset using @p init_vals to initialize the first
-         *             blocks.
-         *
-         * @details    The size of the newly created @ref sul::dynamic_bitset is @p init_vals.size() *
-         *             @ref bits_per_block. A copy of @p allocator will be used for memory management.
-         *
-         * @param[in]  init_vals  Value of the @ref sul::dynamic_bitset first blocks
-         * @param[in]  allocator  Allocator to use for memory management
-         *
-         * @complexity Linear in @p init_vals.size().
-         *
-         * @since      1.0.0
-         */
-        constexpr dynamic_bitset(std::initializer_list<block_type> init_vals,
-                                 const allocator_type& allocator = allocator_type());
+            /**
+             * @brief      Deleted, a @ref bit_writer cannot be assigned.
+             *
+             * @since      1.4.0
+             */
+            bit_writer& operator=(const bit_writer&) = delete;
 
-        /**
-         * @brief      Constructs a @ref sul::dynamic_bitset from a string or a part of a string.
-         *
-         * @details    Construct the @ref sul::dynamic_bitset using the characters from @p str in the
-         *             range \[@p pos, std\::min(@p pos + @p n, @p str.size())\[.
-         *
-         * @param[in]  str        String containing the part to use
-         * @param[in]  pos        Starting position of the string part to use in @p str
-         * @param[in]  n          Number of characters of @p str to use from the starting position
-         * @param[in]  zero       Character used to represent @a false bits in @p str
-         * @param[in]  one        Character used to represent @a true bits in @p str
-         * @param[in]  allocator  Allocator to use for memory management
-         *
-         * @tparam     _CharT     Character type of the string
-         * @tparam     _Traits    Traits class specifying the operations on the character type of the
-         *                        string
-         *
-         * @pre        @code
-         *             pos < str.size()
-         *             @endcode
-         *
-         * @complexity Linear in std\::min(@p n, @p str.size() - @p pos).
-         *
-         * @since      1.0.0
-         */
-        template<typename _CharT, typename _Traits>
-        constexpr explicit dynamic_bitset(
-          std::basic_string_view<_CharT, _Traits> str,
-          typename std::basic_string_view<_CharT, _Traits>::size_type pos = 0,
-          typename std::basic_string_view<_CharT, _Traits>::size_type n = std::basic_string_view<_CharT, _Traits>::npos,
-          _CharT zero = _CharT('0'),
-          _CharT one = _CharT('1'),
-          const allocator_type& allocator = allocator_type());
+            /**
+             * @brief      Destructor, @ref flush() the bits written.
+             *
+             * @details    If the flush fails to allocate, the exception is discarded and the @ref
+             *             sul::dynamic_bitset keeps the bits of the last successful @ref flush(), call
+             *             @ref flush() before the destruction to handle the allocation failures.
+             *
+             * @since      1.4.0
+             */
+            ~bit_writer();
 
-        /**
-         * @brief      Constructs a @ref sul::dynamic_bitset from a string or a part of a string.
-         *
-         * @details    Construct the @ref sul::dynamic_bitset using the characters from @p str in the
-         *             range \[@p pos, std\::min(@p pos + @p n, @p str.size())\[.
-         *
-         * @param[in]  str        String containing the part to use
-         * @param[in]  pos        Starting position of the string part to use in @p str
-         * @param[in]  n          Number of characters of @p str to use from the starting position
-         * @param[in]  zero       Character used to represent @a false bits in @p str
-         * @param[in]  one        Character used to represent @a true bits in @p str
-         * @param[in]  allocator  Allocator to use for memory management
-         *
-         * @tparam     _CharT     Character type of the string
-         * @tparam     _Traits    Traits class specifying the operations on the character type of the
-         *                        string
-         * @tparam     _Alloc     Allocator type used to allocate internal storage of the string
-         *
-         * @pre        @code
-         *             pos < str.size()
-         *             @endcode
-         *
-         * @complexity Linear in std\::min(@p n, @p str.size() - @p pos).
-         *
-         * @since      1.0.0
-         */
-        template<typename _CharT, typename _Traits, typename _Alloc>
-        constexpr explicit dynamic_bitset(const std::basic_string<_CharT, _Traits, _Alloc>& str,
-                                          typename std::basic_string<_CharT, _Traits, _Alloc>::size_type pos = 0,
-                                          typename std::basic_string<_CharT, _Traits, _Alloc>::size_type n =
-                                            std::basic_string<_CharT, _Traits, _Alloc>::npos,
-                                          _CharT zero = _CharT('0'),
-                                          _CharT one = _CharT('1'),
-                                          const allocator_type& allocator = allocator_type());
+            /**
+             * @brief      Append the @p nbits lowest bits of @p value.
+             *
+             * @details    The bits of @p value above the @p nbits lowest bits are ignored, the lowest
+             *             bit of @p value is appended first.
+             *
+             * @param[in]  value  Value containing the bits to append
+             * @param[in]  nbits  Number of bits of @p value to append
+             *
+             * @pre        @code
+             *             nbits <= buffer_bits
+             *             @endcode
+             *
+             * @throws     std::bad_alloc  if the allocation of the blocks fails, the writer and the @ref
+             *                             sul::dynamic_bitset are then unchanged
+             *
+             * @complexity Amortized constant.
+             *
+             * @since      1.4.0
+             */
+            constexpr void write(buffer_type value, size_type nbits);
+
+            /**
+             * @brief      Append a bit of value @p value.
+             *
+             * @param[in]  value  Value of the bit to append
+             *
+             * @throws     std::bad_alloc  if the allocation of the blocks fails, the writer and the @ref
+             *                             sul::dynamic_bitset are then unchanged
+             *
+             * @complexity Amortized constant.
+             *
+             * @since      1.4.0
+             */
+            constexpr void write(bool value);
+
+            /**
+             * @brief      Reserve storage for @p nbits more bits in the @ref sul::dynamic_bitset.
+             *
+             * @param[in]  nbits  Number of bits that will be written
+             *
+             * @complexity At most linear in the size of the @ref sul::dynamic_bitset.
+             *
+             * @since      1.4.0
+             */
+            constexpr void reserve(size_type nbits);
+
+            /**
+             * @brief      Transfer the buffered bits to the @ref sul::dynamic_bitset.
+             *
+             * @details    After the call, the size of the @ref sul::dynamic_bitset includes all the
+             *             bits written. The writer can still be used to append bits.
+             *
+             * @throws     std::bad_alloc  if the allocation of the blocks fails, the @ref
+             *                             sul::dynamic_bitset is then unchanged
+             *
+             * @complexity Constant.
+             *
+             * @since      1.4.0
+             */
+            constexpr void flush();
+
+            /**
+             * @brief      Gives the size of the @ref sul::dynamic_bitset including the buffered bits.
+             *
+             * @return     The number of bits of the @ref sul::dynamic_bitset once flushed
+             *
+             * @complexity Constant.
+             *
+             * @since      1.4.0
+             */
+            [[nodiscard]] constexpr size_type size() const noexcept;
+
+        private:
+            // reserve storage for blocks_number blocks, growing geometrically as push_back
+            constexpr void reserve_blocks(size_type blocks_number);
+            // transfer the full buffer to the blocks
+            constexpr void write_buffer(buffer_type buffer);
+            // remove the blocks of the buffer transferred by flush()
+            constexpr void remove_flushed_blocks();
+
+            dynamic_bitset<Block, Allocator>& m_bitset;
+            // position in the bitset of the first bit of the buffer, multiple of bits_per_block
+            size_type m_buffer_pos;
+            buffer_type m_buffer;
+            size_type m_buffered_bits;
+        };
 
         /**
-         * @brief      Constructs a @ref sul::dynamic_bitset from a string or a part of a string.
-         *
-         * @details    Construct the @ref sul::dynamic_bitset using the characters from @p str in the
-         *             range \[@p pos, std\::min(@p pos + @p n, @p _Traits\::length(@p str))\[.
-         *
-         * @param[in]  str        String containing the part to use
-         * @param[in]  pos        Starting position of the string part to use
-         * @param[in]  n          Number of characters to use from the starting position
-         * @param[in]  zero       Character used to represent @a false bits in the string
-         * @param[in]  one        Character used to represent 1 @a true bitsn the string
-         * @param[in]  allocator  Allocator to use for memory management
+         * @brief      Sequential reader of variable-width fields of bits of a @ref sul::dynamic_bitset.
          *
-         * @tparam     _CharT     Character type of the string
-         * @tparam     _Traits    Traits class specifying the operations on the character type of the
-         *                        string
+         * @details    The bits are read from a register-sized buffer, refilled with whole blocks when
+         *             it does not contain enough bits for a read. The @ref sul::dynamic_bitset must not
+         *             be modified while the reader is in use.
          *
-         * @pre        @code
-         *             pos < _Traits::length(str)
+         *             @code
+         *             sul::dynamic_bitset<>::bit_reader reader(bitset);
+         *             const auto a = reader.read(3);
+         *             const auto b = reader.read(17);
          *             @endcode
          *
-         * @complexity Linear in std\::min(@p n, @p _Traits\::length(@p str) - @p pos).
-         *
-         * @since      1.0.0
+         * @since      1.4.0
          */
-        template<typename _CharT, typename _Traits = std::char_traits<_CharT>>
-        constexpr explicit dynamic_bitset(
-          const _CharT* str,
-          typename std::basic_string<_CharT>::size_type pos = 0,
-          typename std::basic_string<_CharT>::size_type n = std::basic_string<_CharT>::npos,
-          _CharT zero = _CharT('0'),
-          _CharT one = _CharT('1'),
-          const allocator_type& allocator = allocator_type());
+        class bit_reader
+        {
+        public:
+            /**
+             * @brief      Type of the buffer and of the values read, the largest of @ref block_type and
+             *             @a unsigned @a long @a long.
+             *
+             * @since      1.4.0
+             */
+            typedef std::common_type_t<block_type, unsigned long long> buffer_type;
 
-        /**
-         * @brief      Destructor.
-         *
-         * @since      1.0.0
-         */
-        ~dynamic_bitset() noexcept = default;
+            /**
+             * @brief      Number of bits of the buffer, maximum number of bits read at once.
+             *
+             * @since      1.4.0
+             */
+            static constexpr size_type buffer_bits = std::numeric_limits<buffer_type>::digits;
 
-        /**
-         * @brief      Resize the @ref sul::dynamic_bitset to contain @p nbits bits.
-         *
-         * @details    Bits keep the value they had before the resize and, if @p nbits is greater than
-         *             the current size, new bit are initialized to @p value.
-         *
-         * @param[in]  nbits  New size of the @ref sul::dynamic_bitset
-         * @param[in]  value  Value of the new bits
-         *
-         * @complexity Linear in the difference between the current size and @p nbits.
-         *             Additional complexity possible due to reallocation if capacity is less than @p
-         *             nbits.
-         *
-         * @since      1.0.0
-         */
-        constexpr void resize(size_type nbits, bool value = false);
+            /**
+             * @brief      Constructs a @ref bit_reader reading the bits of @p bitset from position @p
+             *             pos.
+             *
+             * @param[in]  bitset  @ref sul::dynamic_bitset to read the bits from
+             * @param[in]  pos     Position of the first bit to read
+             *
+             * @pre        @code
+             *             pos <= bitset.size()
+             *             @endcode
+             *
+             * @complexity Constant.
+             *
+             * @since      1.4.0
+             */
+            constexpr explicit bit_reader(const dynamic_bitset<Block, Allocator>& bitset, size_type pos = 0);
+
+            /**
+             * @brief      Read the next @p nbits bits.
+             *
+             * @details    The first bit read corresponds to the least significant digit of the
+             *             returned value.
+             *
+             * @param[in]  nbits  Number of bits to read
+             *
+             * @return     The numeric value corresponding to the bits read
+             *
+             * @pre        @code
+             *             nbits <= buffer_bits && nbits <= remaining()
+             *             @endcode
+             *
+             * @complexity Constant.
+             *
+             * @since      1.4.0
+             */
+            constexpr buffer_type read(size_type nbits);
+
+            /**
+             * @brief      Read the next bit.
+             *
+             * @return     The value of the bit read
+             *
+             * @pre        @code
+             *             remaining() > 0
+             *             @endcode
+             *
+             * @complexity Constant.
+             *
+             * @since      1.4.0
+             */
+            constexpr bool read();
+
+            /**
+             * @brief      Gives the position of the next bit to read.
+             *
+             * @return     The position of the next bit to read in the @ref sul::dynamic_bitset
+             *
+             * @complexity Constant.
+             *
+             * @since      1.4.0
+             */
+            [[nodiscard]] constexpr size_type position() const noexcept;
+
+            /**
+             * @brief      Gives the number of bits remaining to read.
+             *
+             * @return     The number of bits after the current position in the @ref
+             *             sul::dynamic_bitset
+             *
+             * @complexity Constant.
+             *
+             * @since      1.4.0
+             */
+            [[nodiscard]] constexpr size_type remaining() const noexcept;
+
+        private:
+            // load the next blocks in the buffer, return the number of bits loaded
+            constexpr size_type refill();
+
+            const dynamic_bitset<Block, Allocator>& m_bitset;
+            // index of the next block to load in the buffer
+            size_type m_next_block;
+            buffer_type m_buffer;
+            size_type m_buffered_bits;
+        };
 
         /**
-         * @brief      Clears the @ref sul::dynamic_bitset, resize it to 0.
-         *
-         * @details    Equivalent to:
-         *             @code
-         *             this.resize(0);
-         *             @endcode
+         * @brief      Read-only view of a range of bits of a @ref sul::dynamic_bitset.
          *
-         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         * @details    Obtained with @ref slice() const. The positions are relative to the first bit
+         *             of the range, the queries only access the blocks of the range and handle the
+         *             partial first and last blocks internally, no bits are copied. The view is
+         *             invalidated by any operation resizing the @ref sul::dynamic_bitset.
          *
-         * @since      1.0.0
+         * @since      1.4.0
          */
-        constexpr void clear();
+        class const_slice_view
+        {
+        public:
+            /**
+             * @brief      Constructs a @ref const_slice_view of the @p len bits of @p bitset starting at
+             *             position @p pos.
+             *
+             * @param[in]  bitset  @ref sul::dynamic_bitset containing the bits
+             * @param[in]  pos     Position of the first bit of the range
+             * @param[in]  len     Number of bits of the range
+             *
+             * @pre        @code
+             *             pos <= bitset.size() && len <= bitset.size() - pos
+             *             @endcode
+             *
+             * @complexity Constant.
+             *
+             * @since      1.4.0
+             */
+            constexpr const_slice_view(const dynamic_bitset<Block, Allocator>& bitset, size_type pos, size_type len);
+
+            /**
+             * @brief      Gives the number of bits of the view.
+             *
+             * @return     The number of bits of the range
+             *
+             * @complexity Constant.
+             *
+             * @since      1.4.0
+             */
+            [[nodiscard]] constexpr size_type size() const noexcept;
+
+            /**
+             * @brief      Checks if the view is empty.
+             *
+             * @return     @a true if the range contains no bits, @a false otherwise
+             *
+             * @complexity Constant.
+             *
+             * @since      1.4.0
+             */
+            [[nodiscard]] constexpr bool empty() const noexcept;
+
+            /**
+             * @brief      Gives the position in the @ref sul::dynamic_bitset of the first bit of the
+             *             view.
+             *
+             * @return     The position of the first bit of the range
+             *
+             * @complexity Constant.
+             *
+             * @since      1.4.0
+             */
+            [[nodiscard]] constexpr size_type offset() const noexcept;
+
+            /**
+             * @brief      Test the value of the bit at position @p pos of the view.
+             *
+             * @param[in]  pos   Position of the bit to test, relative to the first bit of the view
+             *
+             * @return     The value of the bit
+             *
+             * @pre        @code
+             *             pos < size()
+             *             @endcode
+             *
+             * @complexity Constant.
+             *
+             * @since      1.4.0
+             */
+            [[nodiscard]] constexpr bool test(size_type pos) const;
+
+            /**
+             * @brief      Accesses the bit at position @p pos of the view.
+             *
+             * @param[in]  pos   Position of the bit to access, relative to the first bit of the view
+             *
+             * @return     The value of the bit
+             *
+             * @pre        @code
+             *             pos < size()
+             *             @endcode
+             *
+             * @complexity Constant.
+             *
+             * @since      1.4.0
+             */
+            [[nodiscard]] constexpr const_reference operator[](size_type pos) const;
+
+            /**
+             * @brief      Count the number of bits set to @a true in the view.
+             *
+             * @return     The number of bits of the view that are set to @a true
+             *
+             * @complexity Linear in the size of the view.
+             *
+             * @since      1.4.0
+             */
+            [[nodiscard]] constexpr size_type count() const;
+
+            /**
+             * @brief      Checks if all bits of the view are set to @a true.
+             *
+             * @return     @a true if all bits are set to @a true or if the view is empty, @a false
+             *             otherwise
+             *
+             * @complexity Linear in the size of the view.
+             *
+             * @since      1.4.0
+             */
+            [[nodiscard]] constexpr bool all() const;
+
+            /**
+             * @brief      Checks if any bit of the view is set to @a true.
+             *
+             * @return     @a true if any bit is set to @a true, @a false otherwise
+             *
+             * @complexity Linear in the size of the view.
+             *
+             * @since      1.4.0
+             */
+            [[nodiscard]] constexpr bool any() const;
+
+            /**
+             * @brief      Checks if none of the bits of the view are set to @a true.
+             *
+             * @return     @a true if none of the bits are set to @a true or if the view is empty, @a
+             *             false otherwise
+             *
+             * @complexity Linear in the size of the view.
+             *
+             * @since      1.4.0
+             */
+            [[nodiscard]] constexpr bool none() const;
+
+            /**
+             * @brief      Find the position of the first bit set to @a true in the view.
+             *
+             * @return     If one is found, the position of the first bit set to @a true relative to the
+             *             first bit of the view, @ref npos otherwise
+             *
+             * @complexity Linear in the size of the view.
+             *
+             * @since      1.4.0
+             */
+            [[nodiscard]] constexpr size_type find_first() const;
+
+            /**
+             * @brief      Find the position of the first bit set to @a true in the view with a position
+             *             greater than @p prev.
+             *
+             * @param[in]  prev  Position of the bit preceding the search, relative to the first bit of
+             *                   the view
+             *
+             * @return     If one is found, the position of the bit set to @a true relative to the first
+             *             bit of the view, @ref npos otherwise
+             *
+             * @complexity Linear in size() - @p prev.
+             *
+             * @since      1.4.0
+             */
+            [[nodiscard]] constexpr size_type find_next(size_type prev) const;
+
+        protected:
+            const dynamic_bitset<Block, Allocator>* m_bitset;
+            size_type m_pos;
+            size_type m_len;
+        };
 
         /**
-         * @brief      Add a new bit with the value @p value at the end of the @ref sul::dynamic_bitset.
+         * @brief      Mutable view of a range of bits of a @ref sul::dynamic_bitset.
          *
-         * @details    Increase the size of the bitset by one, the added bit becomes the
-         *             most-significant bit.
+         * @details    Obtained with @ref slice(), provides the queries of @ref const_slice_view and
+         *             modifications of the bits of the range, the bits outside of the range are never
+         *             modified. The view is invalidated by any operation resizing the @ref
+         *             sul::dynamic_bitset.
          *
-         * @param[in]  value  Value of the bit to add
+         * @since      1.4.0
+         */
+        class slice_view : public const_slice_view
+        {
+        public:
+            /**
+             * @brief      Constructs a @ref slice_view of the @p len bits of @p bitset starting at
+             *             position @p pos.
+             *
+             * @param      bitset  @ref sul::dynamic_bitset containing the bits
+             * @param[in]  pos     Position of the first bit of the range
+             * @param[in]  len     Number of bits of the range
+             *
+             * @pre        @code
+             *             pos <= bitset.size() && len <= bitset.size() - pos
+             *             @endcode
+             *
+             * @complexity Constant.
+             *
+             * @since      1.4.0
+             */
+            constexpr slice_view(dynamic_bitset<Block, Allocator>& bitset, size_type pos, size_type len);
+
+            using const_slice_view::operator[];
+
+            /**
+             * @brief      Accesses the bit at position @p pos of the view.
+             *
+             * @param[in]  pos   Position of the bit to access, relative to the first bit of the view
+             *
+             * @return     A @ref reference to the bit
+             *
+             * @pre        @code
+             *             pos < size()
+             *             @endcode
+             *
+             * @complexity Constant.
+             *
+             * @since      1.4.0
+             */
+            [[nodiscard]] constexpr reference operator[](size_type pos);
+
+            /**
+             * @brief      Set the bit at position @p pos of the view to @p value.
+             *
+             * @param[in]  pos    Position of the bit to set, relative to the first bit of the view
+             * @param[in]  value  Value to set the bit to
+             *
+             * @return     The @ref slice_view
+             *
+             * @pre        @code
+             *             pos < size()
+             *             @endcode
+             *
+             * @complexity Constant.
+             *
+             * @since      1.4.0
+             */
+            constexpr slice_view& set(size_type pos, bool value = true);
+
+            /**
+             * @brief      Set all the bits of the view to @a true.
+             *
+             * @return     The @ref slice_view
+             *
+             * @complexity Linear in the size of the view.
+             *
+             * @since      1.4.0
+             */
+            constexpr slice_view& set();
+
+            /**
+             * @brief      Reset the bit at position @p pos of the view to @a false.
+             *
+             * @param[in]  pos   Position of the bit to reset, relative to the first bit of the view
+             *
+             * @return     The @ref slice_view
+             *
+             * @pre        @code
+             *             pos < size()
+             *             @endcode
+             *
+             * @complexity Constant.
+             *
+             * @since      1.4.0
+             */
+            constexpr slice_view& reset(size_type pos);
+
+            /**
+             * @brief      Reset all the bits of the view to @a false.
+             *
+             * @return     The @ref slice_view
+             *
+             * @complexity Linear in the size of the view.
+             *
+             * @since      1.4.0
+             */
+            constexpr slice_view& reset();
+
+            /**
+             * @brief      Flip the bit at position @p pos of the view.
+             *
+             * @param[in]  pos   Position of the bit to flip, relative to the first bit of the view
+             *
+             * @return     The @ref slice_view
+             *
+             * @pre        @code
+             *             pos < size()
+             *             @endcode
+             *
+             * @complexity Constant.
+             *
+             * @since      1.4.0
+             */
+            constexpr slice_view& flip(size_type pos);
+
+            /**
+             * @brief      Flip all the bits of the view.
+             *
+             * @return     The @ref slice_view
+             *
+             * @complexity Linear in the size of the view.
+             *
+             * @since      1.4.0
+             */
+            constexpr slice_view& flip();
+
+        private:
+            dynamic_bitset<Block, Allocator>* m_mutable_bitset;
+        };
+
+        /**
+         * @brief      Copy constructor.
          *
-         * @complexity Amortized constant.
+         * @since      1.0.0
+         */
+        constexpr dynamic_bitset(const dynamic_bitset<Block, Allocator>& other) = default;
+
+        /**
+         * @brief      Move constructor.
          *
          * @since      1.0.0
          */
-        constexpr void push_back(bool value);
+        constexpr dynamic_bitset(dynamic_bitset<Block, Allocator>&& other) noexcept = default;
 
         /**
-         * @brief      Remove the last bit of the @ref sul::dynamic_bitset.
+         * @brief      Copy constructor using @p allocator for memory management.
          *
-         * @details    Decrease the size of the @ref sul::dynamic_bitset by one, does nothing if the
-         *             @ref dynamic_bitset is empty.
+         * @param[in]  other      @ref sul::dynamic_bitset to copy
+         * @param[in]  allocator  Allocator to use for memory management
          *
-         * @complexity Constant.
+         * @complexity Linear in the size of @p other.
          *
-         * @since      1.0.0
+         * @since      1.4.0
          */
-        constexpr void pop_back();
+        constexpr dynamic_bitset(const dynamic_bitset<Block, Allocator>& other, const allocator_type& allocator);
 
         /**
-         * @brief      Append a block of bits @p block at the end of the @ref sul::dynamic_bitset.
+         * @brief      Move constructor using @p allocator for memory management.
          *
-         * @details    Increase the size of the @ref sul::dynamic_bitset by @ref bits_per_block.
+         * @details    The blocks are copied if @p allocator is not equal to the allocator of @p other.
          *
-         * @param[in]  block  Block of bits to add
+         * @param[in]  other      @ref sul::dynamic_bitset to move
+         * @param[in]  allocator  Allocator to use for memory management
          *
-         * @complexity Amortized constant.
+         * @complexity Constant if @p allocator is equal to the allocator of @p other, linear in the
+         *             size of @p other otherwise.
          *
-         * @since      1.0.0
+         * @since      1.4.0
          */
-        constexpr void append(block_type block);
+        constexpr dynamic_bitset(dynamic_bitset<Block, Allocator>&& other, const allocator_type& allocator);
 
         /**
-         * @brief      Append blocks of bits from @p blocks at the end of the @ref sul::dynamic_bitset.
-         *
-         * @param[in]  blocks  Blocks of bits to add
+         * @brief      Copy assignment operator.
          *
-         * @complexity Linear in the size of @p blocks. Additional complexity possible due
-         *             to reallocation if capacity is less than @ref size() + @p blocks.size() * @ref
-         *             bits_per_block.
+         * @since      1.0.0
+         */
+        constexpr dynamic_bitset<Block, Allocator>& operator=(const dynamic_bitset<Block, Allocator>& other) = default;
+
+        /**
+         * @brief      Move assignment operator.
          *
          * @since      1.0.0
          */
-        constexpr void append(std::initializer_list<block_type> blocks);
+        constexpr dynamic_bitset<Block, Allocator>&
+        operator=(dynamic_bitset<Block, Allocator>&& other) noexcept = default;
 
         /**
-         * @brief      Append blocks of bits from the range \[@p first, @p last\[ at the end of the @ref
-         *             dynamic_bitset.
+         * @brief      Constructs an empty @ref sul::dynamic_bitset.
          *
-         * @param[in]  first               First iterator of the range
-         * @param[in]  last                Last iterator of the range (after the last element to add)
+         * @details    A copy of @p allocator will be used for memory management.
          *
-         * @tparam     BlockInputIterator  Type of the range iterators
+         * @param[in]  allocator  Allocator to use for memory management
          *
-         * @complexity Linear in the size of the range. Additional complexity possible due
-         *             to reallocation if capacity is less than @ref size() + std\::distance(@p first,
-         *             @p last) * @ref bits_per_block.
+         * @complexity Constant.
          *
          * @since      1.0.0
          */
-        template<typename BlockInputIterator>
-        constexpr void append(BlockInputIterator first, BlockInputIterator last);
+        constexpr explicit dynamic_bitset(const allocator_type& allocator = allocator_type());
 
         /**
-         * @brief      Sets the bits to the result of binary AND on corresponding pairs of bits of *this
-         *             and @p rhs.
-         *
-         * @param[in]  rhs   Right hand side @ref sul::dynamic_bitset of the operator
+         * @brief      Constructs a @ref sul::dynamic_bitset of @p nbits bits from an initial value.
          *
-         * @return     A reference to the @ref sul::dynamic_bitset *this
+         * @details    The first bits are initialized with the bits from @p init_val, if @p nbits \>
+         *             std\::numeric_limits\<unsigned long long\>\::digits , all other bits are
+         *             initialized to @a false. A copy of @p allocator will be used for memory
+         *             management.
          *
-         * @pre       @code
-         *             size() == rhs.size()
-         *             @endcode
+         * @param[in]  nbits      Number of bits of the @ref sul::dynamic_bitset
+         * @param[in]  init_val   Value to initialize the @ref sul::dynamic_bitset with
+         * @param[in]  allocator  Allocator to use for memory management
          *
-         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         * @complexity Linear in @p nbits / @ref bits_per_block.
          *
          * @since      1.0.0
          */
-        constexpr dynamic_bitset<Block, Allocator>& operator&=(const dynamic_bitset<Block, Allocator>& rhs);
+        constexpr explicit dynamic_bitset(size_type nbits,
+                                          unsigned long long init_val = 0,
+                                          const allocator_type& allocator = allocator_type());
 
         /**
-         * @brief      Sets the bits to the result of binary OR on corresponding pairs of bits of *this
-         *             and @p rhs.
-         *
-         * @param[in]  rhs   Right hand side @ref sul::dynamic_bitset of the operator
+         * @brief      Constructs a @ref sul::dynamic_bitset using @p init_vals to initialize the first
+         *             blocks.
          *
-         * @return     A reference to the @ref sul::dynamic_bitset *this
+         * @details    The size of the newly created @ref sul::dynamic_bitset is @p init_vals.size() *
+         *             @ref bits_per_block. A copy of @p allocator will be used for memory management.
          *
-         * @pre        @code
-         *             size() == rhs.size()
-         *             @endcode
+         * @param[in]  init_vals  Value of the @ref sul::dynamic_bitset first blocks
+         * @param[in]  allocator  Allocator to use for memory management
          *
-         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         * @complexity Linear in @p init_vals.size().
          *
          * @since      1.0.0
          */
-        constexpr dynamic_bitset<Block, Allocator>& operator|=(const dynamic_bitset<Block, Allocator>& rhs);
+        constexpr dynamic_bitset(std::initializer_list<block_type> init_vals,
+                                 const allocator_type& allocator = allocator_type());
 
         /**
-         * @brief      Sets the bits to the result of binary XOR on corresponding pairs of bits of *this
-         *             and @p rhs.
+         * @brief      Constructs a @ref sul::dynamic_bitset from a string or a part of a string.
          *
-         * @param[in]  rhs   Right hand side @ref sul::dynamic_bitset of the operator
+         * @details    Construct the @ref sul::dynamic_bitset using the characters from @p str in the
+         *             range \[@p pos, std\::min(@p pos + @p n, @p str.size())\[.
          *
-         * @return     A reference to the @ref sul::dynamic_bitset *this
+         * @param[in]  str        String containing the part to use
+         * @param[in]  pos        Starting position of the string part to use in @p str
+         * @param[in]  n          Number of characters of @p str to use from the starting position
+         * @param[in]  zero       Character used to represent @a false bits in @p str
+         * @param[in]  one        Character used to represent @a true bits in @p str
+         * @param[in]  allocator  Allocator to use for memory management
+         *
+         * @tparam     _CharT     Character type of the string
+         * @tparam     _Traits    Traits class specifying the operations on the character type of the
+         *                        string
          *
          * @pre        @code
-         *             size() == rhs.size()
+         *             pos < str.size()
          *             @endcode
          *
-         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         * @complexity Linear in std\::min(@p n, @p str.size() - @p pos).
          *
          * @since      1.0.0
          */
-        constexpr dynamic_bitset<Block, Allocator>& operator^=(const dynamic_bitset<Block, Allocator>& rhs);
+        template<typename _CharT, typename _Traits>
+        constexpr explicit dynamic_bitset(
+          std::basic_string_view<_CharT, _Traits> str,
+          typename std::basic_string_view<_CharT, _Traits>::size_type pos = 0,
+          typename std::basic_string_view<_CharT, _Traits>::size_type n = std::basic_string_view<_CharT, _Traits>::npos,
+          _CharT zero = _CharT('0'),
+          _CharT one = _CharT('1'),
+          const allocator_type& allocator = allocator_type());
 
         /**
-         * @brief      Sets the bits to the result of the binary difference between the bits of *this
-         *             and @p rhs.
+         * @brief      Constructs a @ref sul::dynamic_bitset from a string or a part of a string.
          *
-         * @details    Less efficient but equivalent way to get this result:
-         *             @code
-         *             this &= ~rhs;
-         *             @endcode
+         * @details    Construct the @ref sul::dynamic_bitset using the characters from @p str in the
+         *             range \[@p pos, std\::min(@p pos + @p n, @p str.size())\[.
          *
-         * @param[in]  rhs   Right hand side @ref sul::dynamic_bitset of the operator
+         * @param[in]  str        String containing the part to use
+         * @param[in]  pos        Starting position of the string part to use in @p str
+         * @param[in]  n          Number of characters of @p str to use from the starting position
+         * @param[in]  zero       Character used to represent @a false bits in @p str
+         * @param[in]  one        Character used to represent @a true bits in @p str
+         * @param[in]  allocator  Allocator to use for memory management
          *
-         * @return     A reference to the @ref sul::dynamic_bitset *this
+         * @tparam     _CharT     Character type of the string
+         * @tparam     _Traits    Traits class specifying the operations on the character type of the
+         *                        string
+         * @tparam     _Alloc     Allocator type used to allocate internal storage of the string
          *
          * @pre        @code
-         *             size() == rhs.size()
+         *             pos < str.size()
          *             @endcode
          *
-         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         * @complexity Linear in std\::min(@p n, @p str.size() - @p pos).
          *
          * @since      1.0.0
          */
-        constexpr dynamic_bitset<Block, Allocator>& operator-=(const dynamic_bitset<Block, Allocator>& rhs);
+        template<typename _CharT, typename _Traits, typename _Alloc>
+        constexpr explicit dynamic_bitset(const std::basic_string<_CharT, _Traits, _Alloc>& str,
+                                          typename std::basic_string<_CharT, _Traits, _Alloc>::size_type pos = 0,
+                                          typename std::basic_string<_CharT, _Traits, _Alloc>::size_type n =
+                                            std::basic_string<_CharT, _Traits, _Alloc>::npos,
+                                          _CharT zero = _CharT('0'),
+                                          _CharT one = _CharT('1'),
+                                          const allocator_type& allocator = allocator_type());
 
         /**
-         * @brief      Performs binary shift left of @p shift bits.
+         * @brief      Constructs a @ref sul::dynamic_bitset from a string or a part of a string.
          *
-         * @details    Zeroes are shifted in, does nothing if @p shift == 0.
+         * @details    Construct the @ref sul::dynamic_bitset using the characters from @p str in the
+         *             range \[@p pos, std\::min(@p pos + @p n, @p _Traits\::length(@p str))\[.
          *
-         * @param[in]  shift  Number of positions to shift the bits
+         * @param[in]  str        String containing the part to use
+         * @param[in]  pos        Starting position of the string part to use
+         * @param[in]  n          Number of characters to use from the starting position
+         * @param[in]  zero       Character used to represent @a false bits in the string
+         * @param[in]  one        Character used to represent 1 @a true bitsn the string
+         * @param[in]  allocator  Allocator to use for memory management
          *
-         * @return     A reference to the @ref sul::dynamic_bitset *this
+         * @tparam     _CharT     Character type of the string
+         * @tparam     _Traits    Traits class specifying the operations on the character type of the
+         *                        string
          *
-         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         * @pre        @code
+         *             pos < _Traits::length(str)
+         *             @endcode
+         *
+         * @complexity Linear in std\::min(@p n, @p _Traits\::length(@p str) - @p pos).
          *
          * @since      1.0.0
          */
-        constexpr dynamic_bitset<Block, Allocator>& operator<<=(size_type shift);
+        template<typename _CharT, typename _Traits = std::char_traits<_CharT>>
+        constexpr explicit dynamic_bitset(
+          const _CharT* str,
+          typename std::basic_string<_CharT>::size_type pos = 0,
+          typename std::basic_string<_CharT>::size_type n = std::basic_string<_CharT>::npos,
+          _CharT zero = _CharT('0'),
+          _CharT one = _CharT('1'),
+          const allocator_type& allocator = allocator_type());
 
         /**
-         * @brief      Performs binary shift right of @p shift bits.
+         * @brief      Constructs a @ref sul::dynamic_bitset of @p N bits from a std\::bitset.
          *
-         * @details    Zeroes are shifted in, does nothing if @p shift == 0.
+         * @details    The bit at position i of the @ref sul::dynamic_bitset is the bit at position i of
+         *             @p bitset. The words of @p bitset are copied whole when the layout of std\::bitset
+         *             is known. A copy of @p allocator will be used for memory management.
          *
-         * @param[in]  shift  Number of positions to shift the bits
+         * @param[in]  bitset     std\::bitset to copy the bits from
+         * @param[in]  allocator  Allocator to use for memory management
          *
-         * @return     A reference to the @ref sul::dynamic_bitset *this
+         * @tparam     N          Number of bits of @p bitset
          *
-         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         * @complexity Linear in @p N / @ref bits_per_block if the layout of std\::bitset is known, linear
+         *             in @p N otherwise.
          *
-         * @since      1.0.0
+         * @since      1.4.0
          */
-        constexpr dynamic_bitset<Block, Allocator>& operator>>=(size_type shift);
+        template<size_t N>
+        constexpr explicit dynamic_bitset(const std::bitset<N>& bitset,
+                                          const allocator_type& allocator = allocator_type());
 
         /**
-         * @brief      Performs binary shift right of @p shift bits.
+         * @brief      Constructs a @ref sul::dynamic_bitset from a std\::vector\<bool\>.
          *
-         * @details    Zeroes are shifted in. Does nothing if @p shift == 0.\n
-         *             Equivalent to:
-         *             @code
-         *             dynamic_bitset<Block, Allocator> bitset(*this);
-         *             bitset <<= shift;
-         *             @endcode
+         * @details    The bit at position i of the @ref sul::dynamic_bitset is the element i of @p
+         *             vector. The words of @p vector are copied whole with libstdc++. A copy of @p
+         *             allocator will be used for memory management.
          *
-         * @param[in]  shift  Number of positions to shift the bits
+         * @param[in]  vector     std\::vector\<bool\> to copy the bits from
+         * @param[in]  allocator  Allocator to use for memory management
          *
-         * @return     A new @ref sul::dynamic_bitset containing the shifted bits
+         * @tparam     _Alloc     Allocator type of @p vector
          *
-         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         * @complexity Linear in @p vector.size() / @ref bits_per_block with libstdc++, linear in @p
+         *             vector.size() otherwise.
          *
-         * @since      1.0.0
+         * @since      1.4.0
          */
-        [[nodiscard]] constexpr dynamic_bitset<Block, Allocator> operator<<(size_type shift) const;
+        template<typename _Alloc>
+        constexpr explicit dynamic_bitset(const std::vector<bool, _Alloc>& vector,
+                                          const allocator_type& allocator = allocator_type());
 
         /**
-         * @brief      Performs binary shift left of @p shift bits.
+         * @brief      Destructor.
          *
-         * @details    Zeroes are shifted in. Does nothing if @p shift == 0.\n
-         *             Equivalent to:
-         *             @code
-         *             dynamic_bitset<Block, Allocator> bitset(*this);
-         *             bitset >>= shift;
-         *             @endcode
+         * @since      1.0.0
+         */
+        ~dynamic_bitset() noexcept = default;
+
+        /**
+         * @brief      Resize the @ref sul::dynamic_bitset to contain @p nbits bits.
          *
-         * @param[in]  shift  Number of positions to shift the bits
+         * @details    Bits keep the value they had before the resize and, if @p nbits is greater than
+         *             the current size, new bit are initialized to @p value.
          *
-         * @return     A new @ref sul::dynamic_bitset containing the shifted bits
+         * @param[in]  nbits  New size of the @ref sul::dynamic_bitset
+         * @param[in]  value  Value of the new bits
          *
-         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         * @complexity Linear in the difference between the current size and @p nbits.
+         *             Additional complexity possible due to reallocation if capacity is less than @p
+         *             nbits.
          *
          * @since      1.0.0
          */
-        [[nodiscard]] constexpr dynamic_bitset<Block, Allocator> operator>>(size_type shift) const;
+        constexpr void resize(size_type nbits, bool value = false);
 
         /**
-         * @brief      Performs a unary NOT on all bits.
+         * @brief      Resize the @ref sul::dynamic_bitset to contain @p nbits bits, leaving the value of
+         *             the new bits unspecified.
+         *
+         * @details    Bits keep the value they had before the resize, the new bits are meant to be
+         *             overwritten, for example through @ref data(), before being read. Only the bits
+         *             past the end of the @ref sul::dynamic_bitset in the last block are reset to 0s,
+         *             with an allocator default-initializing the blocks, such as @ref
+         *             sul::default_init_allocator, the new blocks are not written otherwise. With other
+         *             allocators, the new blocks are zeroed as by @ref resize().
+         *
+         * @param[in]  nbits  New size of the @ref sul::dynamic_bitset
+         *
+         * @post       The new bits must be written before being read, the bits past the end of the
+         *             @ref sul::dynamic_bitset in the last block must be kept to 0s.
+         *
+         * @complexity Constant with an allocator default-initializing the blocks, linear in the
+         *             difference between the current size and @p nbits otherwise. Additional
+         *             complexity possible due to reallocation if capacity is less than @p nbits.
+         *
+         * @since      1.4.0
+         */
+        constexpr void resize_for_overwrite(size_type nbits);
+
+        /**
+         * @brief      Clears the @ref sul::dynamic_bitset, resize it to 0.
          *
          * @details    Equivalent to:
          *             @code
-         *             dynamic_bitset<Block, Allocator> bitset(*this);
-         *             bitset.flip();
+         *             this.resize(0);
          *             @endcode
          *
-         * @return     A copy of *this with all bits flipped
-         *
          * @complexity Linear in the size of the @ref sul::dynamic_bitset.
          *
          * @since      1.0.0
          */
-        [[nodiscard]] constexpr dynamic_bitset<Block, Allocator> operator~() const;
+        constexpr void clear();
 
         /**
-         * @brief      Set the bits of the range \[@p pos, @p pos + @p len\[ to value @p value.
+         * @brief      Add a new bit with the value @p value at the end of the @ref sul::dynamic_bitset.
          *
-         * @details    Does nothing if @p len == 0.
+         * @details    Increase the size of the bitset by one, the added bit becomes the
+         *             most-significant bit.
          *
-         * @param[in]  pos    Position of the first bit of the range
-         * @param[in]  len    Length of the range
-         * @param[in]  value  Value to set the bits to
+         * @param[in]  value  Value of the bit to add
          *
-         * @return     A reference to the @ref sul::dynamic_bitset *this
+         * @complexity Amortized constant.
          *
-         * @pre        @code
-         *             (len == 0 && pos <= size()) || (pos < size() && pos + len - 1 < size())
-         *             @endcode
+         * @since      1.0.0
+         */
+        constexpr void push_back(bool value);
+
+        /**
+         * @brief      Remove the last bit of the @ref sul::dynamic_bitset.
          *
-         * @complexity Linear in @p len.
+         * @details    Decrease the size of the @ref sul::dynamic_bitset by one, does nothing if the
+         *             @ref dynamic_bitset is empty.
+         *
+         * @complexity Constant.
          *
          * @since      1.0.0
          */
-        constexpr dynamic_bitset<Block, Allocator>& set(size_type pos, size_type len, bool value);
+        constexpr void pop_back();
 
         /**
-         * @brief      Set the bit at the position @p pos to @a true or value @p value.
-         *
-         * @param[in]  pos    Position of the bit to set
-         * @param[in]  value  Value to set the bit to
+         * @brief      Append a block of bits @p block at the end of the @ref sul::dynamic_bitset.
          *
-         * @return     A reference to the @ref sul::dynamic_bitset *this
+         * @details    Increase the size of the @ref sul::dynamic_bitset by @ref bits_per_block.
          *
-         * @pre        @code
-         *             pos < size()
-         *             @endcode
+         * @param[in]  block  Block of bits to add
          *
-         * @complexity Constant.
+         * @complexity Amortized constant.
          *
          * @since      1.0.0
          */
-        constexpr dynamic_bitset<Block, Allocator>& set(size_type pos, bool value = true);
+        constexpr void append(block_type block);
 
         /**
-         * @brief      Set all the bits of the @ref sul::dynamic_bitset to @a true.
+         * @brief      Append blocks of bits from @p blocks at the end of the @ref sul::dynamic_bitset.
          *
-         * @return     A reference to the @ref sul::dynamic_bitset *this
+         * @param[in]  blocks  Blocks of bits to add
          *
-         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         * @complexity Linear in the size of @p blocks. Additional complexity possible due
+         *             to reallocation if capacity is less than @ref size() + @p blocks.size() * @ref
+         *             bits_per_block.
          *
          * @since      1.0.0
          */
-        constexpr dynamic_bitset<Block, Allocator>& set();
+        constexpr void append(std::initializer_list<block_type> blocks);
 
         /**
-         * @brief      Reset the bits of the range \[@p pos, @p pos + @p len\[ to @a false.
-         *
-         * @param[in]  pos   Position of the first bit of the range
-         * @param[in]  len   Length of the range
+         * @brief      Append blocks of bits from the range \[@p first, @p last\[ at the end of the @ref
+         *             dynamic_bitset.
          *
-         * @return     A reference to the @ref sul::dynamic_bitset *this
+         * @param[in]  first               First iterator of the range
+         * @param[in]  last                Last iterator of the range (after the last element to add)
          *
-         * @pre        @code
-         *             (len == 0 && pos <= size()) || (pos < size() && pos + len - 1 < size())
-         *             @endcode
+         * @tparam     BlockInputIterator  Type of the range iterators
          *
-         * @complexity Linear in @p len.
+         * @complexity Linear in the size of the range. Additional complexity possible due
+         *             to reallocation if capacity is less than @ref size() + std\::distance(@p first,
+         *             @p last) * @ref bits_per_block.
          *
          * @since      1.0.0
          */
-        constexpr dynamic_bitset<Block, Allocator>& reset(size_type pos, size_type len);
+        template<typename BlockInputIterator>
+        constexpr void append(BlockInputIterator first, BlockInputIterator last);
 
         /**
-         * @brief      Reset the bit at the position @p pos to @a false.
-         *
-         * @param[in]  pos    Position of the bit to reset
+         * @brief      Append the bits of @p bitset at the end of the @ref sul::dynamic_bitset.
          *
-         * @return     A reference to the @ref sul::dynamic_bitset *this
+         * @details    Increase the size of the @ref sul::dynamic_bitset by @p bitset.size(). The
+         *             storage is reserved once and the blocks of @p bitset are shifted and merged at
+         *             the current end of the @ref sul::dynamic_bitset. @p bitset can be *this.
          *
-         * @pre        @code
-         *             pos < size()
-         *             @endcode
+         * @param[in]  bitset  @ref sul::dynamic_bitset which bits are added
          *
-         * @complexity Constant.
+         * @complexity Linear in the number of blocks of @p bitset. Additional complexity possible
+         *             due to reallocation if capacity is less than @ref size() + @p bitset.size().
          *
-         * @since      1.0.0
+         * @since      1.4.0
          */
-        constexpr dynamic_bitset<Block, Allocator>& reset(size_type pos);
+        constexpr void append(const dynamic_bitset<Block, Allocator>& bitset);
 
         /**
-         * @brief      Reset all the bits of the @ref sul::dynamic_bitset to @a false.
+         * @brief      Append the bits of @p bitset at the end of the @ref sul::dynamic_bitset.
          *
-         * @return     A reference to the @ref sul::dynamic_bitset *this
+         * @details    Same as @ref append(const dynamic_bitset<Block, Allocator>&), but if the @ref
+         *             sul::dynamic_bitset is empty, the storage of @p bitset is moved instead of
+         *             copying its blocks.
          *
-         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         * @param      bitset  @ref sul::dynamic_bitset which bits are added, left in a valid but
+         *                     unspecified state
          *
-         * @since      1.0.0
+         * @complexity Constant if the @ref sul::dynamic_bitset is empty and the storage can be
+         *             moved, same as @ref append(const dynamic_bitset<Block, Allocator>&) otherwise.
+         *
+         * @since      1.4.0
          */
-        constexpr dynamic_bitset<Block, Allocator>& reset();
+        constexpr void append(dynamic_bitset<Block, Allocator>&& bitset);
 
         /**
-         * @brief      Flip the bits of the range \[@p pos, @p pos + @p len\[.
+         * @brief      Insert @p len bits of value @p value at position @p pos.
          *
-         * @param[in]  pos   Position of the first bit of the range
-         * @param[in]  len   Length of the range
+         * @details    Increase the size of the @ref sul::dynamic_bitset by @p len, the bits at
+         *             positions greater than or equal to @p pos are moved by @p len positions. The
+         *             moved bits are shifted block by block in place, the bits before @p pos are not
+         *             accessed.
          *
-         * @return     A reference to the @ref sul::dynamic_bitset *this
+         * @param[in]  pos    Position of the first bit inserted
+         * @param[in]  len    Number of bits to insert
+         * @param[in]  value  Value of the bits inserted
          *
          * @pre        @code
-         *             (len == 0 && pos <= size()) || (pos < size() && pos + len - 1 < size())
+         *             pos <= size()
          *             @endcode
          *
-         * @complexity Linear in @p len.
+         * @complexity Linear in the number of blocks after @p pos plus @p len. Additional complexity
+         *             possible due to reallocation if capacity is less than @ref size() + @p len.
          *
-         * @since      1.0.0
+         * @since      1.4.0
          */
-        constexpr dynamic_bitset<Block, Allocator>& flip(size_type pos, size_type len);
+        constexpr void insert(size_type pos, size_type len, bool value = false);
 
         /**
-         * @brief      Flip the bit at the position @p pos.
+         * @brief      Erase the @p len bits starting at position @p pos.
          *
-         * @param[in]  pos    Position of the bit to reset
+         * @details    Decrease the size of the @ref sul::dynamic_bitset by @p len, the bits at
+         *             positions greater than or equal to @p pos + @p len are moved by @p len positions.
+         *             The moved bits are shifted block by block in place, the bits before @p pos are
+         *             not accessed.
          *
-         * @return     A reference to the @ref sul::dynamic_bitset *this
+         * @param[in]  pos   Position of the first bit erased
+         * @param[in]  len   Number of bits to erase
          *
          * @pre        @code
-         *             pos < size()
+         *             pos <= size() && len <= size() - pos
          *             @endcode
          *
-         * @complexity Constant.
+         * @complexity Linear in the number of blocks after @p pos.
          *
-         * @since      1.0.0
+         * @since      1.4.0
          */
-        constexpr dynamic_bitset<Block, Allocator>& flip(size_type pos);
+        constexpr void erase(size_type pos, size_type len);
 
         /**
-         * @brief      Flip all the bits of the @ref sul::dynamic_bitset.
+         * @brief      Sets the bits to the result of binary AND on corresponding pairs of bits of *this
+         *             and @p rhs.
+         *
+         * @param[in]  rhs   Right hand side @ref sul::dynamic_bitset of the operator
          *
          * @return     A reference to the @ref sul::dynamic_bitset *this
          *
+         * @pre       @code
+         *             size() == rhs.size()
+         *             @endcode
+         *
          * @complexity Linear in the size of the @ref sul::dynamic_bitset.
          *
          * @since      1.0.0
          */
-        constexpr dynamic_bitset<Block, Allocator>& flip();
+        constexpr dynamic_bitset<Block, Allocator>& operator&=(const dynamic_bitset<Block, Allocator>& rhs);
 
         /**
-         * @brief      Test the value of the bit at position @p pos.
+         * @brief      Sets the bits to the result of binary OR on corresponding pairs of bits of *this
+         *             and @p rhs.
          *
-         * @param[in]  pos   Position of the bit to test
+         * @param[in]  rhs   Right hand side @ref sul::dynamic_bitset of the operator
          *
-         * @return     The tested bit value
+         * @return     A reference to the @ref sul::dynamic_bitset *this
          *
          * @pre        @code
-         *             pos < size()
+         *             size() == rhs.size()
          *             @endcode
          *
-         * @complexity Constant.
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
          *
          * @since      1.0.0
          */
-        [[nodiscard]] constexpr bool test(size_type pos) const;
+        constexpr dynamic_bitset<Block, Allocator>& operator|=(const dynamic_bitset<Block, Allocator>& rhs);
 
         /**
-         * @brief      Test the value of the bit at position @p pos and set it to @a true or value @p
-         *             value.
+         * @brief      Sets the bits to the result of binary XOR on corresponding pairs of bits of *this
+         *             and @p rhs.
          *
-         * @param[in]  pos    Position of the bit to test and set
-         * @param[in]  value  Value to set the bit to
+         * @param[in]  rhs   Right hand side @ref sul::dynamic_bitset of the operator
          *
-         * @return     The tested bit value
+         * @return     A reference to the @ref sul::dynamic_bitset *this
          *
          * @pre        @code
-         *             pos < size()
+         *             size() == rhs.size()
          *             @endcode
          *
-         * @complexity Constant.
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
          *
          * @since      1.0.0
          */
-        [[nodiscard]] constexpr bool test_set(size_type pos, bool value = true);
+        constexpr dynamic_bitset<Block, Allocator>& operator^=(const dynamic_bitset<Block, Allocator>& rhs);
 
         /**
-         * @brief      Checks if all bits are set to @a true.
+         * @brief      Sets the bits to the result of the binary difference between the bits of *this
+         *             and @p rhs.
          *
-         * @return     @a true if all bits are set to @a true, otherwise @a false
+         * @details    Less efficient but equivalent way to get this result:
+         *             @code
+         *             this &= ~rhs;
+         *             @endcode
          *
-         * @remark     Return @a true if the @ref sul::dynamic_bitset is empty, the logic is that you
-         *             are checking if all bits are set to @a true, meaning none of them is set to @a
-         *             false, and in an empty @ref sul::dynamic_bitset no bits are set to @a false.
+         * @param[in]  rhs   Right hand side @ref sul::dynamic_bitset of the operator
+         *
+         * @return     A reference to the @ref sul::dynamic_bitset *this
+         *
+         * @pre        @code
+         *             size() == rhs.size()
+         *             @endcode
          *
          * @complexity Linear in the size of the @ref sul::dynamic_bitset.
          *
          * @since      1.0.0
          */
-        [[nodiscard]] constexpr bool all() const;
+        constexpr dynamic_bitset<Block, Allocator>& operator-=(const dynamic_bitset<Block, Allocator>& rhs);
 
         /**
-         * @brief      Checks if any bits are set to @a true.
+         * @brief      Performs binary shift left of @p shift bits.
          *
-         * @return     @a true if any of the bits is set to @a true, otherwise @a false
+         * @details    Zeroes are shifted in, does nothing if @p shift == 0.
          *
-         * @remark     Return @a false if the @ref sul::dynamic_bitset is empty, the logic is you are
-         *             checking if there is at least one bit set to @a true and in an empty @ref
-         *             dynamic_bitset there is no bit set to @a true.
+         * @param[in]  shift  Number of positions to shift the bits
+         *
+         * @return     A reference to the @ref sul::dynamic_bitset *this
          *
          * @complexity Linear in the size of the @ref sul::dynamic_bitset.
          *
          * @since      1.0.0
          */
-        [[nodiscard]] constexpr bool any() const;
+        constexpr dynamic_bitset<Block, Allocator>& operator<<=(size_type shift);
 
         /**
-         * @brief      Checks if none of the bits are set to @a true.
+         * @brief      Performs binary shift right of @p shift bits.
          *
-         * @return     @a true if none of the bits is set to @a true, otherwise @a false
+         * @details    Zeroes are shifted in, does nothing if @p shift == 0.
          *
-         * @remark     Return @a true if the @ref sul::dynamic_bitset is empty, the logic is that you
-         *             are checking if there is no bit set to @a true and in an empty @ref
-         *             sul::dynamic_bitset there is no bit that can be set to @a true.
+         * @param[in]  shift  Number of positions to shift the bits
+         *
+         * @return     A reference to the @ref sul::dynamic_bitset *this
          *
          * @complexity Linear in the size of the @ref sul::dynamic_bitset.
          *
          * @since      1.0.0
          */
-        [[nodiscard]] constexpr bool none() const;
+        constexpr dynamic_bitset<Block, Allocator>& operator>>=(size_type shift);
 
         /**
-         * @brief      Count the number of bits set to @a true.
+         * @brief      Performs binary shift right of @p shift bits.
          *
-         * @details    Return 0 if the @ref sul::dynamic_bitset is empty.
+         * @details    Zeroes are shifted in. Does nothing if @p shift == 0.\n
+         *             Equivalent to:
+         *             @code
+         *             dynamic_bitset<Block, Allocator> bitset(*this, temporary_allocator(get_allocator()));
+         *             bitset <<= shift;
+         *             @endcode
+         *             where @a temporary_allocator() gives the allocator of a copy of *this, except for @a
+         *             std::pmr::polymorphic_allocator which keeps the memory resource of *this.
          *
-         * @return     The number of bits that are set to @a true
+         * @param[in]  shift  Number of positions to shift the bits
+         *
+         * @return     A new @ref sul::dynamic_bitset containing the shifted bits
          *
          * @complexity Linear in the size of the @ref sul::dynamic_bitset.
          *
          * @since      1.0.0
          */
-        [[nodiscard]] constexpr size_type count() const noexcept;
+        [[nodiscard]] constexpr dynamic_bitset<Block, Allocator> operator<<(size_type shift) const;
 
         /**
-         * @brief      Accesses the bit at position @p pos.
+         * @brief      Performs binary shift left of @p shift bits.
          *
-         * @param[in]  pos   Position of the bit to access
+         * @details    Zeroes are shifted in. Does nothing if @p shift == 0.\n
+         *             Equivalent to:
+         *             @code
+         *             dynamic_bitset<Block, Allocator> bitset(*this, temporary_allocator(get_allocator()));
+         *             bitset >>= shift;
+         *             @endcode
+         *             where @a temporary_allocator() gives the allocator of a copy of *this, except for @a
+         *             std::pmr::polymorphic_allocator which keeps the memory resource of *this.
          *
-         * @return     A @ref reference object which allows writing to the requested bit
+         * @param[in]  shift  Number of positions to shift the bits
          *
-         * @pre        @code
-         *             pos < size()
+         * @return     A new @ref sul::dynamic_bitset containing the shifted bits
+         *
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         *
+         * @since      1.0.0
+         */
+        [[nodiscard]] constexpr dynamic_bitset<Block, Allocator> operator>>(size_type shift) const;
+
+        /**
+         * @brief      Performs a unary NOT on all bits.
+         *
+         * @details    Equivalent to:
+         *             @code
+         *             dynamic_bitset<Block, Allocator> bitset(*this, temporary_allocator(get_allocator()));
+         *             bitset.flip();
          *             @endcode
+         *             where @a temporary_allocator() gives the allocator of a copy of *this, except for @a
+         *             std::pmr::polymorphic_allocator which keeps the memory resource of *this.
          *
-         * @complexity Constant.
+         * @return     A copy of *this with all bits flipped
+         *
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
          *
          * @since      1.0.0
          */
-        [[nodiscard]] constexpr reference operator[](size_type pos);
+        [[nodiscard]] constexpr dynamic_bitset<Block, Allocator> operator~() const;
 
         /**
-         * @brief      Accesses the bit at position @p pos.
+         * @brief      Set the bits of the range \[@p pos, @p pos + @p len\[ to value @p value.
          *
-         * @param[in]  pos   Position of the bit to access
+         * @details    Does nothing if @p len == 0.
          *
-         * @return     The value of the requested bit
+         * @param[in]  pos    Position of the first bit of the range
+         * @param[in]  len    Length of the range
+         * @param[in]  value  Value to set the bits to
+         *
+         * @return     A reference to the @ref sul::dynamic_bitset *this
          *
          * @pre        @code
-         *             pos < size()
+         *             (len == 0 && pos <= size()) || (pos < size() && pos + len - 1 < size())
          *             @endcode
          *
-         * @complexity Constant.
+         * @complexity Linear in @p len.
          *
          * @since      1.0.0
          */
-        [[nodiscard]] constexpr const_reference operator[](size_type pos) const;
+        constexpr dynamic_bitset<Block, Allocator>& set(size_type pos, size_type len, bool value);
 
         /**
-         * @brief      Give the number of bits of the @ref sul::dynamic_bitset.
+         * @brief      Set the bit at the position @p pos to @a true or value @p value.
          *
-         * @return     The number of bits of the @ref sul::dynamic_bitset
+         * @param[in]  pos    Position of the bit to set
+         * @param[in]  value  Value to set the bit to
+         *
+         * @return     A reference to the @ref sul::dynamic_bitset *this
+         *
+         * @pre        @code
+         *             pos < size()
+         *             @endcode
          *
          * @complexity Constant.
          *
          * @since      1.0.0
          */
-        [[nodiscard]] constexpr size_type size() const noexcept;
+        constexpr dynamic_bitset<Block, Allocator>& set(size_type pos, bool value = true);
 
         /**
-         * @brief      Give the number of blocks used by the @ref sul::dynamic_bitset.
+         * @brief      Set all the bits of the @ref sul::dynamic_bitset to @a true.
          *
-         * @return     The number of blocks used by the @ref sul::dynamic_bitset
+         * @return     A reference to the @ref sul::dynamic_bitset *this
          *
-         * @complexity Constant.
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
          *
          * @since      1.0.0
          */
-        [[nodiscard]] constexpr size_type num_blocks() const noexcept;
+        constexpr dynamic_bitset<Block, Allocator>& set();
 
         /**
-         * @brief      Checks if the @ref sul::dynamic_bitset is empty.
+         * @brief      Reset the bits of the range \[@p pos, @p pos + @p len\[ to @a false.
          *
-         * @details    Equivalent to:
-         *             @code
-         *             size() == 0;
-         *             @endcode
+         * @param[in]  pos   Position of the first bit of the range
+         * @param[in]  len   Length of the range
          *
-         * @return     @a true if the @ref sul::dynamic_bitset is empty, @a false otherwise
+         * @return     A reference to the @ref sul::dynamic_bitset *this
          *
-         * @complexity Constant.
+         * @pre        @code
+         *             (len == 0 && pos <= size()) || (pos < size() && pos + len - 1 < size())
+         *             @endcode
+         *
+         * @complexity Linear in @p len.
          *
          * @since      1.0.0
          */
-        [[nodiscard]] constexpr bool empty() const noexcept;
+        constexpr dynamic_bitset<Block, Allocator>& reset(size_type pos, size_type len);
 
         /**
-         * @brief      Give the number of bits that the @ref sul::dynamic_bitset has currently allocated
-         *             space for.
+         * @brief      Reset the bit at the position @p pos to @a false.
          *
-         * @return     Capacity of the currently allocated storage.
+         * @param[in]  pos    Position of the bit to reset
+         *
+         * @return     A reference to the @ref sul::dynamic_bitset *this
+         *
+         * @pre        @code
+         *             pos < size()
+         *             @endcode
          *
          * @complexity Constant.
          *
          * @since      1.0.0
          */
-        [[nodiscard]] constexpr size_type capacity() const noexcept;
+        constexpr dynamic_bitset<Block, Allocator>& reset(size_type pos);
 
         /**
-         * @brief      Increase the capacity of the @ref sul::dynamic_bitset to a value that's greater
-         *             or equal to @p num_bits.
-         *
-         * @details    If @p num_bits is greater than the current capacity, new storage is allocated and
-         *             all @ref reference on bits of the @ref sul::dynamic_bitset are invalidated,
-         *             otherwise the method does nothing.
+         * @brief      Reset all the bits of the @ref sul::dynamic_bitset to @a false.
          *
-         * @param[in]  num_bits  New capacity of the @ref sul::dynamic_bitset
+         * @return     A reference to the @ref sul::dynamic_bitset *this
          *
-         * @complexity At most linear in the size of the @ref sul::dynamic_bitset.
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
          *
          * @since      1.0.0
          */
-        constexpr void reserve(size_type num_bits);
+        constexpr dynamic_bitset<Block, Allocator>& reset();
 
         /**
-         * @brief      Requests the removal of unused capacity.
+         * @brief      Flip the bits of the range \[@p pos, @p pos + @p len\[.
          *
-         * @details    It is a non-binding request to reduce the capacity to the size. It depends on the
-         *             implementation of std\::vector whether the request is fulfilled.\n If
-         *             reallocation occurs, all @ref reference on bits of the @ref sul::dynamic_bitset
-         *             are invalidated.
+         * @param[in]  pos   Position of the first bit of the range
+         * @param[in]  len   Length of the range
          *
-         * @complexity At most linear in the size of the @ref sul::dynamic_bitset.
+         * @return     A reference to the @ref sul::dynamic_bitset *this
+         *
+         * @pre        @code
+         *             (len == 0 && pos <= size()) || (pos < size() && pos + len - 1 < size())
+         *             @endcode
+         *
+         * @complexity Linear in @p len.
          *
          * @since      1.0.0
          */
-        constexpr void shrink_to_fit();
+        constexpr dynamic_bitset<Block, Allocator>& flip(size_type pos, size_type len);
 
         /**
-         * @brief      Determines if this @ref sul::dynamic_bitset is a subset of @p bitset.
-         *
-         * @details    This @ref sul::dynamic_bitset is a subset of @p bitset if, for every bit that is
-         *             set in this @ref sul::dynamic_bitset, the corresponding bit in @p bitset a is
-         *             also set.\n\n Less efficient but equivalent way to get this result:
-         *             @code
-         *             res = (this & ~bitset).none();
-         *             @endcode
-         *
-         * @param[in]  bitset  The @ref sul::dynamic_bitset for which to check if this @ref
-         *                     sul::dynamic_bitset is a subset
+         * @brief      Flip the bit at the position @p pos.
          *
-         * @return     @a true if this @ref sul::dynamic_bitset is a subset of @p bitset, @a false
-         *             otherwise
+         * @param[in]  pos    Position of the bit to reset
          *
-         * @remark     The relation "is a subset of" is not symmetric (A being a subset of B doesn't
-         *             imply that B is a subset of A) but is antisymmetric (if A is a subset of B and B
-         *             is a subset of A, then A == B).
+         * @return     A reference to the @ref sul::dynamic_bitset *this
          *
          * @pre        @code
-         *             size() == bitset.size()
+         *             pos < size()
          *             @endcode
          *
-         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         * @complexity Constant.
          *
          * @since      1.0.0
          */
-        [[nodiscard]] constexpr bool is_subset_of(const dynamic_bitset<Block, Allocator>& bitset) const;
+        constexpr dynamic_bitset<Block, Allocator>& flip(size_type pos);
 
         /**
-         * @brief      Determines if this @ref sul::dynamic_bitset is a proper subset of @p bitset.
+         * @brief      Flip all the bits of the @ref sul::dynamic_bitset.
          *
-         * @details    This @ref sul::dynamic_bitset is a proper subset of @p bitset if, for every bit
-         *             that is set in this @ref sul::dynamic_bitset, the corresponding bit in @p bitset
-         *             a is also set and if this @ref sul::dynamic_bitset is different from @p
-         *             bitset.\n\n Less efficient but equivalent way to get this result:
-         *             @code
-         *             res = ((this != bitset) && (this & ~bitset).none());
-         *             @endcode
+         * @return     A reference to the @ref sul::dynamic_bitset *this
          *
-         * @param[in]  bitset  The @ref sul::dynamic_bitset for which to check if this @ref
-         *                     sul::dynamic_bitset is a proper subset
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
          *
-         * @return     @a true if this @ref sul::dynamic_bitset is a proper subset of @p bitset, @a
-         *             false otherwise
+         * @since      1.0.0
+         */
+        constexpr dynamic_bitset<Block, Allocator>& flip();
+
+        /**
+         * @brief      Test the value of the bit at position @p pos.
          *
-         * @remark     The relation "is a proper subset of" is asymmetric (A being a proper subset of B
-         *             imply that B is not a proper subset of A).
+         * @param[in]  pos   Position of the bit to test
+         *
+         * @return     The tested bit value
          *
          * @pre        @code
-         *             size() == bitset.size()
+         *             pos < size()
          *             @endcode
          *
-         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         * @complexity Constant.
          *
          * @since      1.0.0
          */
-        [[nodiscard]] constexpr bool is_proper_subset_of(const dynamic_bitset<Block, Allocator>& bitset) const;
+        [[nodiscard]] constexpr bool test(size_type pos) const;
 
         /**
-         * @brief      Determines if this @ref sul::dynamic_bitset and @p bitset intersect.
-         *
-         * @details    This @ref sul::dynamic_bitset intersects with @p bitset if for at least one bit
-         *             set in this @ref sul::dynamic_bitset, the corresponding bit in @p bitset a is
-         *             also set. In other words two bitsets intersect if they have at least one bit set
-         *             in common.\n\n Less efficient but equivalent way to get this result:
-         *             @code
-         *             res = (this & bitset).any();
-         *             @endcode
+         * @brief      Test the value of the bit at position @p pos and set it to @a true or value @p
+         *             value.
          *
-         * @param[in]  bitset  The @ref sul::dynamic_bitset for which to check if this @ref
-         *                     sul::dynamic_bitset intersects
+         * @param[in]  pos    Position of the bit to test and set
+         * @param[in]  value  Value to set the bit to
          *
-         * @return     @a true if this @ref sul::dynamic_bitset intersects with @p bitset, @a false
-         *             otherwise
+         * @return     The tested bit value
          *
          * @pre        @code
-         *             size() == bitset.size()
+         *             pos < size()
          *             @endcode
          *
-         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         * @complexity Constant.
          *
          * @since      1.0.0
          */
-        [[nodiscard]] constexpr bool intersects(const dynamic_bitset<Block, Allocator>& bitset) const;
+        [[nodiscard]] constexpr bool test_set(size_type pos, bool value = true);
 
         /**
-         * @brief      Find the position of the first bit set in the @ref sul::dynamic_bitset starting
-         *             from the least-significant bit.
+         * @brief      Checks if all bits are set to @a true.
          *
-         * @details    Give the lowest index of the @ref sul::dynamic_bitset with a bit set, or @ref
-         *             npos if no bits are set.
+         * @return     @a true if all bits are set to @a true, otherwise @a false
          *
-         * @return     The position of the first bit set, or @ref npos if no bits are set
+         * @remark     Return @a true if the @ref sul::dynamic_bitset is empty, the logic is that you
+         *             are checking if all bits are set to @a true, meaning none of them is set to @a
+         *             false, and in an empty @ref sul::dynamic_bitset no bits are set to @a false.
          *
          * @complexity Linear in the size of the @ref sul::dynamic_bitset.
          *
          * @since      1.0.0
          */
-        [[nodiscard]] constexpr size_type find_first() const;
+        [[nodiscard]] constexpr bool all() const;
 
         /**
-         * @brief      Find the position of the first bit set in the range \[@p prev + 1, @ref size()\[
-         *             of the @ref sul::dynamic_bitset starting from the position @p prev + 1.
-         *
-         * @details    Give the lowest index superior to @p prev of the @ref sul::dynamic_bitset with a
-         *             bit set, or @ref npos if no bits are set after the index @p prev.\n If @p prev +
-         *             1 \>= @ref size(), return @ref npos.
+         * @brief      Checks if any bits are set to @a true.
          *
-         * @param[in]  prev  Position of the bit preceding the search range
+         * @return     @a true if any of the bits is set to @a true, otherwise @a false
          *
-         * @return     The position of the first bit set after @p prev, or @ref npos if no bits are set
-         *             after @p prev
+         * @remark     Return @a false if the @ref sul::dynamic_bitset is empty, the logic is you are
+         *             checking if there is at least one bit set to @a true and in an empty @ref
+         *             dynamic_bitset there is no bit set to @a true.
          *
-         * @complexity Linear in @ref size() - @p prev.
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
          *
          * @since      1.0.0
          */
-        [[nodiscard]] constexpr size_type find_next(size_type prev) const;
+        [[nodiscard]] constexpr bool any() const;
 
         /**
-         * @brief      Exchanges the bits of this @ref sul::dynamic_bitset with those of @p other.
+         * @brief      Checks if none of the bits are set to @a true.
          *
-         * @details    All @ref reference on bits of the @ref sul::dynamic_bitset are invalidated.
+         * @return     @a true if none of the bits is set to @a true, otherwise @a false
          *
-         * @param      other  @ref sul::dynamic_bitset to exchange bits with
+         * @remark     Return @a true if the @ref sul::dynamic_bitset is empty, the logic is that you
+         *             are checking if there is no bit set to @a true and in an empty @ref
+         *             sul::dynamic_bitset there is no bit that can be set to @a true.
          *
-         * @complexity Constant.
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
          *
          * @since      1.0.0
          */
-        constexpr void
-        swap(dynamic_bitset<Block, Allocator>& other) noexcept(noexcept(std::swap(m_blocks, other.m_blocks)));
+        [[nodiscard]] constexpr bool none() const;
 
         /**
-         * @brief      Gets the associated allocator.
+         * @brief      Count the number of bits set to @a true.
          *
-         * @return     The associated allocator.
+         * @details    Return 0 if the @ref sul::dynamic_bitset is empty.
          *
-         * @complexity Constant.
+         * @return     The number of bits that are set to @a true
+         *
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
          *
          * @since      1.0.0
          */
-        [[nodiscard]] constexpr allocator_type get_allocator() const;
+        [[nodiscard]] constexpr size_type count() const noexcept;
 
         /**
-         * @brief      Generate a string representation of the @ref sul::dynamic_bitset.
+         * @brief      Checks if all bits of the range \[@p pos, @p pos + @p len\[ are set to @a true.
          *
-         * @details    Uses @p zero to represent bits with value of @a false and @p one to represent
-         *             bits with value of @a true. The resulting string contains @ref size() characters
-         *             with the first character corresponds to the last (@ref size() - 1th) bit and the
-         *             last character corresponding to the first bit.
+         * @details    Return @a true if @p len == 0, see @ref all().
          *
-         * @param[in]  zero     Character to use to represent @a false
-         * @param[in]  one      Character to use to represent @a true
+         * @param[in]  pos   Position of the first bit of the range
+         * @param[in]  len   Length of the range
          *
-         * @tparam     _CharT   Character type of the string
-         * @tparam     _Traits  Traits class specifying the operations on the character type of the
-         *                      string
-         * @tparam     _Alloc   Allocator type used to allocate internal storage of the string
+         * @return     @a true if all bits of the range are set to @a true, otherwise @a false
          *
-         * @return     The string representing the @ref sul::dynamic_bitset content
+         * @pre        @code
+         *             (len == 0 && pos <= size()) || (pos < size() && pos + len - 1 < size())
+         *             @endcode
          *
-         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         * @complexity Linear in @p len.
          *
-         * @since      1.0.0
+         * @since      1.4.0
          */
-        template<typename _CharT = char,
-                 typename _Traits = std::char_traits<_CharT>,
-                 typename _Alloc = std::allocator<_CharT>>
-        [[nodiscard]] constexpr std::basic_string<_CharT, _Traits, _Alloc> to_string(_CharT zero = _CharT('0'),
-                                                                                     _CharT one = _CharT('1')) const;
+        [[nodiscard]] constexpr bool all(size_type pos, size_type len) const;
 
         /**
-         * @brief      Converts the contents of the bitset to an <tt>unsigned long</tt> integer.
+         * @brief      Checks if any bits of the range \[@p pos, @p pos + @p len\[ are set to @a true.
          *
-         * @details    The first bit of the bitset corresponds to the least significant digit of the
-         *             number and the last bit corresponds to the most significant digit.
+         * @details    Return @a false if @p len == 0, see @ref any().
          *
-         * @return     The numeric value corresponding to the bitset contents.
+         * @param[in]  pos   Position of the first bit of the range
+         * @param[in]  len   Length of the range
          *
-         * @throws     std::overflow_error  if the value is too large to be represented in an <tt>unsigned
-         *                                  long</tt>
+         * @return     @a true if any of the bits of the range is set to @a true, otherwise @a false
          *
-         * @complexity Constant.
+         * @pre        @code
+         *             (len == 0 && pos <= size()) || (pos < size() && pos + len - 1 < size())
+         *             @endcode
          *
-         * @since      1.3.0
+         * @complexity Linear in @p len.
+         *
+         * @since      1.4.0
          */
-        [[nodiscard]] constexpr unsigned long to_ulong() const;
+        [[nodiscard]] constexpr bool any(size_type pos, size_type len) const;
 
         /**
-         * @brief      Converts the contents of the bitset to an <tt>unsigned long long</tt> integer.
+         * @brief      Checks if none of the bits of the range \[@p pos, @p pos + @p len\[ are set to @a
+         *             true.
          *
-         * @details    The first bit of the bitset corresponds to the least significant digit of the
-         *             number and the last bit corresponds to the most significant digit.
+         * @details    Return @a true if @p len == 0, see @ref none().
          *
-         * @return     The numeric value corresponding to the bitset contents.
+         * @param[in]  pos   Position of the first bit of the range
+         * @param[in]  len   Length of the range
          *
-         * @throws     std::overflow_error  if the value is too large to be represented in an <tt>unsigned long
-         *                                  long</tt>
+         * @return     @a true if none of the bits of the range is set to @a true, otherwise @a false
          *
-         * @complexity Constant.
+         * @pre        @code
+         *             (len == 0 && pos <= size()) || (pos < size() && pos + len - 1 < size())
+         *             @endcode
          *
-         * @since      1.3.0
+         * @complexity Linear in @p len.
+         *
+         * @since      1.4.0
          */
-        [[nodiscard]] constexpr unsigned long long to_ullong() const;
+        [[nodiscard]] constexpr bool none(size_type pos, size_type len) const;
 
         /**
-         * @brief      Iterate on the @ref sul::dynamic_bitset and call @p function with the position of
-         *             the bits on.
+         * @brief      Count the number of bits set to @a true in the range \[@p pos, @p pos + @p len\[.
          *
-         * @details    For each set bit, @p function is called as follow:
-         *             @code
-         *             std::invoke(std::forward<Function>(function), bit_pos, std::forward<Parameters>(parameters)...))
-         *             @endcode
-         *             where @p bit_pos is the position of the current bit on. Thus @p function
-         *             should take a size_t for the current set bit position as first argument, also @p
-         *             parameters can be used to pass additional arguments to @p function when it is
-         *             called by this method.\n\n @p function can return nothing or a bool, if it return
-         *             a bool, the return value indicate if the iteration should continue, @a true to
-         *             continue the iteration, @a false to stop, this make it easy to do an early exit.
+         * @details    The partial first and last blocks of the range are masked, the full blocks in
+         *             between are counted as @ref count() does (with libpopcnt if available).
          *
-         * @param      function    Function to call on all bits on, take the current bit position as
-         *                         first argument and @p parameters as next arguments
-         * @param      parameters  Extra parameters for @p function
+         * @param[in]  pos   Position of the first bit of the range
+         * @param[in]  len   Length of the range
          *
-         * @tparam     Function    Type of @p function, must take a size_t as first argument and @p
-         *                         Parameters as next arguments
-         * @tparam     Parameters  Type of @p parameters
+         * @return     The number of bits of the range that are set to @a true
          *
-         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         * @pre        @code
+         *             (len == 0 && pos <= size()) || (pos < size() && pos + len - 1 < size())
+         *             @endcode
          *
-         * @since      1.0.0
+         * @complexity Linear in @p len.
+         *
+         * @since      1.4.0
          */
-        template<typename Function, typename... Parameters>
-        constexpr void iterate_bits_on(Function&& function, Parameters&&... parameters) const;
+        [[nodiscard]] constexpr size_type count(size_type pos, size_type len) const;
 
         /**
-         * @brief      Return a pointer to the underlying array serving as blocks storage.
-         *
-         * @details    The pointer is such that range [@ref data(); @ref data() + @ref num_blocks()) is
-         *             always a valid range, even if the container is empty (@ref data() is not
-         *             dereferenceable in that case).
+         * @brief      Count the number of bits set to @a true in each segment of @p segment_bits bits
+         *             and write the counts to @p out.
          *
+         * @details    The @ref sul::dynamic_bitset is split in consecutive segments of @p segment_bits
+         *             bits starting from the first bit, the last segment may be shorter. The segments
+         *             are counted in order in a single pass over the blocks, the whole blocks of a
+         *             segment being counted at once (with libpopcnt if available), with a single
+         *             instrumentation event. Nothing is written if the @ref sul::dynamic_bitset is
+         *             empty.
          *
-         * @post       The bits past the end of the @ref sul::dynamic_bitset in the last block are
-         *             guaranteed to be 0s, example:
-         *             @code
-         *             // random bitset of size 11
-         *             std::minstd_rand rand(std::random_device{}());
-         *             std::bernoulli_distribution dist;
-         *             sul::dynamic_bitset<uint8_t> bitset;
-         *             for(size_t i = 0; i < 11; ++i)
-         *             {
-         *                 bitset.push_back(dist(rand));
-         *             }
+         * @param[in]  segment_bits  Number of bits of the segments
+         * @param      out           Output iterator to write the counts to, as @ref size_type
          *
-         *             // the bitset use 2 blocks of 8 bits
-         *             // check that unused bits are set to 0
-         *             assert(*(bitset.data() + 1) >> 3 == 0);
-         *             @endcode
+         * @tparam     OutputIt      Type of @p out, must meet the requirements of @a
+         *                           LegacyOutputIterator
          *
-         * @remark     If the @ref sul::dynamic_bitset is empty, this function may or may not return a
-         *             null pointer.
+         * @return     Output iterator to the element past the last count written
          *
-         * @return     A pointer to the underlying array serving as blocks storage
+         * @pre        @code
+         *             segment_bits > 0
+         *             @endcode
          *
-         * @complexity Constant.
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
          *
-         * @since      1.2.0
+         * @since      1.4.0
          */
-        [[nodiscard]] constexpr block_type* data() noexcept;
+        template<typename OutputIt>
+        constexpr OutputIt segment_counts(size_type segment_bits, OutputIt out) const;
 
         /**
-         * @brief      Return a pointer to the underlying array serving as blocks storage.
-         *
-         * @details    The pointer is such that range [@ref data(); @ref data() + @ref num_blocks()) is
-         *             always a valid range, even if the container is empty (@ref data() is not
-         *             dereferenceable in that case).
+         * @brief      Accesses the bit at position @p pos.
          *
+         * @param[in]  pos   Position of the bit to access
          *
-         * @post       The bits past the end of the @ref sul::dynamic_bitset in the last block are
-         *             guaranteed to be 0s, example:
-         *             @code
-         *             // random bitset of size 11
-         *             std::minstd_rand rand(std::random_device{}());
-         *             std::bernoulli_distribution dist;
-         *             sul::dynamic_bitset<uint8_t> bitset;
-         *             for(size_t i = 0; i < 11; ++i)
-         *             {
-         *                 bitset.push_back(dist(rand));
-         *             }
+         * @return     A @ref reference object which allows writing to the requested bit
          *
-         *             // the bitset use 2 blocks of 8 bits
-         *             // check that unused bits are set to 0
-         *             assert(*(bitset.data() + 1) >> 3 == 0);
+         * @pre        @code
+         *             pos < size()
          *             @endcode
          *
-         * @remark     If the @ref sul::dynamic_bitset is empty, this function may or may not return a
-         *             null pointer.
-         *
-         * @return     A pointer to the underlying array serving as blocks storage
-         *
          * @complexity Constant.
          *
-         * @since      1.2.0
+         * @since      1.0.0
          */
-        [[nodiscard]] constexpr const block_type* data() const noexcept;
+        [[nodiscard]] constexpr reference operator[](size_type pos);
 
         /**
-         * @brief      Test if two @ref sul::dynamic_bitset have the same content.
+         * @brief      Accesses the bit at position @p pos.
          *
-         * @param[in]  lhs         The left hand side @ref sul::dynamic_bitset of the operator
-         * @param[in]  rhs         The right hand side @ref sul::dynamic_bitset of the operator
+         * @param[in]  pos   Position of the bit to access
          *
-         * @tparam     Block_      Block type used by @p lhs and @p rhs for storing the bits
-         * @tparam     Allocator_  Allocator type used by @p lhs and @p rhs for memory management
+         * @return     The value of the requested bit
          *
-         * @return     @a true if they contain the same bits, @a false otherwise
+         * @pre        @code
+         *             pos < size()
+         *             @endcode
          *
-         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         * @complexity Constant.
          *
          * @since      1.0.0
          */
-        template<typename Block_, typename Allocator_>
-        friend constexpr bool operator==(const dynamic_bitset<Block_, Allocator_>& lhs,
-                                         const dynamic_bitset<Block_, Allocator_>& rhs);
+        [[nodiscard]] constexpr const_reference operator[](size_type pos) const;
 
         /**
-         * @brief      Test if @p lhs is "less than" @p rhs. The comparison of the two @ref
-         *             dynamic_bitset is first on numbers their content represent and then on their
-         *             size.
+         * @brief      Give the number of bits of the @ref sul::dynamic_bitset.
          *
-         * @details    The size comparison is necessary for the comparison operators to keep their
-         *             properties. For example without the size comparison the "<=" operator (defined
-         *             for "A <= B" by "!(B < A)") would no longer be antisymmetric (if A \<= B and B
-         *             \<= A, then A == B) because @ref operator==() compare the @ref
-         *             sul::dynamic_bitset as a container and not a number. For example with bitsets
-         *             A(0011) and B(011), without the size comparison B \< A would be @a false, A \<= B
-         *             would be @a true, B \<= A would be @a true, but A == B would be @a false,
-         *             breaking the antisymmetric property of the operator. Thus, to respect the
-         *             properties of the operators, the size is used as a secondary criteria for the
-         *             comparison of @ref sul::dynamic_bitset which content represent the same number.
-         *             Therefore, for the previous example with bitsets A(0011) and B(011), B \< A is @a
-         *             true, A \<= B is @a false, B \<= A is @a true and A == B is @a false.\n\n If
-         *             comparing bitsets @a A and @a B with the content of @a A representing the number
-         *             @a a, and the content of @a B representing the number @a b, this operator would
-         *             work as follow:
+         * @return     The number of bits of the @ref sul::dynamic_bitset
+         *
+         * @complexity Constant.
+         *
+         * @since      1.0.0
+         */
+        [[nodiscard]] constexpr size_type size() const noexcept;
+
+        /**
+         * @brief      Give the number of blocks used by the @ref sul::dynamic_bitset.
+         *
+         * @return     The number of blocks used by the @ref sul::dynamic_bitset
+         *
+         * @complexity Constant.
+         *
+         * @since      1.0.0
+         */
+        [[nodiscard]] constexpr size_type num_blocks() const noexcept;
+
+        /**
+         * @brief      Checks if the @ref sul::dynamic_bitset is empty.
+         *
+         * @details    Equivalent to:
          *             @code
-         *             if(a == b)
-         *             {
-         *                 return A.size() < B.size();
-         *             }
-         *             else
-         *             {
-         *                 return a < b;
-         *             }
+         *             size() == 0;
          *             @endcode
          *
-         * @remark     The empty @ref sul::dynamic_bitset is the "lowest" of all bitset and for 0-only
-         *             bitsets comparison, the shortest is the lowest.
+         * @return     @a true if the @ref sul::dynamic_bitset is empty, @a false otherwise
          *
-         * @param[in]  lhs         The left hand side @ref sul::dynamic_bitset of the operator
-         * @param[in]  rhs         The right hand side @ref sul::dynamic_bitset of the operator
+         * @complexity Constant.
          *
-         * @tparam     Block_      Block type used by @p lhs and @p rhs for storing the bits
-         * @tparam     Allocator_  Allocator type used by @p lhs and @p rhs for memory management
+         * @since      1.0.0
+         */
+        [[nodiscard]] constexpr bool empty() const noexcept;
+
+        /**
+         * @brief      Give the number of bits that the @ref sul::dynamic_bitset has currently allocated
+         *             space for.
          *
-         * @return     @a true if @p lhs is "less than" @p rhs
+         * @return     Capacity of the currently allocated storage.
          *
-         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         * @complexity Constant.
          *
          * @since      1.0.0
          */
-        template<typename Block_, typename Allocator_>
-        friend constexpr bool operator<(const dynamic_bitset<Block_, Allocator_>& lhs,
-                                        const dynamic_bitset<Block_, Allocator_>& rhs);
-
-    private:
-        template<typename T>
-        struct dependent_false : public std::false_type
-        {
-        };
-
-        std::vector<Block, Allocator> m_blocks;
-        size_type m_bits_number;
-
-        static constexpr block_type zero_block = block_type(0);
-        static constexpr block_type one_block = block_type(~zero_block);
-        static constexpr size_type block_last_bit_index = bits_per_block - 1;
-
-        static constexpr size_type blocks_required(size_type nbits) noexcept;
+        [[nodiscard]] constexpr size_type capacity() const noexcept;
 
-        static constexpr size_type block_index(size_type pos) noexcept;
-        static constexpr size_type bit_index(size_type pos) noexcept;
+        /**
+         * @brief      Increase the capacity of the @ref sul::dynamic_bitset to a value that's greater
+         *             or equal to @p num_bits.
+         *
+         * @details    If @p num_bits is greater than the current capacity, new storage is allocated and
+         *             all @ref reference on bits of the @ref sul::dynamic_bitset are invalidated,
+         *             otherwise the method does nothing.
+         *
+         * @param[in]  num_bits  New capacity of the @ref sul::dynamic_bitset
+         *
+         * @complexity At most linear in the size of the @ref sul::dynamic_bitset.
+         *
+         * @since      1.0.0
+         */
+        constexpr void reserve(size_type num_bits);
 
-        static constexpr block_type bit_mask(size_type pos) noexcept;
-        static constexpr block_type bit_mask(size_type first, size_type last) noexcept;
+        /**
+         * @brief      Requests the removal of unused capacity.
+         *
+         * @details    It is a non-binding request to reduce the capacity to the size. It depends on the
+         *             implementation of std\::vector whether the request is fulfilled.\n If
+         *             reallocation occurs, all @ref reference on bits of the @ref sul::dynamic_bitset
+         *             are invalidated.
+         *
+         * @complexity At most linear in the size of the @ref sul::dynamic_bitset.
+         *
+         * @since      1.0.0
+         */
+        constexpr void shrink_to_fit();
 
-        static constexpr void
-        set_block_bits(block_type& block, size_type first, size_type last, bool val = true) noexcept;
-        static constexpr void flip_block_bits(block_type& block, size_type first, size_type last) noexcept;
+        /**
+         * @brief      Determines if this @ref sul::dynamic_bitset is a subset of @p bitset.
+         *
+         * @details    This @ref sul::dynamic_bitset is a subset of @p bitset if, for every bit that is
+         *             set in this @ref sul::dynamic_bitset, the corresponding bit in @p bitset a is
+         *             also set.\n\n Less efficient but equivalent way to get this result:
+         *             @code
+         *             res = (this & ~bitset).none();
+         *             @endcode
+         *
+         * @param[in]  bitset  The @ref sul::dynamic_bitset for which to check if this @ref
+         *                     sul::dynamic_bitset is a subset
+         *
+         * @return     @a true if this @ref sul::dynamic_bitset is a subset of @p bitset, @a false
+         *             otherwise
+         *
+         * @remark     The relation "is a subset of" is not symmetric (A being a subset of B doesn't
+         *             imply that B is a subset of A) but is antisymmetric (if A is a subset of B and B
+         *             is a subset of A, then A == B).
+         *
+         * @pre        @code
+         *             size() == bitset.size()
+         *             @endcode
+         *
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         *
+         * @since      1.0.0
+         */
+        [[nodiscard]] constexpr bool is_subset_of(const dynamic_bitset<Block, Allocator>& bitset) const;
 
-        static constexpr size_type block_count(const block_type& block) noexcept;
-        static constexpr size_type block_count(const block_type& block, size_type nbits) noexcept;
+        /**
+         * @brief      Determines if this @ref sul::dynamic_bitset is a proper subset of @p bitset.
+         *
+         * @details    This @ref sul::dynamic_bitset is a proper subset of @p bitset if, for every bit
+         *             that is set in this @ref sul::dynamic_bitset, the corresponding bit in @p bitset
+         *             a is also set and if this @ref sul::dynamic_bitset is different from @p
+         *             bitset.\n\n Less efficient but equivalent way to get this result:
+         *             @code
+         *             res = ((this != bitset) && (this & ~bitset).none());
+         *             @endcode
+         *
+         * @param[in]  bitset  The @ref sul::dynamic_bitset for which to check if this @ref
+         *                     sul::dynamic_bitset is a proper subset
+         *
+         * @return     @a true if this @ref sul::dynamic_bitset is a proper subset of @p bitset, @a
+         *             false otherwise
+         *
+         * @remark     The relation "is a proper subset of" is asymmetric (A being a proper subset of B
+         *             imply that B is not a proper subset of A).
+         *
+         * @pre        @code
+         *             size() == bitset.size()
+         *             @endcode
+         *
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         *
+         * @since      1.0.0
+         */
+        [[nodiscard]] constexpr bool is_proper_subset_of(const dynamic_bitset<Block, Allocator>& bitset) const;
 
-        static constexpr size_type count_block_trailing_zero(const block_type& block) noexcept;
+        /**
+         * @brief      Determines if this @ref sul::dynamic_bitset and @p bitset intersect.
+         *
+         * @details    This @ref sul::dynamic_bitset intersects with @p bitset if for at least one bit
+         *             set in this @ref sul::dynamic_bitset, the corresponding bit in @p bitset a is
+         *             also set. In other words two bitsets intersect if they have at least one bit set
+         *             in common.\n\n Less efficient but equivalent way to get this result:
+         *             @code
+         *             res = (this & bitset).any();
+         *             @endcode
+         *
+         * @param[in]  bitset  The @ref sul::dynamic_bitset for which to check if this @ref
+         *                     sul::dynamic_bitset intersects
+         *
+         * @return     @a true if this @ref sul::dynamic_bitset intersects with @p bitset, @a false
+         *             otherwise
+         *
+         * @pre        @code
+         *             size() == bitset.size()
+         *             @endcode
+         *
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         *
+         * @since      1.0.0
+         */
+        [[nodiscard]] constexpr bool intersects(const dynamic_bitset<Block, Allocator>& bitset) const;
 
-        template<typename _CharT, typename _Traits>
-        constexpr void init_from_string(std::basic_string_view<_CharT, _Traits> str,
-                                        typename std::basic_string_view<_CharT, _Traits>::size_type pos,
-                                        typename std::basic_string_view<_CharT, _Traits>::size_type n,
-                                        _CharT zero,
-                                        _CharT one);
+        /**
+         * @brief      Find the position of the first bit set in the @ref sul::dynamic_bitset starting
+         *             from the least-significant bit.
+         *
+         * @details    Give the lowest index of the @ref sul::dynamic_bitset with a bit set, or @ref
+         *             npos if no bits are set.
+         *
+         * @return     The position of the first bit set, or @ref npos if no bits are set
+         *
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         *
+         * @since      1.0.0
+         */
+        [[nodiscard]] constexpr size_type find_first() const;
 
-        constexpr block_type& get_block(size_type pos);
-        constexpr const block_type& get_block(size_type pos) const;
-        constexpr block_type& last_block();
-        constexpr block_type last_block() const;
+        /**
+         * @brief      Find the position of the first bit set in the range \[@p prev + 1, @ref size()\[
+         *             of the @ref sul::dynamic_bitset starting from the position @p prev + 1.
+         *
+         * @details    Give the lowest index superior to @p prev of the @ref sul::dynamic_bitset with a
+         *             bit set, or @ref npos if no bits are set after the index @p prev.\n If @p prev +
+         *             1 \>= @ref size(), return @ref npos.
+         *
+         * @param[in]  prev  Position of the bit preceding the search range
+         *
+         * @return     The position of the first bit set after @p prev, or @ref npos if no bits are set
+         *             after @p prev
+         *
+         * @complexity Linear in @ref size() - @p prev.
+         *
+         * @since      1.0.0
+         */
+        [[nodiscard]] constexpr size_type find_next(size_type prev) const;
+
+        /**
+         * @brief      Find the position of the last bit set in the @ref sul::dynamic_bitset starting
+         *             from the most-significant bit.
+         *
+         * @details    Give the highest index of the @ref sul::dynamic_bitset with a bit set, or @ref
+         *             npos if no bits are set.
+         *
+         * @return     The position of the last bit set, or @ref npos if no bits are set
+         *
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] constexpr size_type find_last() const;
+
+        /**
+         * @brief      Find the position of the last bit set in the range \[0, @p next\[ of the @ref
+         *             sul::dynamic_bitset starting from the position @p next - 1.
+         *
+         * @details    Give the highest index inferior to @p next of the @ref sul::dynamic_bitset with a
+         *             bit set, or @ref npos if no bits are set before the index @p next.\n If @p next
+         *             \> @ref size(), the whole @ref sul::dynamic_bitset is searched, as with @ref
+         *             find_last().
+         *
+         * @param[in]  next  Position of the bit following the search range
+         *
+         * @return     The position of the last bit set before @p next, or @ref npos if no bits are set
+         *             before @p next
+         *
+         * @complexity Linear in @p next.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] constexpr size_type find_prev(size_type next) const;
+
+        /**
+         * @brief      Find the position of the first bit not set in the @ref sul::dynamic_bitset
+         *             starting from the least-significant bit.
+         *
+         * @details    Give the lowest index of the @ref sul::dynamic_bitset with a bit not set, or
+         *             @ref npos if all bits are set. The blocks are inverted on the fly, without
+         *             allocating.
+         *
+         * @return     The position of the first bit not set, or @ref npos if all bits are set
+         *
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] constexpr size_type find_first_zero() const;
+
+        /**
+         * @brief      Find the position of the first bit not set in the range \[@p prev + 1, @ref
+         *             size()\[ of the @ref sul::dynamic_bitset starting from the position @p prev + 1.
+         *
+         * @details    Give the lowest index superior to @p prev of the @ref sul::dynamic_bitset with a
+         *             bit not set, or @ref npos if all bits are set after the index @p prev.\n If @p
+         *             prev + 1 \>= @ref size(), return @ref npos.
+         *
+         * @param[in]  prev  Position of the bit preceding the search range
+         *
+         * @return     The position of the first bit not set after @p prev, or @ref npos if all bits
+         *             are set after @p prev
+         *
+         * @complexity Linear in @ref size() - @p prev.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] constexpr size_type find_next_zero(size_type prev) const;
+
+        /**
+         * @brief      Exchanges the bits of this @ref sul::dynamic_bitset with those of @p other.
+         *
+         * @details    All @ref reference on bits of the @ref sul::dynamic_bitset are invalidated.
+         *
+         * @param      other  @ref sul::dynamic_bitset to exchange bits with
+         *
+         * @complexity Constant.
+         *
+         * @since      1.0.0
+         */
+        constexpr void
+        swap(dynamic_bitset<Block, Allocator>& other) noexcept(noexcept(std::swap(m_blocks, other.m_blocks)));
+
+        /**
+         * @brief      Gets the associated allocator.
+         *
+         * @return     The associated allocator.
+         *
+         * @complexity Constant.
+         *
+         * @since      1.0.0
+         */
+        [[nodiscard]] constexpr allocator_type get_allocator() const;
+
+        /**
+         * @brief      Generate a string representation of the @ref sul::dynamic_bitset.
+         *
+         * @details    Uses @p zero to represent bits with value of @a false and @p one to represent
+         *             bits with value of @a true. The resulting string contains @ref size() characters
+         *             with the first character corresponds to the last (@ref size() - 1th) bit and the
+         *             last character corresponding to the first bit.
+         *
+         * @param[in]  zero     Character to use to represent @a false
+         * @param[in]  one      Character to use to represent @a true
+         *
+         * @tparam     _CharT   Character type of the string
+         * @tparam     _Traits  Traits class specifying the operations on the character type of the
+         *                      string
+         * @tparam     _Alloc   Allocator type used to allocate internal storage of the string
+         *
+         * @return     The string representing the @ref sul::dynamic_bitset content
+         *
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         *
+         * @since      1.0.0
+         */
+        template<typename _CharT = char,
+                 typename _Traits = std::char_traits<_CharT>,
+                 typename _Alloc = std::allocator<_CharT>>
+        [[nodiscard]] constexpr std::basic_string<_CharT, _Traits, _Alloc> to_string(_CharT zero = _CharT('0'),
+                                                                                     _CharT one = _CharT('1')) const;
+
+        /**
+         * @brief      Converts the contents of the bitset to an <tt>unsigned long</tt> integer.
+         *
+         * @details    The first bit of the bitset corresponds to the least significant digit of the
+         *             number and the last bit corresponds to the most significant digit.
+         *
+         * @return     The numeric value corresponding to the bitset contents.
+         *
+         * @throws     std::overflow_error  if the value is too large to be represented in an <tt>unsigned
+         *                                  long</tt>
+         *
+         * @complexity Constant.
+         *
+         * @since      1.3.0
+         */
+        [[nodiscard]] constexpr unsigned long to_ulong() const;
+
+        /**
+         * @brief      Converts the contents of the bitset to an <tt>unsigned long long</tt> integer.
+         *
+         * @details    The first bit of the bitset corresponds to the least significant digit of the
+         *             number and the last bit corresponds to the most significant digit.
+         *
+         * @return     The numeric value corresponding to the bitset contents.
+         *
+         * @throws     std::overflow_error  if the value is too large to be represented in an <tt>unsigned long
+         *                                  long</tt>
+         *
+         * @complexity Constant.
+         *
+         * @since      1.3.0
+         */
+        [[nodiscard]] constexpr unsigned long long to_ullong() const;
+
+        /**
+         * @brief      Converts the contents of the bitset to a std\::bitset of @p N bits.
+         *
+         * @details    The bit at position i of the std\::bitset is the bit at position i of the @ref
+         *             sul::dynamic_bitset, the bits of the std\::bitset past the end of the @ref
+         *             sul::dynamic_bitset are @a false. The blocks are copied whole when the layout of
+         *             std\::bitset is known.
+         *
+         * @tparam     N     Number of bits of the std\::bitset
+         *
+         * @return     The std\::bitset corresponding to the bitset contents.
+         *
+         * @throws     std::overflow_error  if a bit at a position greater or equal to @p N is set
+         *
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset / @ref bits_per_block if the
+         *             layout of std\::bitset is known, linear in the size of the @ref
+         *             sul::dynamic_bitset otherwise.
+         *
+         * @since      1.4.0
+         */
+        template<size_t N>
+        [[nodiscard]] constexpr std::bitset<N> to_std_bitset() const;
+
+        /**
+         * @brief      Converts the contents of the bitset to a std\::vector\<bool\>.
+         *
+         * @details    The element i of the std\::vector\<bool\> is the bit at position i of the @ref
+         *             sul::dynamic_bitset. The blocks are copied whole with libstdc++.
+         *
+         * @param[in]  allocator  Allocator to use for the memory management of the vector
+         *
+         * @tparam     _Alloc     Allocator type of the vector
+         *
+         * @return     The std\::vector\<bool\> corresponding to the bitset contents.
+         *
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset / @ref bits_per_block with
+         *             libstdc++, linear in the size of the @ref sul::dynamic_bitset otherwise.
+         *
+         * @since      1.4.0
+         */
+        template<typename _Alloc = std::allocator<bool>>
+        [[nodiscard]] constexpr std::vector<bool, _Alloc> to_vector_bool(const _Alloc& allocator = _Alloc()) const;
+
+        /**
+         * @brief      Generate a hexadecimal representation of the @ref sul::dynamic_bitset.
+         *
+         * @details    The string contains one lowercase hexadecimal digit per 4 bits, the first digit
+         *             corresponding to the last bits and the last digit to the first 4 bits, as the
+         *             characters of @ref to_string(). The bits of the first digit past the end of the
+         *             @ref sul::dynamic_bitset are 0s.
+         *
+         * @return     The hexadecimal string representing the @ref sul::dynamic_bitset content
+         *
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] constexpr std::string to_hex_string() const;
+
+        /**
+         * @brief      Constructs a @ref sul::dynamic_bitset from its hexadecimal representation.
+         *
+         * @details    Reverse of @ref to_hex_string(), the digits can be lowercase or uppercase. The
+         *             @ref sul::dynamic_bitset has 4 bits per digit, or @p nbits bits if @p nbits is not
+         *             @ref npos, the bits past the digits being 0s.
+         *
+         * @param[in]  str        Hexadecimal digits, the first one corresponding to the last bits
+         * @param[in]  nbits      Number of bits of the @ref sul::dynamic_bitset, @ref npos for 4 bits
+         *                        per digit
+         * @param[in]  allocator  Allocator to use for memory management
+         *
+         * @return     The @ref sul::dynamic_bitset represented by @p str
+         *
+         * @throws     std::invalid_argument  if @p str contains a character which is not an
+         *                                    hexadecimal digit or a bit at a position greater or equal to
+         *                                    @p nbits is set
+         *
+         * @complexity Linear in @p str.size().
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] static constexpr dynamic_bitset<Block, Allocator> from_hex(
+          std::string_view str,
+          size_type nbits = npos,
+          const allocator_type& allocator = allocator_type());
+
+        /**
+         * @brief      Generate a base64 representation of the @ref sul::dynamic_bitset.
+         *
+         * @details    Encode the bytes of the @ref sul::dynamic_bitset with the standard base64
+         *             alphabet and padding (RFC 4648), the byte i holding the bits [8 * i, 8 * i + 8[
+         *             with the bit 8 * i as least significant bit. The bits of the last byte past the
+         *             end of the @ref sul::dynamic_bitset are 0s.
+         *
+         * @return     The base64 string representing the @ref sul::dynamic_bitset content
+         *
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] constexpr std::string to_base64() const;
+
+        /**
+         * @brief      Constructs a @ref sul::dynamic_bitset from its base64 representation.
+         *
+         * @details    Reverse of @ref to_base64(), @p str must be padded. The @ref sul::dynamic_bitset
+         *             has 8 bits per decoded byte, or @p nbits bits if @p nbits is not @ref npos, the
+         *             bits past the decoded bytes being 0s.
+         *
+         * @param[in]  str        Base64 string
+         * @param[in]  nbits      Number of bits of the @ref sul::dynamic_bitset, @ref npos for 8 bits
+         *                        per decoded byte
+         * @param[in]  allocator  Allocator to use for memory management
+         *
+         * @return     The @ref sul::dynamic_bitset represented by @p str
+         *
+         * @throws     std::invalid_argument  if the size of @p str is not a multiple of 4, @p str
+         *                                    contains a character out of the base64 alphabet or a
+         *                                    misplaced padding, or a bit at a position greater or equal
+         *                                    to @p nbits is set
+         *
+         * @complexity Linear in @p str.size().
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] static constexpr dynamic_bitset<Block, Allocator> from_base64(
+          std::string_view str,
+          size_type nbits = npos,
+          const allocator_type& allocator = allocator_type());
+
+        /**
+         * @brief      Extract the @p nbits bits starting at position @p pos as an <tt>unsigned long
+         *             long</tt> integer.
+         *
+         * @details    The bit at position @p pos corresponds to the least significant digit of the
+         *             number. The bits are read with shifts of the blocks containing them, at most
+         *             two blocks if @ref bits_per_block is at least 64.
+         *
+         * @param[in]  pos    Position of the first bit to extract
+         * @param[in]  nbits  Number of bits to extract
+         *
+         * @return     The numeric value corresponding to the extracted bits
+         *
+         * @pre        @code
+         *             nbits <= std::numeric_limits<unsigned long long>::digits
+         *             && pos <= size() && nbits <= size() - pos
+         *             @endcode
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] constexpr unsigned long long extract_bits(size_type pos, size_type nbits) const;
+
+        /**
+         * @brief      Gives a mutable view of the @p len bits starting at position @p pos.
+         *
+         * @details    No bits are copied, see @ref slice_view.
+         *
+         * @param[in]  pos   Position of the first bit of the range
+         * @param[in]  len   Number of bits of the range
+         *
+         * @return     A @ref slice_view of the range
+         *
+         * @pre        @code
+         *             pos <= size() && len <= size() - pos
+         *             @endcode
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] constexpr slice_view slice(size_type pos, size_type len);
+
+        /**
+         * @brief      Gives a read-only view of the @p len bits starting at position @p pos.
+         *
+         * @details    No bits are copied, see @ref const_slice_view.
+         *
+         * @param[in]  pos   Position of the first bit of the range
+         * @param[in]  len   Number of bits of the range
+         *
+         * @return     A @ref const_slice_view of the range
+         *
+         * @pre        @code
+         *             pos <= size() && len <= size() - pos
+         *             @endcode
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] constexpr const_slice_view slice(size_type pos, size_type len) const;
+
+        /**
+         * @brief      Computes a 64-bit hash of the content of the @ref sul::dynamic_bitset.
+         *
+         * @details    The blocks are read directly as 64-bit words and mixed with four independent
+         *             accumulators (XXH64-style rounds) followed by an avalanche of the size. Two @ref
+         *             sul::dynamic_bitset equal according to @ref operator==() have the same hash for
+         *             the same @p seed. The value is not guaranteed to be stable between versions,
+         *             platforms or block types, and must not be persisted.
+         *
+         * @param[in]  seed  Seed of the hash
+         *
+         * @return     The hash of the @ref sul::dynamic_bitset
+         *
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] constexpr unsigned long long hash(unsigned long long seed = 0) const noexcept;
+
+        /**
+         * @brief      Iterate on the @ref sul::dynamic_bitset and call @p function with the position of
+         *             the bits on.
+         *
+         * @details    For each set bit, @p function is called as follow:
+         *             @code
+         *             std::invoke(std::forward<Function>(function), bit_pos, std::forward<Parameters>(parameters)...))
+         *             @endcode
+         *             where @p bit_pos is the position of the current bit on. Thus @p function
+         *             should take a size_t for the current set bit position as first argument, also @p
+         *             parameters can be used to pass additional arguments to @p function when it is
+         *             called by this method.\n\n @p function can return nothing or a bool, if it return
+         *             a bool, the return value indicate if the iteration should continue, @a true to
+         *             continue the iteration, @a false to stop, this make it easy to do an early exit.
+         *
+         * @param      function    Function to call on all bits on, take the current bit position as
+         *                         first argument and @p parameters as next arguments
+         * @param      parameters  Extra parameters for @p function
+         *
+         * @tparam     Function    Type of @p function, must take a size_t as first argument and @p
+         *                         Parameters as next arguments
+         * @tparam     Parameters  Type of @p parameters
+         *
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         *
+         * @since      1.0.0
+         */
+        template<typename Function, typename... Parameters>
+        constexpr void iterate_bits_on(Function&& function, Parameters&&... parameters) const;
+
+        /**
+         * @brief      Iterate on the @ref sul::dynamic_bitset in reverse order and call @p function
+         *             with the position of the bits on.
+         *
+         * @details    Same as @ref iterate_bits_on(), but the bits on are visited from the last (highest
+         *             position) to the first.
+         *
+         * @param      function    Function to call on all bits on, take the current bit position as
+         *                         first argument and @p parameters as next arguments
+         * @param      parameters  Extra parameters for @p function
+         *
+         * @tparam     Function    Type of @p function, must take a size_t as first argument and @p
+         *                         Parameters as next arguments
+         * @tparam     Parameters  Type of @p parameters
+         *
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         *
+         * @since      1.4.0
+         */
+        template<typename Function, typename... Parameters>
+        constexpr void iterate_bits_on_reverse(Function&& function, Parameters&&... parameters) const;
+
+        /**
+         * @brief      Iterate on the @ref sul::dynamic_bitset and call @p function with the position of
+         *             the bits off.
+         *
+         * @details    Same as @ref iterate_bits_on(), but for the bits set to @a false, from the first
+         *             to the last.
+         *
+         * @param      function    Function to call on all bits off, take the current bit position as
+         *                         first argument and @p parameters as next arguments
+         * @param      parameters  Extra parameters for @p function
+         *
+         * @tparam     Function    Type of @p function, must take a size_t as first argument and @p
+         *                         Parameters as next arguments
+         * @tparam     Parameters  Type of @p parameters
+         *
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         *
+         * @since      1.4.0
+         */
+        template<typename Function, typename... Parameters>
+        constexpr void iterate_bits_off(Function&& function, Parameters&&... parameters) const;
+
+        /**
+         * @brief      Return a pointer to the underlying array serving as blocks storage.
+         *
+         * @details    The pointer is such that range [@ref data(); @ref data() + @ref num_blocks()) is
+         *             always a valid range, even if the container is empty (@ref data() is not
+         *             dereferenceable in that case).
+         *
+         *
+         * @post       The bits past the end of the @ref sul::dynamic_bitset in the last block are
+         *             guaranteed to be 0s, example:
+         *             @code
+         *             // random bitset of size 11
+         *             std::minstd_rand rand(std::random_device{}());
+         *             std::bernoulli_distribution dist;
+         *             sul::dynamic_bitset<uint8_t> bitset;
+         *             for(size_t i = 0; i < 11; ++i)
+         *             {
+         *                 bitset.push_back(dist(rand));
+         *             }
+         *
+         *             // the bitset use 2 blocks of 8 bits
+         *             // check that unused bits are set to 0
+         *             assert(*(bitset.data() + 1) >> 3 == 0);
+         *             @endcode
+         *
+         * @remark     If the @ref sul::dynamic_bitset is empty, this function may or may not return a
+         *             null pointer.
+         *
+         * @return     A pointer to the underlying array serving as blocks storage
+         *
+         * @complexity Constant.
+         *
+         * @since      1.2.0
+         */
+        [[nodiscard]] constexpr block_type* data() noexcept;
+
+        /**
+         * @brief      Return a pointer to the underlying array serving as blocks storage.
+         *
+         * @details    The pointer is such that range [@ref data(); @ref data() + @ref num_blocks()) is
+         *             always a valid range, even if the container is empty (@ref data() is not
+         *             dereferenceable in that case).
+         *
+         *
+         * @post       The bits past the end of the @ref sul::dynamic_bitset in the last block are
+         *             guaranteed to be 0s, example:
+         *             @code
+         *             // random bitset of size 11
+         *             std::minstd_rand rand(std::random_device{}());
+         *             std::bernoulli_distribution dist;
+         *             sul::dynamic_bitset<uint8_t> bitset;
+         *             for(size_t i = 0; i < 11; ++i)
+         *             {
+         *                 bitset.push_back(dist(rand));
+         *             }
+         *
+         *             // the bitset use 2 blocks of 8 bits
+         *             // check that unused bits are set to 0
+         *             assert(*(bitset.data() + 1) >> 3 == 0);
+         *             @endcode
+         *
+         * @remark     If the @ref sul::dynamic_bitset is empty, this function may or may not return a
+         *             null pointer.
+         *
+         * @return     A pointer to the underlying array serving as blocks storage
+         *
+         * @complexity Constant.
+         *
+         * @since      1.2.0
+         */
+        [[nodiscard]] constexpr const block_type* data() const noexcept;
+
+        /**
+         * @brief      Test if two @ref sul::dynamic_bitset have the same content.
+         *
+         * @param[in]  lhs         The left hand side @ref sul::dynamic_bitset of the operator
+         * @param[in]  rhs         The right hand side @ref sul::dynamic_bitset of the operator
+         *
+         * @tparam     Block_      Block type used by @p lhs and @p rhs for storing the bits
+         * @tparam     Allocator_  Allocator type used by @p lhs and @p rhs for memory management
+         *
+         * @return     @a true if they contain the same bits, @a false otherwise
+         *
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         *
+         * @since      1.0.0
+         */
+        template<typename Block_, typename Allocator_>
+        friend constexpr bool operator==(const dynamic_bitset<Block_, Allocator_>& lhs,
+                                         const dynamic_bitset<Block_, Allocator_>& rhs);
+
+        /**
+         * @brief      Test if @p lhs is "less than" @p rhs. The comparison of the two @ref
+         *             dynamic_bitset is first on numbers their content represent and then on their
+         *             size.
+         *
+         * @details    The size comparison is necessary for the comparison operators to keep their
+         *             properties. For example without the size comparison the "<=" operator (defined
+         *             for "A <= B" by "!(B < A)") would no longer be antisymmetric (if A \<= B and B
+         *             \<= A, then A == B) because @ref operator==() compare the @ref
+         *             sul::dynamic_bitset as a container and not a number. For example with bitsets
+         *             A(0011) and B(011), without the size comparison B \< A would be @a false, A \<= B
+         *             would be @a true, B \<= A would be @a true, but A == B would be @a false,
+         *             breaking the antisymmetric property of the operator. Thus, to respect the
+         *             properties of the operators, the size is used as a secondary criteria for the
+         *             comparison of @ref sul::dynamic_bitset which content represent the same number.
+         *             Therefore, for the previous example with bitsets A(0011) and B(011), B \< A is @a
+         *             true, A \<= B is @a false, B \<= A is @a true and A == B is @a false.\n\n If
+         *             comparing bitsets @a A and @a B with the content of @a A representing the number
+         *             @a a, and the content of @a B representing the number @a b, this operator would
+         *             work as follow:
+         *             @code
+         *             if(a == b)
+         *             {
+         *                 return A.size() < B.size();
+         *             }
+         *             else
+         *             {
+         *                 return a < b;
+         *             }
+         *             @endcode
+         *
+         * @remark     The empty @ref sul::dynamic_bitset is the "lowest" of all bitset and for 0-only
+         *             bitsets comparison, the shortest is the lowest.
+         *
+         * @param[in]  lhs         The left hand side @ref sul::dynamic_bitset of the operator
+         * @param[in]  rhs         The right hand side @ref sul::dynamic_bitset of the operator
+         *
+         * @tparam     Block_      Block type used by @p lhs and @p rhs for storing the bits
+         * @tparam     Allocator_  Allocator type used by @p lhs and @p rhs for memory management
+         *
+         * @return     @a true if @p lhs is "less than" @p rhs
+         *
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         *
+         * @since      1.0.0
+         */
+        template<typename Block_, typename Allocator_>
+        friend constexpr bool operator<(const dynamic_bitset<Block_, Allocator_>& lhs,
+                                        const dynamic_bitset<Block_, Allocator_>& rhs);
+
+#if DYNAMIC_BITSET_CAN_USE_THREE_WAY_COMPARISON
+        /**
+         * @brief      Compare @p lhs and @p rhs in a single pass, with the same order as @ref
+         *             operator<().
+         *
+         * @details    The blocks are compared from the most significant one, by chunks of a cache
+         *             line reduced without branches to find the first different block. Useful when
+         *             sorting or searching bitsets, which otherwise compare them twice with @ref
+         *             operator<() to tell "less than" from "equal".
+         *
+         * @param[in]  lhs         The left hand side @ref sul::dynamic_bitset of the operator
+         * @param[in]  rhs         The right hand side @ref sul::dynamic_bitset of the operator
+         *
+         * @tparam     Block_      Block type used by @p lhs and @p rhs for storing the bits
+         * @tparam     Allocator_  Allocator type used by @p lhs and @p rhs for memory management
+         *
+         * @return     @a std::strong_ordering::less if @p lhs \< @p rhs, @a
+         *             std::strong_ordering::equal if @p lhs == @p rhs, @a
+         *             std::strong_ordering::greater otherwise
+         *
+         * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+         *
+         * @remark     Only available if @a DYNAMIC_BITSET_CAN_USE_THREE_WAY_COMPARISON is @a true
+         *             (C++20 three-way comparison support).
+         *
+         * @since      1.4.0
+         */
+        template<typename Block_, typename Allocator_>
+        friend constexpr std::strong_ordering operator<=>(const dynamic_bitset<Block_, Allocator_>& lhs,
+                                                          const dynamic_bitset<Block_, Allocator_>& rhs);
+#endif
+
+    private:
+        template<typename T>
+        struct dependent_false : public std::false_type
+        {
+        };
+
+        template<typename Allocator_, typename = void>
+        struct allocator_alignment : public std::integral_constant<size_t, alignof(Block)>
+        {
+        };
+
+        template<typename Allocator_>
+        struct allocator_alignment<Allocator_, std::void_t<decltype(Allocator_::alignment)>>
+            : public std::integral_constant<size_t, std::max(Allocator_::alignment, alignof(Block))>
+        {
+        };
+
+        std::vector<Block, Allocator> m_blocks;
+        size_type m_bits_number;
+
+        static constexpr block_type zero_block = block_type(0);
+        static constexpr block_type one_block = block_type(~zero_block);
+        static constexpr size_type block_last_bit_index = bits_per_block - 1;
+        // alignment of the blocks storage, greater than alignof(Block) if guaranteed by the allocator
+        static constexpr size_t storage_alignment = allocator_alignment<Allocator>::value;
+
+        static constexpr size_type blocks_required(size_type nbits) noexcept;
+
+        static constexpr size_type block_index(size_type pos) noexcept;
+        static constexpr size_type bit_index(size_type pos) noexcept;
+
+        static constexpr block_type bit_mask(size_type pos) noexcept;
+        static constexpr block_type bit_mask(size_type first, size_type last) noexcept;
+
+        static constexpr void
+        set_block_bits(block_type& block, size_type first, size_type last, bool val = true) noexcept;
+        static constexpr void flip_block_bits(block_type& block, size_type first, size_type last) noexcept;
+
+        static constexpr size_type block_count(const block_type& block) noexcept;
+        static constexpr size_type block_count(const block_type& block, size_type nbits) noexcept;
+
+        // count the bits on in [pos, pos + len[, len > 0
+        constexpr size_type count_range(size_type pos, size_type len) const;
+        // count the bits on in the blocks [first_block, last_block[
+        constexpr size_type count_blocks(size_type first_block, size_type last_block) const;
+        // first bit on in [pos, pos + len[, npos if none
+        constexpr size_type find_first_in(size_type pos, size_type len) const;
+
+        static constexpr size_type count_block_trailing_zero(const block_type& block) noexcept;
+        static constexpr size_type count_block_leading_zero(const block_type& block) noexcept;
+
+        template<typename T>
+        static constexpr T* assume_aligned(T* blocks) noexcept;
+
+        template<typename _CharT, typename _Traits>
+        constexpr void init_from_string(std::basic_string_view<_CharT, _Traits> str,
+                                        typename std::basic_string_view<_CharT, _Traits>::size_type pos,
+                                        typename std::basic_string_view<_CharT, _Traits>::size_type n,
+                                        _CharT zero,
+                                        _CharT one);
+        // block from the bits_per_block characters at chars, the first one being the most significant bit
+        template<typename _CharT>
+        static constexpr block_type parse_block(const _CharT* chars, _CharT one) noexcept;
+        // value of an hexadecimal digit or base64 character, -1 if invalid
+        static constexpr int hex_digit_value(char c) noexcept;
+        static constexpr int base64_digit_value(char c) noexcept;
+        // resize a decoded bitset to nbits if not npos, throw std::invalid_argument if a bit past nbits is set
+        constexpr void resize_decoded(size_type nbits, const char* function);
+
+        constexpr block_type& get_block(size_type pos);
+        constexpr const block_type& get_block(size_type pos) const;
+        constexpr block_type& last_block();
+        constexpr block_type last_block() const;
+        // inverted block, with the unused bits of the last block kept to 0
+        constexpr block_type inverted_block(size_type index) const;
+
+        // nbits bits starting at pos in the lowest bits of a block, 0 < nbits <= bits_per_block
+        constexpr block_type get_bits(size_type pos, size_type nbits) const noexcept;
+        // apply binary_op to the nbits bits starting at pos and to bits, the nbits bits must be in one block
+        template<typename BinaryOperation>
+        constexpr void
+        apply_bits(size_type pos, size_type nbits, block_type bits, BinaryOperation binary_op) noexcept;
+        // apply binary_op to the bits of dst and src ranges, block by block of dst, memmove-like if overlapping
+        template<typename BinaryOperation>
+        static constexpr void transfer_bits(dynamic_bitset<Block, Allocator>& dst,
+                                            size_type dst_pos,
+                                            const dynamic_bitset<Block, Allocator>& src,
+                                            size_type src_pos,
+                                            size_type len,
+                                            BinaryOperation binary_op);
+        // highest i in [0, blocks_number[ with block_difference(i) != 0, npos if none, the blocks are
+        // checked by chunks OR-reduced without branches, with a single branch per chunk
+        template<typename BlockDifference>
+        static constexpr size_type find_last_different_block(size_type blocks_number,
+                                                             BlockDifference block_difference) noexcept;
+        // negative if lhs < rhs, 0 if lhs == rhs, positive otherwise, see operator<
+        static constexpr int compare(const dynamic_bitset<Block, Allocator>& lhs,
+                                     const dynamic_bitset<Block, Allocator>& rhs) noexcept;
+
+        template<typename Block_, typename Allocator_>
+        friend constexpr void copy_bits(dynamic_bitset<Block_, Allocator_>& dst,
+                                        size_t dst_pos,
+                                        const dynamic_bitset<Block_, Allocator_>& src,
+                                        size_t src_pos,
+                                        size_t len);
+        template<typename Block_, typename Allocator_>
+        friend constexpr void or_bits(dynamic_bitset<Block_, Allocator_>& dst,
+                                      size_t dst_pos,
+                                      const dynamic_bitset<Block_, Allocator_>& src,
+                                      size_t src_pos,
+                                      size_t len);
+        template<typename Block_, typename Allocator_>
+        friend constexpr void and_bits(dynamic_bitset<Block_, Allocator_>& dst,
+                                       size_t dst_pos,
+                                       const dynamic_bitset<Block_, Allocator_>& src,
+                                       size_t src_pos,
+                                       size_t len);
 
         // used bits in the last block
         constexpr size_type extra_bits_number() const noexcept;
@@ -1676,32 +3559,258 @@ namespace sul
         constexpr void apply_left_shift(size_type shift);
         constexpr void apply_right_shift(size_type shift);
 
-        // reset unused bits to 0
-        constexpr void sanitize();
+        // reset unused bits to 0
+        constexpr void sanitize();
+
+        // instrumentation, does nothing if DYNAMIC_BITSET_INSTRUMENTATION is not defined
+        static constexpr void instrument(dynamic_bitset_event event, size_type blocks) noexcept;
+        constexpr size_type instrumented_capacity() const noexcept;
+        constexpr void instrument_reallocation(size_type old_capacity) const noexcept;
+
+        // check functions used in asserts
+        constexpr bool check_unused_bits() const noexcept;
+        constexpr bool check_size() const noexcept;
+        constexpr bool check_consistency() const noexcept;
+    };
+
+    // Deduction guideline for expressions like "dynamic_bitset a(32);" with an integral type as parameter
+    // to use the constructor with the initial size instead of the constructor with the allocator.
+    template<typename integral_type, typename = std::enable_if_t<std::is_integral_v<integral_type>>>
+    dynamic_bitset(integral_type) -> dynamic_bitset<>;
+
+    //=================================================================================================
+    // dynamic_bitset external functions declarations
+    //=================================================================================================
+
+    /**
+     * @brief      Test if two @ref sul::dynamic_bitset content are different.
+     *
+     * @details    Defined as:
+     *             @code
+     *             return !(lhs == rhs);
+     *             @endcode
+     *             see @ref sul::dynamic_bitset::operator==() for more informations.
+     *
+     * @param[in]  lhs        The left hand side @ref sul::dynamic_bitset of the operator
+     * @param[in]  rhs        The right hand side @ref sul::dynamic_bitset of the operator
+     *
+     * @tparam     Block      Block type used by @p lhs and @p rhs for storing the bits
+     * @tparam     Allocator  Allocator type used by @p lhs and @p rhs for memory management
+     *
+     * @return     @a true if they does not contain the same bits, @a false otherwise
+     *
+     * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+     *
+     * @since      1.0.0
+     *
+     * @relatesalso dynamic_bitset
+     */
+    template<typename Block, typename Allocator>
+    constexpr bool operator!=(const dynamic_bitset<Block, Allocator>& lhs, const dynamic_bitset<Block, Allocator>& rhs);
+
+    /**
+     * @brief      Test if @p lhs is "less than or equal to" @p rhs. The comparison of the two @ref
+     *             sul::dynamic_bitset is first on numbers their content represent and then on their size.
+     *
+     * @details    Defined as:
+     *             @code
+     *             return !(rhs < lhs);
+     *             @endcode
+     *             see @ref sul::dynamic_bitset::operator<() for more informations.
+     *
+     * @param[in]  lhs        The left hand side @ref sul::dynamic_bitset of the operator
+     * @param[in]  rhs        The right hand side @ref sul::dynamic_bitset of the operator
+     *
+     * @tparam     Block      Block type used by @p lhs and @p rhs for storing the bits
+     * @tparam     Allocator  Allocator type used by @p lhs and @p rhs for memory management
+     *
+     * @return     @a true if @p lhs is "less than or equal to" @p rhs
+     *
+     * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+     *
+     * @since      1.0.0
+     *
+     * @relatesalso dynamic_bitset
+     */
+    template<typename Block, typename Allocator>
+    constexpr bool operator<=(const dynamic_bitset<Block, Allocator>& lhs, const dynamic_bitset<Block, Allocator>& rhs);
+
+    /**
+     * @brief      Test if @p lhs is "greater than" @p rhs. The comparison of the two @ref
+     *             sul::dynamic_bitset is first on numbers their content represent and then on their
+     *             size.
+     *
+     * @details    Defined as:
+     *             @code
+     *             return rhs < lhs;
+     *             @endcode
+     *             see @ref sul::dynamic_bitset::operator<() for more informations.
+     *
+     * @param[in]  lhs        The left hand side @ref sul::dynamic_bitset of the operator
+     * @param[in]  rhs        The right hand side @ref sul::dynamic_bitset of the operator
+     *
+     * @tparam     Block      Block type used by @p lhs and @p rhs for storing the bits
+     * @tparam     Allocator  Allocator type used by @p lhs and @p rhs for memory management
+     *
+     * @return     @a true if @p lhs is "greater than" @p rhs
+     *
+     * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+     *
+     * @since      1.0.0
+     *
+     * @relatesalso dynamic_bitset
+     */
+    template<typename Block, typename Allocator>
+    constexpr bool operator>(const dynamic_bitset<Block, Allocator>& lhs, const dynamic_bitset<Block, Allocator>& rhs);
+
+    /**
+     * @brief      Test if @p lhs is "greater than or equal to" @p rhs. The comparison of the two @ref
+     *             sul::dynamic_bitset is first on numbers their content represent and then on their
+     *             size.
+     *
+     * @details    Defined as:
+     *             @code
+     *             return !(lhs < rhs);
+     *             @endcode
+     *             see @ref sul::dynamic_bitset::operator<() for more informations.
+     *
+     * @param[in]  lhs        The left hand side @ref sul::dynamic_bitset of the operator
+     * @param[in]  rhs        The right hand side @ref sul::dynamic_bitset of the operator
+     *
+     * @tparam     Block      Block type used by @p lhs and @p rhs for storing the bits
+     * @tparam     Allocator  Allocator type used by @p lhs and @p rhs for memory management
+     *
+     * @return     @a true if @p lhs is "greater than or equal to" @p rhs
+     *
+     * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+     *
+     * @since      1.0.0
+     *
+     * @relatesalso dynamic_bitset
+     */
+    template<typename Block, typename Allocator>
+    constexpr bool operator>=(const dynamic_bitset<Block, Allocator>& lhs, const dynamic_bitset<Block, Allocator>& rhs);
 
-        // check functions used in asserts
-        constexpr bool check_unused_bits() const noexcept;
-        constexpr bool check_size() const noexcept;
-        constexpr bool check_consistency() const noexcept;
-    };
+    /**
+     * @brief      Performs binary AND on corresponding pairs of bits of @p lhs and @p rhs.
+     *
+     * @details    Defined as:
+     *             @code
+     *             dynamic_bitset<Block, Allocator> result(lhs, temporary_allocator(lhs.get_allocator()));
+     *             result &= rhs;
+     *             return result;
+     *             @endcode
+     *             where @a temporary_allocator() gives the allocator of a copy of @p lhs, except for @a
+     *             std::pmr::polymorphic_allocator which keeps the memory resource of @p lhs,
+     *             see @ref sul::dynamic_bitset::operator&=() for more informations.
+     *
+     * @param[in]  lhs        The left hand side @ref sul::dynamic_bitset of the operator
+     * @param[in]  rhs        The right hand side @ref sul::dynamic_bitset of the operator
+     *
+     * @tparam     Block      Block type used by @p lhs and @p rhs for storing the bits
+     * @tparam     Allocator  Allocator type used by @p lhs and @p rhs for memory management
+     *
+     * @return     A @ref sul::dynamic_bitset with each bit being the result of a binary AND between the
+     *             corresponding pair of bits of @p lhs and @p rhs
+     *
+     * @pre        @code
+     *             lhs.size() == rhs.size()
+     *             @endcode
+     *
+     * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+     *
+     * @since      1.0.0
+     *
+     * @relatesalso dynamic_bitset
+     */
+    template<typename Block, typename Allocator>
+    constexpr dynamic_bitset<Block, Allocator> operator&(const dynamic_bitset<Block, Allocator>& lhs,
+                                                         const dynamic_bitset<Block, Allocator>& rhs);
 
-    // Deduction guideline for expressions like "dynamic_bitset a(32);" with an integral type as parameter
-    // to use the constructor with the initial size instead of the constructor with the allocator.
-    template<typename integral_type, typename = std::enable_if_t<std::is_integral_v<integral_type>>>
-    dynamic_bitset(integral_type) -> dynamic_bitset<>;
+    /**
+     * @brief      Performs binary OR on corresponding pairs of bits of @p lhs and @p rhs.
+     *
+     * @details    Defined as:
+     *             @code
+     *             dynamic_bitset<Block, Allocator> result(lhs, temporary_allocator(lhs.get_allocator()));
+     *             result |= rhs;
+     *             return result;
+     *             @endcode
+     *             where @a temporary_allocator() gives the allocator of a copy of @p lhs, except for @a
+     *             std::pmr::polymorphic_allocator which keeps the memory resource of @p lhs,
+     *             see @ref sul::dynamic_bitset::operator|=() for more informations.
+     *
+     * @param[in]  lhs        The left hand side @ref sul::dynamic_bitset of the operator
+     * @param[in]  rhs        The right hand side @ref sul::dynamic_bitset of the operator
+     *
+     * @tparam     Block      Block type used by @p lhs and @p rhs for storing the bits
+     * @tparam     Allocator  Allocator type used by @p lhs and @p rhs for memory management
+     *
+     * @return     A @ref sul::dynamic_bitset with each bit being the result of a binary OR between the
+     *             corresponding pair of bits of @p lhs and @p rhs
+     *
+     * @pre        @code
+     *             lhs.size() == rhs.size()
+     *             @endcode
+     *
+     * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+     *
+     * @since      1.0.0
+     *
+     * @relatesalso dynamic_bitset
+     */
+    template<typename Block, typename Allocator>
+    constexpr dynamic_bitset<Block, Allocator> operator|(const dynamic_bitset<Block, Allocator>& lhs,
+                                                         const dynamic_bitset<Block, Allocator>& rhs);
 
-    //=================================================================================================
-    // dynamic_bitset external functions declarations
-    //=================================================================================================
+    /**
+     * @brief      Performs binary XOR on corresponding pairs of bits of @p lhs and @p rhs.
+     *
+     * @details    Defined as:
+     *             @code
+     *             dynamic_bitset<Block, Allocator> result(lhs, temporary_allocator(lhs.get_allocator()));
+     *             result ^= rhs;
+     *             return result;
+     *             @endcode
+     *             where @a temporary_allocator() gives the allocator of a copy of @p lhs, except for @a
+     *             std::pmr::polymorphic_allocator which keeps the memory resource of @p lhs,
+     *             see @ref sul::dynamic_bitset::operator^=() for more informations.
+     *
+     * @param[in]  lhs        The left hand side @ref sul::dynamic_bitset of the operator
+     * @param[in]  rhs        The right hand side @ref sul::dynamic_bitset of the operator
+     *
+     * @tparam     Block      Block type used by @p lhs and @p rhs for storing the bits
+     * @tparam     Allocator  Allocator type used by @p lhs and @p rhs for memory management
+     *
+     * @return     A @ref sul::dynamic_bitset with each bit being the result of a binary XOR between the
+     *             corresponding pair of bits of @p lhs and @p rhs
+     *
+     * @pre        @code
+     *             lhs.size() == rhs.size()
+     *             @endcode
+     *
+     * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+     *
+     * @since      1.0.0
+     *
+     * @relatesalso dynamic_bitset
+     */
+    template<typename Block, typename Allocator>
+    constexpr dynamic_bitset<Block, Allocator> operator^(const dynamic_bitset<Block, Allocator>& lhs,
+                                                         const dynamic_bitset<Block, Allocator>& rhs);
 
     /**
-     * @brief      Test if two @ref sul::dynamic_bitset content are different.
+     * @brief      Performs binary difference between bits of @p lhs and @p rhs.
      *
      * @details    Defined as:
      *             @code
-     *             return !(lhs == rhs);
+     *             dynamic_bitset<Block, Allocator> result(lhs, temporary_allocator(lhs.get_allocator()));
+     *             result -= rhs;
+     *             return result;
      *             @endcode
-     *             see @ref sul::dynamic_bitset::operator==() for more informations.
+     *             where @a temporary_allocator() gives the allocator of a copy of @p lhs, except for @a
+     *             std::pmr::polymorphic_allocator which keeps the memory resource of @p lhs,
+     *             see @ref sul::dynamic_bitset::operator-=() for more informations.
      *
      * @param[in]  lhs        The left hand side @ref sul::dynamic_bitset of the operator
      * @param[in]  rhs        The right hand side @ref sul::dynamic_bitset of the operator
@@ -1709,7 +3818,12 @@ namespace sul
      * @tparam     Block      Block type used by @p lhs and @p rhs for storing the bits
      * @tparam     Allocator  Allocator type used by @p lhs and @p rhs for memory management
      *
-     * @return     @a true if they does not contain the same bits, @a false otherwise
+     * @return     A @ref sul::dynamic_bitset with each bit being the result of the binary difference
+     *             between the corresponding bits of @p lhs and @p rhs
+     *
+     * @pre        @code
+     *             lhs.size() == rhs.size()
+     *             @endcode
      *
      * @complexity Linear in the size of the @ref sul::dynamic_bitset.
      *
@@ -1718,434 +3832,804 @@ namespace sul
      * @relatesalso dynamic_bitset
      */
     template<typename Block, typename Allocator>
-    constexpr bool operator!=(const dynamic_bitset<Block, Allocator>& lhs, const dynamic_bitset<Block, Allocator>& rhs);
+    constexpr dynamic_bitset<Block, Allocator> operator-(const dynamic_bitset<Block, Allocator>& lhs,
+                                                         const dynamic_bitset<Block, Allocator>& rhs);
+
+    /**
+     * @brief      Format used by the insertion of a @ref sul::dynamic_bitset to a character stream.
+     *
+     * @details    Set on a stream with the @ref binary_bitset(), @ref hex_bitset() and
+     *             @ref base64_bitset() manipulators, @ref bitset_format::binary by default.
+     *
+     * @since      1.4.0
+     */
+    enum class bitset_format : long
+    {
+        binary, ///< Representation of @ref sul::dynamic_bitset::to_string()
+        hex,    ///< Representation of @ref sul::dynamic_bitset::to_hex_string()
+        base64  ///< Representation of @ref sul::dynamic_bitset::to_base64()
+    };
+
+    /**
+     * @brief      Gives the format used by the insertion of a @ref sul::dynamic_bitset to @p str.
+     *
+     * @param[in]  str   Stream to get the format of
+     *
+     * @return     The format set by the last manipulator applied to @p str, @ref
+     *             bitset_format::binary if none
+     *
+     * @complexity Constant.
+     *
+     * @since      1.4.0
+     */
+    [[nodiscard]] inline bitset_format get_bitset_format(std::ios_base& str);
+
+    /**
+     * @brief      Manipulator setting the format of the insertion of a @ref sul::dynamic_bitset to
+     *             @ref bitset_format::binary.
+     *
+     * @param      str   Stream to set the format of
+     *
+     * @return     @p str
+     *
+     * @complexity Constant.
+     *
+     * @since      1.4.0
+     */
+    inline std::ios_base& binary_bitset(std::ios_base& str);
+
+    /**
+     * @brief      Manipulator setting the format of the insertion of a @ref sul::dynamic_bitset to
+     *             @ref bitset_format::hex.
+     *
+     * @param      str   Stream to set the format of
+     *
+     * @return     @p str
+     *
+     * @complexity Constant.
+     *
+     * @since      1.4.0
+     */
+    inline std::ios_base& hex_bitset(std::ios_base& str);
+
+    /**
+     * @brief      Manipulator setting the format of the insertion of a @ref sul::dynamic_bitset to
+     *             @ref bitset_format::base64.
+     *
+     * @param      str   Stream to set the format of
+     *
+     * @return     @p str
+     *
+     * @complexity Constant.
+     *
+     * @since      1.4.0
+     */
+    inline std::ios_base& base64_bitset(std::ios_base& str);
+
+    /**
+     * @brief      Insert a string representation of this @ref sul::dynamic_bitset to a character
+     *             stream.
+     *
+     * @details    The string representation written is the same as if generated with @ref
+     *             sul::dynamic_bitset::to_string() with default parameter, using '1' for @a true bits
+     *             and '0' for @a false bits, or with @ref sul::dynamic_bitset::to_hex_string() or @ref
+     *             sul::dynamic_bitset::to_base64() if the format of @p os was set by @ref hex_bitset()
+     *             or @ref base64_bitset(), see @ref get_bitset_format().
+     *
+     * @param      os         Character stream to write to
+     * @param[in]  bitset     @ref sul::dynamic_bitset to write
+     *
+     * @tparam     _CharT     Character type of the character stream
+     * @tparam     _Traits    Traits class specifying the operations on the character type of the
+     *                        character stream
+     * @tparam     Block      Block type used by @p bitset for storing the bits
+     * @tparam     Allocator  Allocator type used by @p bitset for memory management
+     *
+     * @return     @p os
+     *
+     * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+     *
+     * @since      1.0.0
+     *
+     * @relatesalso dynamic_bitset
+     */
+    template<typename _CharT, typename _Traits, typename Block, typename Allocator>
+    constexpr std::basic_ostream<_CharT, _Traits>& operator<<(std::basic_ostream<_CharT, _Traits>& os,
+                                                              const dynamic_bitset<Block, Allocator>& bitset);
+
+    /**
+     * @brief      Extract a @ref sul::dynamic_bitset from a character stream using its string
+     *             representation.
+     *
+     * @details    The string representation expected is the same as if generated with @ref
+     *             sul::dynamic_bitset::to_string() with default parameter, using '1' for @a true bits
+     *             and '0' for @a false bits. On success the content of @p bitset is cleared before
+     *             writing to it. The extraction starts by skipping leading whitespace then take the
+     *             characters one by one and stop if @p is.good() return @a false or the next character
+     *             is neither _CharT('0') nor _CharT('1').
+     *             The format set by @ref hex_bitset() or @ref base64_bitset() is ignored.
+     *
+     * @param      is         Character stream to read from
+     * @param      bitset     @ref sul::dynamic_bitset to write to
+     *
+     * @tparam     _CharT     Character type of the character stream
+     * @tparam     _Traits    Traits class specifying the operations on the character type of the
+     *                        character stream
+     * @tparam     Block      Block type used by @p bitset for storing the bits
+     * @tparam     Allocator  Allocator type used by @p bitset for memory management
+     *
+     * @return     @p is
+     *
+     * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+     *
+     * @since      1.0.0
+     *
+     * @relatesalso dynamic_bitset
+     */
+    template<typename _CharT, typename _Traits, typename Block, typename Allocator>
+    constexpr std::basic_istream<_CharT, _Traits>& operator>>(std::basic_istream<_CharT, _Traits>& is,
+                                                              dynamic_bitset<Block, Allocator>& bitset);
 
     /**
-     * @brief      Test if @p lhs is "less than or equal to" @p rhs. The comparison of the two @ref
-     *             sul::dynamic_bitset is first on numbers their content represent and then on their size.
+     * @brief      Exchange the content of @p bitset1 and @p bitset2.
      *
      * @details    Defined as:
      *             @code
-     *             return !(rhs < lhs);
+     *             bitset1.swap(bitset2);
      *             @endcode
-     *             see @ref sul::dynamic_bitset::operator<() for more informations.
-     *
-     * @param[in]  lhs        The left hand side @ref sul::dynamic_bitset of the operator
-     * @param[in]  rhs        The right hand side @ref sul::dynamic_bitset of the operator
+     *             see @ref sul::dynamic_bitset::swap() for more informations.
      *
-     * @tparam     Block      Block type used by @p lhs and @p rhs for storing the bits
-     * @tparam     Allocator  Allocator type used by @p lhs and @p rhs for memory management
+     * @param      bitset1    @ref sul::dynamic_bitset to be swapped
+     * @param      bitset2    @ref sul::dynamic_bitset to be swapped
      *
-     * @return     @a true if @p lhs is "less than or equal to" @p rhs
+     * @tparam     Block      Block type used by @p bitset for storing the bits
+     * @tparam     Allocator  Allocator type used by @p bitset for memory management
      *
-     * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+     * @complexity Constant.
      *
      * @since      1.0.0
      *
      * @relatesalso dynamic_bitset
      */
     template<typename Block, typename Allocator>
-    constexpr bool operator<=(const dynamic_bitset<Block, Allocator>& lhs, const dynamic_bitset<Block, Allocator>& rhs);
+    constexpr void swap(dynamic_bitset<Block, Allocator>& bitset1,
+                        dynamic_bitset<Block, Allocator>& bitset2) noexcept(noexcept(bitset1.swap(bitset2)));
 
     /**
-     * @brief      Test if @p lhs is "greater than" @p rhs. The comparison of the two @ref
-     *             sul::dynamic_bitset is first on numbers their content represent and then on their
-     *             size.
+     * @brief      Copy the @p len bits of @p src starting at position @p src_pos to @p dst starting
+     *             at position @p dst_pos.
      *
-     * @details    Defined as:
-     *             @code
-     *             return rhs < lhs;
-     *             @endcode
-     *             see @ref sul::dynamic_bitset::operator<() for more informations.
+     * @details    The bits are transferred by blocks, shifting and merging the blocks of @p src into
+     *             the blocks of @p dst, no temporary @ref sul::dynamic_bitset is created. The bits of
+     *             @p dst outside of the range are not modified. @p dst and @p src can be the same @ref
+     *             sul::dynamic_bitset with overlapping ranges, in which case the result is the same as
+     *             if the bits of @p src were copied to a temporary first.
      *
-     * @param[in]  lhs        The left hand side @ref sul::dynamic_bitset of the operator
-     * @param[in]  rhs        The right hand side @ref sul::dynamic_bitset of the operator
+     * @param      dst        @ref sul::dynamic_bitset to copy the bits to
+     * @param[in]  dst_pos    Position of the first bit of the range of @p dst
+     * @param[in]  src        @ref sul::dynamic_bitset to copy the bits from
+     * @param[in]  src_pos    Position of the first bit of the range of @p src
+     * @param[in]  len        Number of bits to copy
      *
-     * @tparam     Block      Block type used by @p lhs and @p rhs for storing the bits
-     * @tparam     Allocator  Allocator type used by @p lhs and @p rhs for memory management
+     * @tparam     Block      Block type used by @p dst and @p src for storing the bits
+     * @tparam     Allocator  Allocator type used by @p dst and @p src for memory management
      *
-     * @return     @a true if @p lhs is "greater than" @p rhs
+     * @pre        @code
+     *             dst_pos <= dst.size() && len <= dst.size() - dst_pos
+     *             && src_pos <= src.size() && len <= src.size() - src_pos
+     *             @endcode
      *
-     * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+     * @complexity Linear in @p len / @ref sul::dynamic_bitset::bits_per_block.
      *
-     * @since      1.0.0
+     * @since      1.4.0
      *
      * @relatesalso dynamic_bitset
      */
     template<typename Block, typename Allocator>
-    constexpr bool operator>(const dynamic_bitset<Block, Allocator>& lhs, const dynamic_bitset<Block, Allocator>& rhs);
+    constexpr void copy_bits(dynamic_bitset<Block, Allocator>& dst,
+                             size_t dst_pos,
+                             const dynamic_bitset<Block, Allocator>& src,
+                             size_t src_pos,
+                             size_t len);
 
     /**
-     * @brief      Test if @p lhs is "greater than or equal to" @p rhs. The comparison of the two @ref
-     *             sul::dynamic_bitset is first on numbers their content represent and then on their
-     *             size.
+     * @brief      Sets the @p len bits of @p dst starting at position @p dst_pos to the result of
+     *             binary OR with the @p len bits of @p src starting at position @p src_pos.
      *
-     * @details    Defined as:
-     *             @code
-     *             return !(lhs < rhs);
-     *             @endcode
-     *             see @ref sul::dynamic_bitset::operator<() for more informations.
+     * @details    Same as @ref copy_bits() but merging the bits with binary OR instead of
+     *             overwriting them.
      *
-     * @param[in]  lhs        The left hand side @ref sul::dynamic_bitset of the operator
-     * @param[in]  rhs        The right hand side @ref sul::dynamic_bitset of the operator
+     * @param      dst        @ref sul::dynamic_bitset to modify
+     * @param[in]  dst_pos    Position of the first bit of the range of @p dst
+     * @param[in]  src        @ref sul::dynamic_bitset to read the bits from
+     * @param[in]  src_pos    Position of the first bit of the range of @p src
+     * @param[in]  len        Number of bits of the ranges
      *
-     * @tparam     Block      Block type used by @p lhs and @p rhs for storing the bits
-     * @tparam     Allocator  Allocator type used by @p lhs and @p rhs for memory management
+     * @tparam     Block      Block type used by @p dst and @p src for storing the bits
+     * @tparam     Allocator  Allocator type used by @p dst and @p src for memory management
      *
-     * @return     @a true if @p lhs is "greater than or equal to" @p rhs
+     * @pre        @code
+     *             dst_pos <= dst.size() && len <= dst.size() - dst_pos
+     *             && src_pos <= src.size() && len <= src.size() - src_pos
+     *             @endcode
      *
-     * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+     * @complexity Linear in @p len / @ref sul::dynamic_bitset::bits_per_block.
      *
-     * @since      1.0.0
+     * @since      1.4.0
      *
      * @relatesalso dynamic_bitset
      */
     template<typename Block, typename Allocator>
-    constexpr bool operator>=(const dynamic_bitset<Block, Allocator>& lhs, const dynamic_bitset<Block, Allocator>& rhs);
+    constexpr void or_bits(dynamic_bitset<Block, Allocator>& dst,
+                           size_t dst_pos,
+                           const dynamic_bitset<Block, Allocator>& src,
+                           size_t src_pos,
+                           size_t len);
 
     /**
-     * @brief      Performs binary AND on corresponding pairs of bits of @p lhs and @p rhs.
-     *
-     * @details    Defined as:
-     *             @code
-     *             dynamic_bitset<Block, Allocator> result(lhs);
-     *             return result &= rhs;
-     *             @endcode
-     *             see @ref sul::dynamic_bitset::operator&=() for more informations.
+     * @brief      Sets the @p len bits of @p dst starting at position @p dst_pos to the result of
+     *             binary AND with the @p len bits of @p src starting at position @p src_pos.
      *
-     * @param[in]  lhs        The left hand side @ref sul::dynamic_bitset of the operator
-     * @param[in]  rhs        The right hand side @ref sul::dynamic_bitset of the operator
+     * @details    Same as @ref copy_bits() but merging the bits with binary AND instead of
+     *             overwriting them.
      *
-     * @tparam     Block      Block type used by @p lhs and @p rhs for storing the bits
-     * @tparam     Allocator  Allocator type used by @p lhs and @p rhs for memory management
+     * @param      dst        @ref sul::dynamic_bitset to modify
+     * @param[in]  dst_pos    Position of the first bit of the range of @p dst
+     * @param[in]  src        @ref sul::dynamic_bitset to read the bits from
+     * @param[in]  src_pos    Position of the first bit of the range of @p src
+     * @param[in]  len        Number of bits of the ranges
      *
-     * @return     A @ref sul::dynamic_bitset with each bit being the result of a binary AND between the
-     *             corresponding pair of bits of @p lhs and @p rhs
+     * @tparam     Block      Block type used by @p dst and @p src for storing the bits
+     * @tparam     Allocator  Allocator type used by @p dst and @p src for memory management
      *
      * @pre        @code
-     *             lhs.size() == rhs.size()
+     *             dst_pos <= dst.size() && len <= dst.size() - dst_pos
+     *             && src_pos <= src.size() && len <= src.size() - src_pos
      *             @endcode
      *
-     * @complexity Linear in the size of the @ref sul::dynamic_bitset.
+     * @complexity Linear in @p len / @ref sul::dynamic_bitset::bits_per_block.
      *
-     * @since      1.0.0
+     * @since      1.4.0
      *
      * @relatesalso dynamic_bitset
      */
     template<typename Block, typename Allocator>
-    constexpr dynamic_bitset<Block, Allocator> operator&(const dynamic_bitset<Block, Allocator>& lhs,
-                                                         const dynamic_bitset<Block, Allocator>& rhs);
+    constexpr void and_bits(dynamic_bitset<Block, Allocator>& dst,
+                            size_t dst_pos,
+                            const dynamic_bitset<Block, Allocator>& src,
+                            size_t src_pos,
+                            size_t len);
+
+    //=================================================================================================
+    // dynamic_bitset::reference functions implementations
+    //=================================================================================================
+
+    template<typename Block, typename Allocator>
+    constexpr dynamic_bitset<Block, Allocator>::reference::reference(dynamic_bitset<Block, Allocator>& bitset,
+                                                                     size_type bit_pos)
+        : m_block(bitset.get_block(bit_pos))
+        , m_mask(dynamic_bitset<Block, Allocator>::bit_mask(bit_pos))
+    {
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::reference&
+    dynamic_bitset<Block, Allocator>::reference::operator=(bool v)
+    {
+        assign(v);
+        return *this;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::reference&
+    dynamic_bitset<Block, Allocator>::reference::operator=(const dynamic_bitset<Block, Allocator>::reference& rhs)
+    {
+        assign(rhs);
+        return *this;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::reference&
+    dynamic_bitset<Block, Allocator>::reference::operator=(dynamic_bitset::reference&& rhs) noexcept
+    {
+        assign(rhs);
+        return *this;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::reference&
+    dynamic_bitset<Block, Allocator>::reference::operator&=(bool v)
+    {
+        if(!v)
+        {
+            reset();
+        }
+        return *this;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::reference&
+    dynamic_bitset<Block, Allocator>::reference::operator|=(bool v)
+    {
+        if(v)
+        {
+            set();
+        }
+        return *this;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::reference&
+    dynamic_bitset<Block, Allocator>::reference::operator^=(bool v)
+    {
+        if(v)
+        {
+            flip();
+        }
+        return *this;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::reference&
+    dynamic_bitset<Block, Allocator>::reference::operator-=(bool v)
+    {
+        if(v)
+        {
+            reset();
+        }
+        return *this;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr bool dynamic_bitset<Block, Allocator>::reference::operator~() const
+    {
+        return (m_block & m_mask) == zero_block;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr dynamic_bitset<Block, Allocator>::reference::operator bool() const
+    {
+        return (m_block & m_mask) != zero_block;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::reference& dynamic_bitset<Block, Allocator>::reference::set()
+    {
+        m_block |= m_mask;
+        return *this;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::reference& dynamic_bitset<Block, Allocator>::reference::reset()
+    {
+        m_block &= static_cast<block_type>(~m_mask);
+        return *this;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::reference& dynamic_bitset<Block, Allocator>::reference::flip()
+    {
+        m_block ^= m_mask;
+        return *this;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::reference&
+    dynamic_bitset<Block, Allocator>::reference::assign(bool v)
+    {
+        if(v)
+        {
+            set();
+        }
+        else
+        {
+            reset();
+        }
+        return *this;
+    }
+
+    //=================================================================================================
+    // dynamic_bitset::bit_writer functions implementations
+    //=================================================================================================
+
+    template<typename Block, typename Allocator>
+    constexpr dynamic_bitset<Block, Allocator>::bit_writer::bit_writer(dynamic_bitset<Block, Allocator>& bitset)
+        : m_bitset(bitset)
+        , m_buffer_pos(bitset.m_bits_number - bitset.extra_bits_number())
+        , m_buffer(0)
+        , m_buffered_bits(bitset.extra_bits_number())
+    {
+        // the partial last block is the start of the buffer, it stays in the bitset as if flushed
+        if(m_buffered_bits != 0)
+        {
+            m_buffer = buffer_type(bitset.last_block());
+        }
+    }
+
+    template<typename Block, typename Allocator>
+    dynamic_bitset<Block, Allocator>::bit_writer::~bit_writer()
+    {
+        try
+        {
+            flush();
+        }
+        catch(...)
+        {
+            // the bitset keeps the bits of the last successful flush
+        }
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr void dynamic_bitset<Block, Allocator>::bit_writer::write(buffer_type value, size_type nbits)
+    {
+        assert(nbits <= buffer_bits);
+        if(nbits < buffer_bits)
+        {
+            value &= buffer_type((buffer_type(1) << nbits) - 1);
+        }
+
+        const buffer_type buffer = buffer_type(m_buffer | buffer_type(value << m_buffered_bits));
+        const size_type buffered_bits = m_buffered_bits + nbits;
+        if(buffered_bits < buffer_bits)
+        {
+            m_buffer = buffer;
+            m_buffered_bits = buffered_bits;
+            return;
+        }
+
+        // the writer is only modified once the full buffer is transferred
+        write_buffer(buffer);
+        m_buffered_bits = buffered_bits - buffer_bits;
+        m_buffer = m_buffered_bits == 0 ? buffer_type(0) : buffer_type(value >> (nbits - m_buffered_bits));
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr void dynamic_bitset<Block, Allocator>::bit_writer::write(bool value)
+    {
+        write(buffer_type(value), 1);
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr void dynamic_bitset<Block, Allocator>::bit_writer::reserve(size_type nbits)
+    {
+        const size_type old_capacity = m_bitset.instrumented_capacity();
+        m_bitset.m_blocks.reserve(blocks_required(size() + nbits));
+        m_bitset.instrument_reallocation(old_capacity);
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr void dynamic_bitset<Block, Allocator>::bit_writer::flush()
+    {
+        // only the reservation can throw, before the bitset is modified
+        const size_type old_capacity = m_bitset.instrumented_capacity();
+        reserve_blocks(blocks_required(size()));
+        remove_flushed_blocks();
+        for(size_type i = 0; i < m_buffered_bits; i += bits_per_block)
+        {
+            m_bitset.m_blocks.push_back(block_type(m_buffer >> i));
+        }
+        m_bitset.instrument_reallocation(old_capacity);
+        m_bitset.m_bits_number = m_buffer_pos + m_buffered_bits;
+        assert(m_bitset.check_consistency());
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::size_type
+    dynamic_bitset<Block, Allocator>::bit_writer::size() const noexcept
+    {
+        return m_buffer_pos + m_buffered_bits;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr void dynamic_bitset<Block, Allocator>::bit_writer::reserve_blocks(size_type blocks_number)
+    {
+        if(blocks_number > m_bitset.m_blocks.capacity())
+        {
+            m_bitset.m_blocks.reserve(std::max(blocks_number, 2 * m_bitset.m_blocks.capacity()));
+        }
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr void dynamic_bitset<Block, Allocator>::bit_writer::write_buffer(buffer_type buffer)
+    {
+        // only the reservation can throw, before the bitset is modified
+        const size_type old_capacity = m_bitset.instrumented_capacity();
+        reserve_blocks(block_index(m_buffer_pos) + buffer_bits / bits_per_block);
+        remove_flushed_blocks();
+        if constexpr(buffer_bits == bits_per_block)
+        {
+            m_bitset.m_blocks.push_back(block_type(buffer));
+        }
+        else
+        {
+            for(size_type i = 0; i < buffer_bits; i += bits_per_block)
+            {
+                m_bitset.m_blocks.push_back(block_type(buffer >> i));
+            }
+        }
+        m_bitset.instrument_reallocation(old_capacity);
+        m_buffer_pos += buffer_bits;
+        m_bitset.m_bits_number = m_buffer_pos;
+    }
 
-    /**
-     * @brief      Performs binary OR on corresponding pairs of bits of @p lhs and @p rhs.
-     *
-     * @details    Defined as:
-     *             @code
-     *             dynamic_bitset<Block, Allocator> result(lhs);
-     *             return result |= rhs;
-     *             @endcode
-     *             see @ref sul::dynamic_bitset::operator|=() for more informations.
-     *
-     * @param[in]  lhs        The left hand side @ref sul::dynamic_bitset of the operator
-     * @param[in]  rhs        The right hand side @ref sul::dynamic_bitset of the operator
-     *
-     * @tparam     Block      Block type used by @p lhs and @p rhs for storing the bits
-     * @tparam     Allocator  Allocator type used by @p lhs and @p rhs for memory management
-     *
-     * @return     A @ref sul::dynamic_bitset with each bit being the result of a binary OR between the
-     *             corresponding pair of bits of @p lhs and @p rhs
-     *
-     * @pre        @code
-     *             lhs.size() == rhs.size()
-     *             @endcode
-     *
-     * @complexity Linear in the size of the @ref sul::dynamic_bitset.
-     *
-     * @since      1.0.0
-     *
-     * @relatesalso dynamic_bitset
-     */
     template<typename Block, typename Allocator>
-    constexpr dynamic_bitset<Block, Allocator> operator|(const dynamic_bitset<Block, Allocator>& lhs,
-                                                         const dynamic_bitset<Block, Allocator>& rhs);
+    constexpr void dynamic_bitset<Block, Allocator>::bit_writer::remove_flushed_blocks()
+    {
+        const size_type buffer_block = block_index(m_buffer_pos);
+        if(m_bitset.m_blocks.size() != buffer_block)
+        {
+            assert(m_bitset.m_blocks.size() > buffer_block);
+            m_bitset.m_blocks.resize(buffer_block);
+        }
+    }
+
+    //=================================================================================================
+    // dynamic_bitset::bit_reader functions implementations
+    //=================================================================================================
 
-    /**
-     * @brief      Performs binary XOR on corresponding pairs of bits of @p lhs and @p rhs.
-     *
-     * @details    Defined as:
-     *             @code
-     *             dynamic_bitset<Block, Allocator> result(lhs);
-     *             return result ^= rhs;
-     *             @endcode
-     *             see @ref sul::dynamic_bitset::operator^=() for more informations.
-     *
-     * @param[in]  lhs        The left hand side @ref sul::dynamic_bitset of the operator
-     * @param[in]  rhs        The right hand side @ref sul::dynamic_bitset of the operator
-     *
-     * @tparam     Block      Block type used by @p lhs and @p rhs for storing the bits
-     * @tparam     Allocator  Allocator type used by @p lhs and @p rhs for memory management
-     *
-     * @return     A @ref sul::dynamic_bitset with each bit being the result of a binary XOR between the
-     *             corresponding pair of bits of @p lhs and @p rhs
-     *
-     * @pre        @code
-     *             lhs.size() == rhs.size()
-     *             @endcode
-     *
-     * @complexity Linear in the size of the @ref sul::dynamic_bitset.
-     *
-     * @since      1.0.0
-     *
-     * @relatesalso dynamic_bitset
-     */
     template<typename Block, typename Allocator>
-    constexpr dynamic_bitset<Block, Allocator> operator^(const dynamic_bitset<Block, Allocator>& lhs,
-                                                         const dynamic_bitset<Block, Allocator>& rhs);
+    constexpr dynamic_bitset<Block, Allocator>::bit_reader::bit_reader(const dynamic_bitset<Block, Allocator>& bitset,
+                                                                       size_type pos)
+        : m_bitset(bitset)
+        , m_next_block(block_index(pos))
+        , m_buffer(0)
+        , m_buffered_bits(0)
+    {
+        assert(pos <= bitset.size());
+        // the buffer starts with the end of the first block, next refills are aligned on blocks
+        if(pos < bitset.size())
+        {
+            const size_type offset = bit_index(pos);
+            m_buffer = buffer_type(bitset.m_blocks[m_next_block] >> offset);
+            m_buffered_bits = std::min(bits_per_block, bitset.size() - m_next_block * bits_per_block) - offset;
+            ++m_next_block;
+        }
+        else
+        {
+            m_next_block = bitset.m_blocks.size();
+        }
+    }
 
-    /**
-     * @brief      Performs binary difference between bits of @p lhs and @p rhs.
-     *
-     * @details    Defined as:
-     *             @code
-     *             dynamic_bitset<Block, Allocator> result(lhs);
-     *             return result -= rhs;
-     *             @endcode
-     *             see @ref sul::dynamic_bitset::operator-=() for more informations.
-     *
-     * @param[in]  lhs        The left hand side @ref sul::dynamic_bitset of the operator
-     * @param[in]  rhs        The right hand side @ref sul::dynamic_bitset of the operator
-     *
-     * @tparam     Block      Block type used by @p lhs and @p rhs for storing the bits
-     * @tparam     Allocator  Allocator type used by @p lhs and @p rhs for memory management
-     *
-     * @return     A @ref sul::dynamic_bitset with each bit being the result of the binary difference
-     *             between the corresponding bits of @p lhs and @p rhs
-     *
-     * @pre        @code
-     *             lhs.size() == rhs.size()
-     *             @endcode
-     *
-     * @complexity Linear in the size of the @ref sul::dynamic_bitset.
-     *
-     * @since      1.0.0
-     *
-     * @relatesalso dynamic_bitset
-     */
     template<typename Block, typename Allocator>
-    constexpr dynamic_bitset<Block, Allocator> operator-(const dynamic_bitset<Block, Allocator>& lhs,
-                                                         const dynamic_bitset<Block, Allocator>& rhs);
+    constexpr typename dynamic_bitset<Block, Allocator>::bit_reader::buffer_type
+    dynamic_bitset<Block, Allocator>::bit_reader::read(size_type nbits)
+    {
+        assert(nbits <= buffer_bits && nbits <= remaining());
+        if(nbits <= m_buffered_bits)
+        {
+            if(nbits == buffer_bits)
+            {
+                const buffer_type value = m_buffer;
+                m_buffer = 0;
+                m_buffered_bits = 0;
+                return value;
+            }
+            const buffer_type value = buffer_type(m_buffer & ((buffer_type(1) << nbits) - 1));
+            m_buffer = buffer_type(m_buffer >> nbits);
+            m_buffered_bits -= nbits;
+            return value;
+        }
 
-    /**
-     * @brief      Insert a string representation of this @ref sul::dynamic_bitset to a character
-     *             stream.
-     *
-     * @details    The string representation written is the same as if generated with @ref
-     *             sul::dynamic_bitset::to_string() with default parameter, using '1' for @a true bits
-     *             and '0' for @a false bits.
-     *
-     * @param      os         Character stream to write to
-     * @param[in]  bitset     @ref sul::dynamic_bitset to write
-     *
-     * @tparam     _CharT     Character type of the character stream
-     * @tparam     _Traits    Traits class specifying the operations on the character type of the
-     *                        character stream
-     * @tparam     Block      Block type used by @p bitset for storing the bits
-     * @tparam     Allocator  Allocator type used by @p bitset for memory management
-     *
-     * @return     @p os
-     *
-     * @complexity Linear in the size of the @ref sul::dynamic_bitset.
-     *
-     * @since      1.0.0
-     *
-     * @relatesalso dynamic_bitset
-     */
-    template<typename _CharT, typename _Traits, typename Block, typename Allocator>
-    constexpr std::basic_ostream<_CharT, _Traits>& operator<<(std::basic_ostream<_CharT, _Traits>& os,
-                                                              const dynamic_bitset<Block, Allocator>& bitset);
+        // the buffered bits are the lowest bits of the value, the others are the first refilled bits
+        buffer_type value = m_buffer;
+        const size_type buffered_bits = m_buffered_bits;
+        const size_type missing_bits = nbits - buffered_bits;
+        const size_type loaded_bits = refill();
+        assert(loaded_bits >= missing_bits);
+        if(missing_bits == buffer_bits)
+        {
+            value = m_buffer;
+            m_buffer = 0;
+        }
+        else
+        {
+            value |= buffer_type((m_buffer & ((buffer_type(1) << missing_bits) - 1)) << buffered_bits);
+            m_buffer = buffer_type(m_buffer >> missing_bits);
+        }
+        m_buffered_bits = loaded_bits - missing_bits;
+        return value;
+    }
 
-    /**
-     * @brief      Extract a @ref sul::dynamic_bitset from a character stream using its string
-     *             representation.
-     *
-     * @details    The string representation expected is the same as if generated with @ref
-     *             sul::dynamic_bitset::to_string() with default parameter, using '1' for @a true bits
-     *             and '0' for @a false bits. On success the content of @p bitset is cleared before
-     *             writing to it. The extraction starts by skipping leading whitespace then take the
-     *             characters one by one and stop if @p is.good() return @a false or the next character
-     *             is neither _CharT('0') nor _CharT('1').
-     *
-     * @param      is         Character stream to read from
-     * @param      bitset     @ref sul::dynamic_bitset to write to
-     *
-     * @tparam     _CharT     Character type of the character stream
-     * @tparam     _Traits    Traits class specifying the operations on the character type of the
-     *                        character stream
-     * @tparam     Block      Block type used by @p bitset for storing the bits
-     * @tparam     Allocator  Allocator type used by @p bitset for memory management
-     *
-     * @return     @p is
-     *
-     * @complexity Linear in the size of the @ref sul::dynamic_bitset.
-     *
-     * @since      1.0.0
-     *
-     * @relatesalso dynamic_bitset
-     */
-    template<typename _CharT, typename _Traits, typename Block, typename Allocator>
-    constexpr std::basic_istream<_CharT, _Traits>& operator>>(std::basic_istream<_CharT, _Traits>& is,
-                                                              dynamic_bitset<Block, Allocator>& bitset);
+    template<typename Block, typename Allocator>
+    constexpr bool dynamic_bitset<Block, Allocator>::bit_reader::read()
+    {
+        return read(1) != 0;
+    }
 
-    /**
-     * @brief      Exchange the content of @p bitset1 and @p bitset2.
-     *
-     * @details    Defined as:
-     *             @code
-     *             bitset1.swap(bitset2);
-     *             @endcode
-     *             see @ref sul::dynamic_bitset::swap() for more informations.
-     *
-     * @param      bitset1    @ref sul::dynamic_bitset to be swapped
-     * @param      bitset2    @ref sul::dynamic_bitset to be swapped
-     *
-     * @tparam     Block      Block type used by @p bitset for storing the bits
-     * @tparam     Allocator  Allocator type used by @p bitset for memory management
-     *
-     * @complexity Constant.
-     *
-     * @since      1.0.0
-     *
-     * @relatesalso dynamic_bitset
-     */
     template<typename Block, typename Allocator>
-    constexpr void swap(dynamic_bitset<Block, Allocator>& bitset1,
-                        dynamic_bitset<Block, Allocator>& bitset2) noexcept(noexcept(bitset1.swap(bitset2)));
+    constexpr typename dynamic_bitset<Block, Allocator>::size_type
+    dynamic_bitset<Block, Allocator>::bit_reader::position() const noexcept
+    {
+        return std::min(m_next_block * bits_per_block, m_bitset.size()) - m_buffered_bits;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::size_type
+    dynamic_bitset<Block, Allocator>::bit_reader::remaining() const noexcept
+    {
+        return m_bitset.size() - position();
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::size_type
+    dynamic_bitset<Block, Allocator>::bit_reader::refill()
+    {
+        constexpr size_type buffer_blocks = buffer_bits / bits_per_block;
+        const size_type blocks = std::min(buffer_blocks, m_bitset.m_blocks.size() - m_next_block);
+        m_buffer = buffer_type(m_bitset.m_blocks[m_next_block]);
+        for(size_type i = 1; i < blocks; ++i)
+        {
+            m_buffer |= buffer_type(buffer_type(m_bitset.m_blocks[m_next_block + i]) << (i * bits_per_block));
+        }
+        const size_type loaded_bits =
+          std::min(blocks * bits_per_block, m_bitset.size() - m_next_block * bits_per_block);
+        m_next_block += blocks;
+        return loaded_bits;
+    }
 
     //=================================================================================================
-    // dynamic_bitset::reference functions implementations
+    // dynamic_bitset::const_slice_view functions implementations
     //=================================================================================================
 
     template<typename Block, typename Allocator>
-    constexpr dynamic_bitset<Block, Allocator>::reference::reference(dynamic_bitset<Block, Allocator>& bitset,
-                                                                     size_type bit_pos)
-        : m_block(bitset.get_block(bit_pos))
-        , m_mask(dynamic_bitset<Block, Allocator>::bit_mask(bit_pos))
+    constexpr dynamic_bitset<Block, Allocator>::const_slice_view::const_slice_view(
+      const dynamic_bitset<Block, Allocator>& bitset,
+      size_type pos,
+      size_type len)
+        : m_bitset(&bitset)
+        , m_pos(pos)
+        , m_len(len)
+    {
+        assert(pos <= bitset.size() && len <= bitset.size() - pos);
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::size_type
+    dynamic_bitset<Block, Allocator>::const_slice_view::size() const noexcept
+    {
+        return m_len;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr bool dynamic_bitset<Block, Allocator>::const_slice_view::empty() const noexcept
+    {
+        return m_len == 0;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::size_type
+    dynamic_bitset<Block, Allocator>::const_slice_view::offset() const noexcept
+    {
+        return m_pos;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr bool dynamic_bitset<Block, Allocator>::const_slice_view::test(size_type pos) const
+    {
+        assert(pos < m_len);
+        return m_bitset->test(m_pos + pos);
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::const_reference
+    dynamic_bitset<Block, Allocator>::const_slice_view::operator[](size_type pos) const
+    {
+        return test(pos);
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::size_type
+    dynamic_bitset<Block, Allocator>::const_slice_view::count() const
     {
+        return m_bitset->count(m_pos, m_len);
     }
 
     template<typename Block, typename Allocator>
-    constexpr typename dynamic_bitset<Block, Allocator>::reference&
-    dynamic_bitset<Block, Allocator>::reference::operator=(bool v)
+    constexpr bool dynamic_bitset<Block, Allocator>::const_slice_view::all() const
     {
-        assign(v);
-        return *this;
+        return m_bitset->all(m_pos, m_len);
     }
 
     template<typename Block, typename Allocator>
-    constexpr typename dynamic_bitset<Block, Allocator>::reference&
-    dynamic_bitset<Block, Allocator>::reference::operator=(const dynamic_bitset<Block, Allocator>::reference& rhs)
+    constexpr bool dynamic_bitset<Block, Allocator>::const_slice_view::any() const
     {
-        assign(rhs);
-        return *this;
+        return m_bitset->any(m_pos, m_len);
     }
 
     template<typename Block, typename Allocator>
-    constexpr typename dynamic_bitset<Block, Allocator>::reference&
-    dynamic_bitset<Block, Allocator>::reference::operator=(dynamic_bitset::reference&& rhs) noexcept
+    constexpr bool dynamic_bitset<Block, Allocator>::const_slice_view::none() const
     {
-        assign(rhs);
-        return *this;
+        return m_bitset->none(m_pos, m_len);
     }
 
     template<typename Block, typename Allocator>
-    constexpr typename dynamic_bitset<Block, Allocator>::reference&
-    dynamic_bitset<Block, Allocator>::reference::operator&=(bool v)
+    constexpr typename dynamic_bitset<Block, Allocator>::size_type
+    dynamic_bitset<Block, Allocator>::const_slice_view::find_first() const
     {
-        if(!v)
-        {
-            reset();
-        }
-        return *this;
+        const size_type first = m_bitset->find_first_in(m_pos, m_len);
+        return first == npos ? npos : first - m_pos;
     }
 
     template<typename Block, typename Allocator>
-    constexpr typename dynamic_bitset<Block, Allocator>::reference&
-    dynamic_bitset<Block, Allocator>::reference::operator|=(bool v)
+    constexpr typename dynamic_bitset<Block, Allocator>::size_type
+    dynamic_bitset<Block, Allocator>::const_slice_view::find_next(size_type prev) const
     {
-        if(v)
+        if(m_len == 0 || prev >= m_len - 1)
         {
-            set();
+            return npos;
         }
-        return *this;
+        const size_type next = m_bitset->find_first_in(m_pos + prev + 1, m_len - prev - 1);
+        return next == npos ? npos : next - m_pos;
     }
 
+    //=================================================================================================
+    // dynamic_bitset::slice_view functions implementations
+    //=================================================================================================
+
     template<typename Block, typename Allocator>
-    constexpr typename dynamic_bitset<Block, Allocator>::reference&
-    dynamic_bitset<Block, Allocator>::reference::operator^=(bool v)
+    constexpr dynamic_bitset<Block, Allocator>::slice_view::slice_view(dynamic_bitset<Block, Allocator>& bitset,
+                                                                       size_type pos,
+                                                                       size_type len)
+        : const_slice_view(bitset, pos, len)
+        , m_mutable_bitset(&bitset)
     {
-        if(v)
-        {
-            flip();
-        }
-        return *this;
     }
 
     template<typename Block, typename Allocator>
-    constexpr typename dynamic_bitset<Block, Allocator>::reference&
-    dynamic_bitset<Block, Allocator>::reference::operator-=(bool v)
+    constexpr typename dynamic_bitset<Block, Allocator>::reference
+    dynamic_bitset<Block, Allocator>::slice_view::operator[](size_type pos)
     {
-        if(v)
-        {
-            reset();
-        }
-        return *this;
+        assert(pos < this->m_len);
+        return (*m_mutable_bitset)[this->m_pos + pos];
     }
 
     template<typename Block, typename Allocator>
-    constexpr bool dynamic_bitset<Block, Allocator>::reference::operator~() const
+    constexpr typename dynamic_bitset<Block, Allocator>::slice_view&
+    dynamic_bitset<Block, Allocator>::slice_view::set(size_type pos, bool value)
     {
-        return (m_block & m_mask) == zero_block;
+        assert(pos < this->m_len);
+        m_mutable_bitset->set(this->m_pos + pos, value);
+        return *this;
     }
 
     template<typename Block, typename Allocator>
-    constexpr dynamic_bitset<Block, Allocator>::reference::operator bool() const
+    constexpr typename dynamic_bitset<Block, Allocator>::slice_view& dynamic_bitset<Block, Allocator>::slice_view::set()
     {
-        return (m_block & m_mask) != zero_block;
+        m_mutable_bitset->set(this->m_pos, this->m_len, true);
+        return *this;
     }
 
     template<typename Block, typename Allocator>
-    constexpr typename dynamic_bitset<Block, Allocator>::reference& dynamic_bitset<Block, Allocator>::reference::set()
+    constexpr typename dynamic_bitset<Block, Allocator>::slice_view&
+    dynamic_bitset<Block, Allocator>::slice_view::reset(size_type pos)
     {
-        m_block |= m_mask;
+        assert(pos < this->m_len);
+        m_mutable_bitset->reset(this->m_pos + pos);
         return *this;
     }
 
     template<typename Block, typename Allocator>
-    constexpr typename dynamic_bitset<Block, Allocator>::reference& dynamic_bitset<Block, Allocator>::reference::reset()
+    constexpr typename dynamic_bitset<Block, Allocator>::slice_view&
+    dynamic_bitset<Block, Allocator>::slice_view::reset()
     {
-        m_block &= static_cast<block_type>(~m_mask);
+        m_mutable_bitset->reset(this->m_pos, this->m_len);
         return *this;
     }
 
     template<typename Block, typename Allocator>
-    constexpr typename dynamic_bitset<Block, Allocator>::reference& dynamic_bitset<Block, Allocator>::reference::flip()
+    constexpr typename dynamic_bitset<Block, Allocator>::slice_view&
+    dynamic_bitset<Block, Allocator>::slice_view::flip(size_type pos)
     {
-        m_block ^= m_mask;
+        assert(pos < this->m_len);
+        m_mutable_bitset->flip(this->m_pos + pos);
         return *this;
     }
 
     template<typename Block, typename Allocator>
-    constexpr typename dynamic_bitset<Block, Allocator>::reference&
-    dynamic_bitset<Block, Allocator>::reference::assign(bool v)
+    constexpr typename dynamic_bitset<Block, Allocator>::slice_view&
+    dynamic_bitset<Block, Allocator>::slice_view::flip()
     {
-        if(v)
-        {
-            set();
-        }
-        else
-        {
-            reset();
-        }
+        m_mutable_bitset->flip(this->m_pos, this->m_len);
         return *this;
     }
 
@@ -2153,6 +4637,20 @@ namespace sul
     // dynamic_bitset public functions implementations
     //=================================================================================================
 
+    template<typename Block, typename Allocator>
+    constexpr dynamic_bitset<Block, Allocator>::dynamic_bitset(const dynamic_bitset<Block, Allocator>& other,
+                                                               const allocator_type& allocator)
+        : m_blocks(other.m_blocks, allocator), m_bits_number(other.m_bits_number)
+    {
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr dynamic_bitset<Block, Allocator>::dynamic_bitset(dynamic_bitset<Block, Allocator>&& other,
+                                                               const allocator_type& allocator)
+        : m_blocks(std::move(other.m_blocks), allocator), m_bits_number(other.m_bits_number)
+    {
+    }
+
     template<typename Block, typename Allocator>
     constexpr dynamic_bitset<Block, Allocator>::dynamic_bitset(const allocator_type& allocator)
         : m_blocks(allocator)
@@ -2164,9 +4662,10 @@ namespace sul
     constexpr dynamic_bitset<Block, Allocator>::dynamic_bitset(size_type nbits,
                                                                unsigned long long init_val,
                                                                const allocator_type& allocator)
-        : m_blocks(blocks_required(nbits), allocator)
+        : m_blocks(blocks_required(nbits), zero_block, allocator)
         , m_bits_number(nbits)
     {
+        instrument_reallocation(0);
         if(nbits == 0 || init_val == 0)
         {
             return;
@@ -2245,6 +4744,80 @@ namespace sul
         init_from_string(std::basic_string_view<_CharT, _Traits>(str), pos, n, zero, one);
     }
 
+    template<typename Block, typename Allocator>
+    template<size_t N>
+    constexpr dynamic_bitset<Block, Allocator>::dynamic_bitset(const std::bitset<N>& bitset,
+                                                               const allocator_type& allocator)
+        : m_blocks(blocks_required(N), zero_block, allocator)
+        , m_bits_number(N)
+    {
+        instrument_reallocation(0);
+#if DYNAMIC_BITSET_CAN_COPY_STD_BITSET_WORDS
+        if constexpr(N > 0 && std::is_trivially_copyable_v<std::bitset<N>>)
+        {
+#    if defined(__cpp_lib_is_constant_evaluated)
+            if(!std::is_constant_evaluated())
+#    endif
+            {
+                // the bits of the words past N are 0s
+                std::memcpy(m_blocks.data(),
+                            std::addressof(bitset),
+                            std::min(sizeof(bitset), m_blocks.size() * sizeof(block_type)));
+                return;
+            }
+        }
+#endif
+        for(size_type i = 0; i < N; ++i)
+        {
+            if(bitset[i])
+            {
+                m_blocks[block_index(i)] |= bit_mask(i);
+            }
+        }
+    }
+
+    template<typename Block, typename Allocator>
+    template<typename _Alloc>
+    constexpr dynamic_bitset<Block, Allocator>::dynamic_bitset(const std::vector<bool, _Alloc>& vector,
+                                                               const allocator_type& allocator)
+        : m_blocks(blocks_required(vector.size()), zero_block, allocator)
+        , m_bits_number(vector.size())
+    {
+        instrument_reallocation(0);
+        if(vector.empty())
+        {
+            return;
+        }
+
+#if DYNAMIC_BITSET_CAN_COPY_VECTOR_BOOL_WORDS
+#    if defined(__cpp_lib_is_constant_evaluated)
+        if(!std::is_constant_evaluated())
+#    endif
+        {
+            // the words are contiguous, starting at the word of the begin iterator, the bits past the end are
+            // unspecified
+            typedef std::remove_pointer_t<decltype(vector.begin()._M_p)> word_type;
+            constexpr size_type bits_per_word = std::numeric_limits<word_type>::digits;
+            const size_type words_number =
+              vector.size() / bits_per_word + (vector.size() % bits_per_word == 0 ? 0 : 1);
+            std::memcpy(m_blocks.data(),
+                        vector.begin()._M_p,
+                        std::min(words_number * sizeof(word_type), m_blocks.size() * sizeof(block_type)));
+            sanitize();
+            return;
+        }
+#endif
+        size_type i = 0;
+        for(const bool value: vector)
+        {
+            if(value)
+            {
+                m_blocks[block_index(i)] |= bit_mask(i);
+            }
+            ++i;
+        }
+    }
+
     template<typename Block, typename Allocator>
     constexpr void dynamic_bitset<Block, Allocator>::resize(size_type nbits, bool value)
     {
@@ -2259,8 +4832,11 @@ namespace sul
         const block_type init_value = value ? one_block : zero_block;
         if(new_num_blocks != old_num_blocks)
         {
+            const size_type old_capacity = instrumented_capacity();
             m_blocks.resize(new_num_blocks, init_value);
+            instrument_reallocation(old_capacity);
         }
+        instrument(dynamic_bitset_event::resize, new_num_blocks);
 
         if(value && nbits > m_bits_number && old_num_blocks > 0)
         {
@@ -2277,6 +4853,31 @@ namespace sul
         assert(check_consistency());
     }
 
+    template<typename Block, typename Allocator>
+    constexpr void dynamic_bitset<Block, Allocator>::resize_for_overwrite(size_type nbits)
+    {
+        if(nbits == m_bits_number)
+        {
+            return;
+        }
+
+        const size_type old_num_blocks = num_blocks();
+        const size_type new_num_blocks = blocks_required(nbits);
+
+        if(new_num_blocks != old_num_blocks)
+        {
+            const size_type old_capacity = instrumented_capacity();
+            m_blocks.resize(new_num_blocks);
+            instrument_reallocation(old_capacity);
+        }
+        instrument(dynamic_bitset_event::resize, new_num_blocks);
+
+        // the new blocks are not initialized, only the unused bits of the last one are reset
+        m_bits_number = nbits;
+        sanitize();
+        assert(check_consistency());
+    }
+
     template<typename Block, typename Allocator>
     constexpr void dynamic_bitset<Block, Allocator>::clear()
     {
@@ -2297,7 +4898,9 @@ namespace sul
         }
         else
         {
+            const size_type old_capacity = instrumented_capacity();
             m_blocks.push_back(block_type(value));
+            instrument_reallocation(old_capacity);
         }
         assert(operator[](new_last_bit) == value);
         assert(check_consistency());
@@ -2328,6 +4931,7 @@ namespace sul
     template<typename Block, typename Allocator>
     constexpr void dynamic_bitset<Block, Allocator>::append(block_type block)
     {
+        const size_type old_capacity = instrumented_capacity();
         const size_type extra_bits = extra_bits_number();
         if(extra_bits == 0)
         {
@@ -2338,6 +4942,7 @@ namespace sul
             last_block() |= static_cast<block_type>(block << extra_bits);
             m_blocks.push_back(block_type(block >> (bits_per_block - extra_bits)));
         }
+        instrument_reallocation(old_capacity);
 
         m_bits_number += bits_per_block;
         assert(check_consistency());
@@ -2363,6 +4968,8 @@ namespace sul
             return;
         }
 
+        const size_type old_capacity = instrumented_capacity();
+
         // if random access iterators, std::distance complexity is constant
         if constexpr(std::is_same_v<typename std::iterator_traits<BlockInputIterator>::iterator_category,
                                     std::random_access_iterator_tag>)
@@ -2395,20 +5002,110 @@ namespace sul
             m_blocks.push_back(block);
             m_bits_number += bits_per_block;
         }
+        instrument_reallocation(old_capacity);
+
+        assert(check_consistency());
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr void dynamic_bitset<Block, Allocator>::append(const dynamic_bitset<Block, Allocator>& bitset)
+    {
+        if(bitset.empty())
+        {
+            return;
+        }
+
+        // bitset can be *this, its size and blocks are read before being modified
+        const size_type bitset_bits_number = bitset.m_bits_number;
+        const size_type bitset_blocks_number = bitset.m_blocks.size();
+        const size_type new_bits_number = m_bits_number + bitset_bits_number;
+
+        const size_type old_capacity = instrumented_capacity();
+        m_blocks.reserve(blocks_required(new_bits_number));
+
+        const size_type extra_bits = extra_bits_number();
+        if(extra_bits == 0)
+        {
+            for(size_type i = 0; i < bitset_blocks_number; ++i)
+            {
+                m_blocks.push_back(bitset.m_blocks[i]);
+            }
+        }
+        else
+        {
+            const size_type unused_bits = unused_bits_number();
+            const block_type bitset_last_block = bitset.m_blocks[bitset_blocks_number - 1];
+            block_type block = bitset.m_blocks[0];
+            last_block() |= block_type(block << extra_bits);
+            for(size_type i = 1; i < bitset_blocks_number; ++i)
+            {
+                const block_type next_block = i == bitset_blocks_number - 1 ? bitset_last_block : bitset.m_blocks[i];
+                m_blocks.push_back(block_type(block_type(block >> unused_bits) | block_type(next_block << extra_bits)));
+                block = next_block;
+            }
+            if(m_blocks.size() < blocks_required(new_bits_number))
+            {
+                m_blocks.push_back(block_type(block >> unused_bits));
+            }
+        }
+        instrument_reallocation(old_capacity);
 
+        m_bits_number = new_bits_number;
         assert(check_consistency());
     }
 
+    template<typename Block, typename Allocator>
+    constexpr void dynamic_bitset<Block, Allocator>::append(dynamic_bitset<Block, Allocator>&& bitset)
+    {
+        if(empty() && &bitset != this)
+        {
+            *this = std::move(bitset);
+            return;
+        }
+        append(static_cast<const dynamic_bitset<Block, Allocator>&>(bitset));
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr void dynamic_bitset<Block, Allocator>::insert(size_type pos, size_type len, bool value)
+    {
+        assert(pos <= size());
+        if(len == 0)
+        {
+            return;
+        }
+
+        const size_type moved_bits = m_bits_number - pos;
+        resize(m_bits_number + len);
+        copy_bits(*this, pos + len, *this, pos, moved_bits);
+        set(pos, len, value);
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr void dynamic_bitset<Block, Allocator>::erase(size_type pos, size_type len)
+    {
+        assert(pos <= size() && len <= size() - pos);
+        if(len == 0)
+        {
+            return;
+        }
+
+        copy_bits(*this, pos, *this, pos + len, m_bits_number - pos - len);
+        resize(m_bits_number - len);
+    }
+
     template<typename Block, typename Allocator>
     constexpr dynamic_bitset<Block, Allocator>&
     dynamic_bitset<Block, Allocator>::operator&=(const dynamic_bitset<Block, Allocator>& rhs)
     {
         assert(size() == rhs.size());
         // apply(rhs, std::bit_and());
+        block_type* const blocks = assume_aligned(m_blocks.data());
+        const block_type* const rhs_blocks = assume_aligned(rhs.m_blocks.data());
         for(size_type i = 0; i < m_blocks.size(); ++i)
         {
-            m_blocks[i] &= rhs.m_blocks[i];
+            blocks[i] &= rhs_blocks[i];
         }
+        instrument(dynamic_bitset_event::bitwise_operation, m_blocks.size());
         return *this;
     }
 
@@ -2418,10 +5115,13 @@ namespace sul
     {
         assert(size() == rhs.size());
         // apply(rhs, std::bit_or());
+        block_type* const blocks = assume_aligned(m_blocks.data());
+        const block_type* const rhs_blocks = assume_aligned(rhs.m_blocks.data());
         for(size_type i = 0; i < m_blocks.size(); ++i)
         {
-            m_blocks[i] |= rhs.m_blocks[i];
+            blocks[i] |= rhs_blocks[i];
         }
+        instrument(dynamic_bitset_event::bitwise_operation, m_blocks.size());
         return *this;
     }
 
@@ -2431,10 +5131,13 @@ namespace sul
     {
         assert(size() == rhs.size());
         // apply(rhs, std::bit_xor());
+        block_type* const blocks = assume_aligned(m_blocks.data());
+        const block_type* const rhs_blocks = assume_aligned(rhs.m_blocks.data());
         for(size_type i = 0; i < m_blocks.size(); ++i)
         {
-            m_blocks[i] ^= rhs.m_blocks[i];
+            blocks[i] ^= rhs_blocks[i];
         }
+        instrument(dynamic_bitset_event::bitwise_operation, m_blocks.size());
         return *this;
     }
 
@@ -2444,10 +5147,13 @@ namespace sul
     {
         assert(size() == rhs.size());
         // apply(rhs, [](const block_type& x, const block_type& y) { return (x & ~y); });
+        block_type* const blocks = assume_aligned(m_blocks.data());
+        const block_type* const rhs_blocks = assume_aligned(rhs.m_blocks.data());
         for(size_type i = 0; i < m_blocks.size(); ++i)
         {
-            m_blocks[i] &= static_cast<block_type>(~rhs.m_blocks[i]);
+            blocks[i] &= static_cast<block_type>(~rhs_blocks[i]);
         }
+        instrument(dynamic_bitset_event::bitwise_operation, m_blocks.size());
         return *this;
     }
 
@@ -2465,6 +5171,7 @@ namespace sul
                 apply_left_shift(shift);
                 sanitize(); // unused bits can have changed, reset them to 0
             }
+            instrument(dynamic_bitset_event::bitwise_operation, m_blocks.size());
         }
         return *this;
     }
@@ -2482,6 +5189,7 @@ namespace sul
             {
                 apply_right_shift(shift);
             }
+            instrument(dynamic_bitset_event::bitwise_operation, m_blocks.size());
         }
         return *this;
     }
@@ -2489,20 +5197,25 @@ namespace sul
     template<typename Block, typename Allocator>
     constexpr dynamic_bitset<Block, Allocator> dynamic_bitset<Block, Allocator>::operator<<(size_type shift) const
     {
-        return dynamic_bitset<Block, Allocator>(*this) <<= shift;
+        dynamic_bitset<Block, Allocator> bitset(*this, temporary_allocator(get_allocator()));
+        bitset <<= shift;
+        return bitset;
     }
 
     template<typename Block, typename Allocator>
     constexpr dynamic_bitset<Block, Allocator> dynamic_bitset<Block, Allocator>::operator>>(size_type shift) const
     {
-        return dynamic_bitset<Block, Allocator>(*this) >>= shift;
+        dynamic_bitset<Block, Allocator> bitset(*this, temporary_allocator(get_allocator()));
+        bitset >>= shift;
+        return bitset;
     }
 
     template<typename Block, typename Allocator>
     constexpr dynamic_bitset<Block, Allocator> dynamic_bitset<Block, Allocator>::operator~() const
     {
-        dynamic_bitset<Block, Allocator> bitset(*this);
+        dynamic_bitset<Block, Allocator> bitset(*this, temporary_allocator(get_allocator()));
         bitset.flip();
+        instrument(dynamic_bitset_event::bitwise_operation, m_blocks.size());
         return bitset;
     }
 
@@ -2741,6 +5454,7 @@ namespace sul
         {
             return 0;
         }
+        instrument(dynamic_bitset_event::count, m_blocks.size());
 
 #if DYNAMIC_BITSET_CAN_USE_LIBPOPCNT
         const size_type count = static_cast<size_type>(popcnt(m_blocks.data(), m_blocks.size() * sizeof(block_type)));
@@ -2758,14 +5472,151 @@ namespace sul
     const size_type extra_bits = extra_bits_number();
     if(extra_bits == 0)
     {
-        count += block_count(block);
+        count += block_count(block);
+    }
+    else
+    {
+        count += block_count(block, extra_bits);
+    }
+#endif
+        return count;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr bool dynamic_bitset<Block, Allocator>::all(size_type pos, size_type len) const
+    {
+        if(len == 0)
+        {
+            assert(pos <= size());
+            return true;
+        }
+        assert(pos < size());
+        assert(pos + len - 1 < size());
+
+        const size_type first_block = block_index(pos);
+        const size_type last_block = block_index(pos + len - 1);
+        if(first_block == last_block)
+        {
+            const block_type mask = bit_mask(pos, pos + len - 1);
+            return (m_blocks[first_block] & mask) == mask;
+        }
+
+        const block_type first_mask = bit_mask(pos, block_last_bit_index);
+        const block_type last_mask = bit_mask(0, pos + len - 1);
+        if((m_blocks[first_block] & first_mask) != first_mask || (m_blocks[last_block] & last_mask) != last_mask)
+        {
+            return false;
+        }
+        for(size_type i = first_block + 1; i < last_block; ++i)
+        {
+            if(m_blocks[i] != one_block)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr bool dynamic_bitset<Block, Allocator>::any(size_type pos, size_type len) const
+    {
+        if(len == 0)
+        {
+            assert(pos <= size());
+            return false;
+        }
+        assert(pos < size());
+        assert(pos + len - 1 < size());
+
+        const size_type first_block = block_index(pos);
+        const size_type last_block = block_index(pos + len - 1);
+        if(first_block == last_block)
+        {
+            return (m_blocks[first_block] & bit_mask(pos, pos + len - 1)) != zero_block;
+        }
+
+        if((m_blocks[first_block] & bit_mask(pos, block_last_bit_index)) != zero_block
+           || (m_blocks[last_block] & bit_mask(0, pos + len - 1)) != zero_block)
+        {
+            return true;
+        }
+        for(size_type i = first_block + 1; i < last_block; ++i)
+        {
+            if(m_blocks[i] != zero_block)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr bool dynamic_bitset<Block, Allocator>::none(size_type pos, size_type len) const
+    {
+        return !any(pos, len);
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::size_type
+    dynamic_bitset<Block, Allocator>::count(size_type pos, size_type len) const
+    {
+        if(len == 0)
+        {
+            assert(pos <= size());
+            return 0;
+        }
+        assert(pos < size());
+        assert(pos + len - 1 < size());
+
+        instrument(dynamic_bitset_event::count, block_index(pos + len - 1) - block_index(pos) + 1);
+        return count_range(pos, len);
     }
-    else
+
+    template<typename Block, typename Allocator>
+    template<typename OutputIt>
+    constexpr OutputIt dynamic_bitset<Block, Allocator>::segment_counts(size_type segment_bits, OutputIt out) const
     {
-        count += block_count(block, extra_bits);
-    }
-#endif
-        return count;
+        assert(segment_bits > 0);
+        if(empty())
+        {
+            return out;
+        }
+        instrument(dynamic_bitset_event::count, m_blocks.size());
+
+        // single pass over the blocks: the whole blocks of a segment are counted at once, a block is only
+        // split where a segment boundary falls inside it, its bits of the next segments being kept in block
+        size_type i_block = 0;
+        block_type block = m_blocks[0];
+        size_type pos = 0;
+        while(pos < m_bits_number)
+        {
+            const size_type end = m_bits_number - pos > segment_bits ? pos + segment_bits : m_bits_number;
+            const size_type last_block = block_index(end - 1);
+            size_type count = 0;
+            if(last_block != i_block)
+            {
+                count = block_count(block) + count_blocks(i_block + 1, last_block);
+                i_block = last_block;
+                block = m_blocks[last_block];
+            }
+            if(bit_index(end - 1) == block_last_bit_index)
+            {
+                // the segment ends with the block, next segment starts with the next block
+                count += block_count(block);
+                ++i_block;
+                block = i_block < m_blocks.size() ? m_blocks[i_block] : zero_block;
+            }
+            else
+            {
+                const block_type segment_mask = bit_mask(0, end - 1);
+                count += block_count(block_type(block & segment_mask));
+                block = block_type(block & block_type(~segment_mask));
+            }
+            *out = count;
+            ++out;
+            pos = end;
+        }
+        return out;
     }
 
     template<typename Block, typename Allocator>
@@ -2813,13 +5664,17 @@ namespace sul
     template<typename Block, typename Allocator>
     constexpr void dynamic_bitset<Block, Allocator>::reserve(size_type num_bits)
     {
+        const size_type old_capacity = instrumented_capacity();
         m_blocks.reserve(blocks_required(num_bits));
+        instrument_reallocation(old_capacity);
     }
 
     template<typename Block, typename Allocator>
     constexpr void dynamic_bitset<Block, Allocator>::shrink_to_fit()
     {
+        const size_type old_capacity = instrumented_capacity();
         m_blocks.shrink_to_fit();
+        instrument_reallocation(old_capacity);
     }
 
     template<typename Block, typename Allocator>
@@ -2880,9 +5735,11 @@ namespace sul
         {
             if(m_blocks[i] != zero_block)
             {
+                instrument(dynamic_bitset_event::find, i + 1);
                 return i * bits_per_block + count_block_trailing_zero(m_blocks[i]);
             }
         }
+        instrument(dynamic_bitset_event::find, m_blocks.size());
         return npos;
     }
 
@@ -2902,6 +5759,7 @@ namespace sul
 
         if(first_block_shifted != zero_block)
         {
+            instrument(dynamic_bitset_event::find, 1);
             return first_bit + count_block_trailing_zero(first_block_shifted);
         }
         else
@@ -2910,10 +5768,118 @@ namespace sul
             {
                 if(m_blocks[i] != zero_block)
                 {
+                    instrument(dynamic_bitset_event::find, i - first_block + 1);
                     return i * bits_per_block + count_block_trailing_zero(m_blocks[i]);
                 }
             }
         }
+        instrument(dynamic_bitset_event::find, m_blocks.size() - first_block);
+        return npos;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::size_type dynamic_bitset<Block, Allocator>::find_last() const
+    {
+        for(size_type i = m_blocks.size(); i > 0; --i)
+        {
+            if(m_blocks[i - 1] != zero_block)
+            {
+                instrument(dynamic_bitset_event::find, m_blocks.size() - i + 1);
+                return i * bits_per_block - 1 - count_block_leading_zero(m_blocks[i - 1]);
+            }
+        }
+        instrument(dynamic_bitset_event::find, m_blocks.size());
+        return npos;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::size_type
+    dynamic_bitset<Block, Allocator>::find_prev(size_type next) const
+    {
+        if(next > size())
+        {
+            return find_last();
+        }
+        if(next == 0)
+        {
+            return npos;
+        }
+
+        const size_type last_bit = next - 1;
+        const size_type last_block_index = block_index(last_bit);
+        const size_type last_bit_index = bit_index(last_bit);
+        const block_type last_block_shifted =
+          block_type(m_blocks[last_block_index] << (bits_per_block - 1 - last_bit_index));
+
+        if(last_block_shifted != zero_block)
+        {
+            instrument(dynamic_bitset_event::find, 1);
+            return last_bit - count_block_leading_zero(last_block_shifted);
+        }
+        else
+        {
+            for(size_type i = last_block_index; i > 0; --i)
+            {
+                if(m_blocks[i - 1] != zero_block)
+                {
+                    instrument(dynamic_bitset_event::find, last_block_index - i + 2);
+                    return i * bits_per_block - 1 - count_block_leading_zero(m_blocks[i - 1]);
+                }
+            }
+        }
+        instrument(dynamic_bitset_event::find, last_block_index + 1);
+        return npos;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::size_type
+    dynamic_bitset<Block, Allocator>::find_first_zero() const
+    {
+        for(size_type i = 0; i < m_blocks.size(); ++i)
+        {
+            const block_type block = inverted_block(i);
+            if(block != zero_block)
+            {
+                instrument(dynamic_bitset_event::find, i + 1);
+                return i * bits_per_block + count_block_trailing_zero(block);
+            }
+        }
+        instrument(dynamic_bitset_event::find, m_blocks.size());
+        return npos;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::size_type
+    dynamic_bitset<Block, Allocator>::find_next_zero(size_type prev) const
+    {
+        if(empty() || prev >= (size() - 1))
+        {
+            return npos;
+        }
+
+        const size_type first_bit = prev + 1;
+        const size_type first_block = block_index(first_bit);
+        const size_type first_bit_index = bit_index(first_bit);
+        const block_type first_block_shifted = block_type(inverted_block(first_block) >> first_bit_index);
+
+        if(first_block_shifted != zero_block)
+        {
+            instrument(dynamic_bitset_event::find, 1);
+            return first_bit + count_block_trailing_zero(first_block_shifted);
+        }
+        else
+        {
+            for(size_type i = first_block + 1; i < m_blocks.size(); ++i)
+            {
+                const block_type block = inverted_block(i);
+                if(block != zero_block)
+                {
+                    instrument(dynamic_bitset_event::find, i - first_block + 1);
+                    return i * bits_per_block + count_block_trailing_zero(block);
+                }
+            }
+        }
+        instrument(dynamic_bitset_event::find, m_blocks.size() - first_block);
         return npos;
     }
 
@@ -2937,75 +5903,503 @@ namespace sul
     constexpr std::basic_string<_CharT, _Traits, _Alloc> dynamic_bitset<Block, Allocator>::to_string(_CharT zero,
                                                                                                      _CharT one) const
     {
+        instrument(dynamic_bitset_event::to_string, m_blocks.size());
         const size_type len = size();
         std::basic_string<_CharT, _Traits, _Alloc> str(len, zero);
-        for(size_type i_block = 0; i_block < m_blocks.size(); ++i_block)
+        _CharT* const data = str.data();
+
+        // characters of the 4 bits of each nibble value, from the most significant bit
+        _CharT nibble_chars[16][4] = {};
+        for(unsigned int nibble = 0; nibble < 16; ++nibble)
+        {
+            for(unsigned int i_bit = 0; i_bit < 4; ++i_bit)
+            {
+                _Traits::assign(nibble_chars[nibble][i_bit], ((nibble >> (3 - i_bit)) & 1u) != 0 ? one : zero);
+            }
+        }
+
+        // the characters of the bits of a block are contiguous, from its most significant bit
+        constexpr size_type nibbles_per_block = bits_per_block / 4;
+        const size_type whole_blocks = len / bits_per_block;
+        for(size_type i_block = 0; i_block < whole_blocks; ++i_block)
         {
-            if(m_blocks[i_block] == zero_block)
+            const block_type block = m_blocks[i_block];
+            if(block == zero_block)
             {
                 continue;
             }
-            block_type mask = block_type(1);
-            const size_type limit = i_block * bits_per_block < len ? len - i_block * bits_per_block : bits_per_block;
-            for(size_type i_bit = 0; i_bit < limit; ++i_bit)
+            _CharT* const block_chars = data + (len - (i_block + 1) * bits_per_block);
+            for(size_type i_nibble = 0; i_nibble < nibbles_per_block; ++i_nibble)
+            {
+                const size_type nibble = static_cast<size_type>((block >> (i_nibble * 4)) & block_type(0xF));
+                _Traits::copy(block_chars + (bits_per_block - 4 * (i_nibble + 1)), nibble_chars[nibble], 4);
+            }
+        }
+
+        // last partial block, at the start of the string
+        const size_type extra_bits = len % bits_per_block;
+        if(extra_bits > 0)
+        {
+            const block_type block = m_blocks[whole_blocks];
+            for(size_type i_bit = 0; i_bit < extra_bits; ++i_bit)
+            {
+                if(((block >> i_bit) & block_type(1)) != zero_block)
+                {
+                    _Traits::assign(data[extra_bits - 1 - i_bit], one);
+                }
+            }
+        }
+        return str;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr unsigned long dynamic_bitset<Block, Allocator>::to_ulong() const
+    {
+        if(m_bits_number == 0)
+        {
+            return 0;
+        }
+
+        constexpr size_t ul_bits_number = std::numeric_limits<unsigned long>::digits;
+        const size_type last_bit = find_last();
+        if(last_bit != npos && last_bit >= ul_bits_number)
+        {
+            throw std::overflow_error("sul::dynamic_bitset::to_ulong");
+        }
+
+        unsigned long result = 0;
+        const size_type result_bits_number = std::min(ul_bits_number, m_bits_number);
+        for(size_type i_block = 0; i_block <= block_index(result_bits_number - 1); ++i_block)
+        {
+            result |= (static_cast<unsigned long>(m_blocks[i_block]) << (i_block * bits_per_block));
+        }
+
+        return result;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr unsigned long long dynamic_bitset<Block, Allocator>::to_ullong() const
+    {
+        if(m_bits_number == 0)
+        {
+            return 0;
+        }
+
+        constexpr size_t ull_bits_number = std::numeric_limits<unsigned long long>::digits;
+        const size_type last_bit = find_last();
+        if(last_bit != npos && last_bit >= ull_bits_number)
+        {
+            throw std::overflow_error("sul::dynamic_bitset::to_ullong");
+        }
+
+        unsigned long long result = 0;
+        const size_type result_bits_number = std::min(ull_bits_number, m_bits_number);
+        for(size_type i_block = 0; i_block <= block_index(result_bits_number - 1); ++i_block)
+        {
+            result |= (static_cast<unsigned long long>(m_blocks[i_block]) << (i_block * bits_per_block));
+        }
+
+        return result;
+    }
+
+    template<typename Block, typename Allocator>
+    template<size_t N>
+    constexpr std::bitset<N> dynamic_bitset<Block, Allocator>::to_std_bitset() const
+    {
+        if(m_bits_number > N && (N == 0 ? any() : find_next(N - 1) != npos))
+        {
+            throw std::overflow_error("sul::dynamic_bitset::to_std_bitset");
+        }
+
+        std::bitset<N> result;
+        const size_type bits_number = std::min(N, m_bits_number);
+        size_type first_bit = 0;
+#if DYNAMIC_BITSET_CAN_COPY_STD_BITSET_WORDS
+        if constexpr(std::is_trivially_copyable_v<std::bitset<N>>)
+        {
+#    if defined(__cpp_lib_is_constant_evaluated)
+            if(!std::is_constant_evaluated())
+#    endif
             {
-                if((m_blocks[i_block] & mask) != zero_block)
+                // only whole bytes are copied, the bits of the words past N have to remain 0s
+                constexpr size_type bits_per_byte = std::numeric_limits<unsigned char>::digits;
+                const size_type bytes_number = bits_number / bits_per_byte;
+                if(bytes_number > 0)
                 {
-                    _Traits::assign(str[len - (i_block * bits_per_block + i_bit + 1)], one);
+                    std::memcpy(static_cast<void*>(std::addressof(result)), m_blocks.data(), bytes_number);
                 }
-                // mask <<= 1; not used because it trigger -Wconversion
-                // because of integral promotion for block_type smaller than int
-                mask = static_cast<block_type>(mask << 1);
+                first_bit = bytes_number * bits_per_byte;
+            }
+        }
+#endif
+        for(size_type i = first_bit; i < bits_number; ++i)
+        {
+            if(test(i))
+            {
+                result.set(i);
+            }
+        }
+        return result;
+    }
+
+    template<typename Block, typename Allocator>
+    template<typename _Alloc>
+    constexpr std::vector<bool, _Alloc> dynamic_bitset<Block, Allocator>::to_vector_bool(const _Alloc& allocator) const
+    {
+        std::vector<bool, _Alloc> result(m_bits_number, false, allocator);
+        if(m_bits_number == 0)
+        {
+            return result;
+        }
+
+#if DYNAMIC_BITSET_CAN_COPY_VECTOR_BOOL_WORDS
+#    if defined(__cpp_lib_is_constant_evaluated)
+        if(!std::is_constant_evaluated())
+#    endif
+        {
+            // the words are contiguous, starting at the word of the begin iterator
+            typedef std::remove_pointer_t<decltype(result.begin()._M_p)> word_type;
+            constexpr size_type bits_per_word = std::numeric_limits<word_type>::digits;
+            const size_type words_number =
+              m_bits_number / bits_per_word + (m_bits_number % bits_per_word == 0 ? 0 : 1);
+            std::memcpy(result.begin()._M_p,
+                        m_blocks.data(),
+                        std::min(words_number * sizeof(word_type), m_blocks.size() * sizeof(block_type)));
+            return result;
+        }
+#endif
+        for(size_type i = find_first(); i != npos; i = find_next(i))
+        {
+            result[i] = true;
+        }
+        return result;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr std::string dynamic_bitset<Block, Allocator>::to_hex_string() const
+    {
+        constexpr char digits[] = "0123456789abcdef";
+        // the 2 digits of each byte value, from the most significant digit
+        char byte_digits[256][2] = {};
+        for(unsigned int byte = 0; byte < 256; ++byte)
+        {
+            byte_digits[byte][0] = digits[byte >> 4];
+            byte_digits[byte][1] = digits[byte & 0xF];
+        }
+
+        constexpr size_type digits_per_block = bits_per_block / 4;
+        const size_type digits_number = m_bits_number / 4 + (m_bits_number % 4 == 0 ? 0 : 1);
+        std::string str(digits_number, '0');
+        // the blocks are made of whole digits, written from the end of the string as the first digit
+        // corresponds to the last bits
+        char* digit_char = str.data() + digits_number;
+        const size_type full_blocks = digits_number / digits_per_block;
+        for(size_type i_block = 0; i_block < full_blocks; ++i_block)
+        {
+            block_type block = m_blocks[i_block];
+            for(size_type i_byte = 0; i_byte < digits_per_block / 2; ++i_byte)
+            {
+                digit_char -= 2;
+                const char* const chars = byte_digits[block & block_type(0xFF)];
+                digit_char[0] = chars[0];
+                digit_char[1] = chars[1];
+                block = static_cast<block_type>(block >> 8);
+            }
+        }
+        // digits of the last block
+        block_type block = full_blocks < m_blocks.size() ? m_blocks[full_blocks] : zero_block;
+        while(digit_char != str.data())
+        {
+            *--digit_char = digits[block & block_type(0xF)];
+            block = static_cast<block_type>(block >> 4);
+        }
+        return str;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr dynamic_bitset<Block, Allocator>
+    dynamic_bitset<Block, Allocator>::from_hex(std::string_view str, size_type nbits, const allocator_type& allocator)
+    {
+        // value of each character, -1 if not an hexadecimal digit
+        signed char values[256] = {};
+        for(unsigned int c = 0; c < 256; ++c)
+        {
+            values[c] = static_cast<signed char>(hex_digit_value(static_cast<char>(c)));
+        }
+
+        constexpr size_type digits_per_block = bits_per_block / 4;
+        const size_type digits_number = str.size();
+        dynamic_bitset<Block, Allocator> bitset(allocator);
+        bitset.resize_for_overwrite(4 * digits_number);
+        // the invalid characters are checked once, their value having the sign bit set
+        int invalid = 0;
+        const char* digit_char = str.data() + digits_number;
+        for(size_type i_block = 0; i_block < bitset.m_blocks.size(); ++i_block)
+        {
+            const size_type block_digits = std::min(digits_per_block, digits_number - i_block * digits_per_block);
+            digit_char -= block_digits;
+            block_type block = 0;
+            for(size_type i_digit = 0; i_digit < block_digits; ++i_digit)
+            {
+                const int value = values[static_cast<unsigned char>(digit_char[i_digit])];
+                invalid |= value;
+                block = static_cast<block_type>((block << 4) | static_cast<block_type>(value & 0xF));
+            }
+            bitset.m_blocks[i_block] = block;
+        }
+        if(invalid < 0)
+        {
+            throw std::invalid_argument("sul::dynamic_bitset::from_hex");
+        }
+        bitset.resize_decoded(nbits, "sul::dynamic_bitset::from_hex");
+        return bitset;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr std::string dynamic_bitset<Block, Allocator>::to_base64() const
+    {
+        constexpr char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        constexpr size_type bytes_per_block = bits_per_block / 8;
+        const size_type bytes_number = m_bits_number / 8 + (m_bits_number % 8 == 0 ? 0 : 1);
+        const auto byte = [this](size_type i_byte) {
+            return static_cast<unsigned int>(
+              (m_blocks[i_byte / bytes_per_block] >> (8 * (i_byte % bytes_per_block))) & block_type(0xFF));
+        };
+
+        std::string str(4 * (bytes_number / 3 + (bytes_number % 3 == 0 ? 0 : 1)), '=');
+        char* group_chars = str.data();
+        // groups of 3 bytes encoded as 4 characters of 6 bits
+        size_type i_byte = 0;
+        for(; bytes_number - i_byte >= 3; i_byte += 3, group_chars += 4)
+        {
+            const unsigned int group = (byte(i_byte) << 16) | (byte(i_byte + 1) << 8) | byte(i_byte + 2);
+            group_chars[0] = alphabet[group >> 18];
+            group_chars[1] = alphabet[(group >> 12) & 0x3F];
+            group_chars[2] = alphabet[(group >> 6) & 0x3F];
+            group_chars[3] = alphabet[group & 0x3F];
+        }
+        // last group of 1 or 2 bytes, padded with '='
+        if(i_byte < bytes_number)
+        {
+            const bool two_bytes = bytes_number - i_byte == 2;
+            const unsigned int group = (byte(i_byte) << 16) | (two_bytes ? byte(i_byte + 1) << 8 : 0);
+            group_chars[0] = alphabet[group >> 18];
+            group_chars[1] = alphabet[(group >> 12) & 0x3F];
+            if(two_bytes)
+            {
+                group_chars[2] = alphabet[(group >> 6) & 0x3F];
             }
         }
         return str;
     }
 
     template<typename Block, typename Allocator>
-    constexpr unsigned long dynamic_bitset<Block, Allocator>::to_ulong() const
+    constexpr dynamic_bitset<Block, Allocator>
+    dynamic_bitset<Block, Allocator>::from_base64(std::string_view str,
+                                                  size_type nbits,
+                                                  const allocator_type& allocator)
+    {
+        if(str.size() % 4 != 0)
+        {
+            throw std::invalid_argument("sul::dynamic_bitset::from_base64");
+        }
+        size_type padding = 0;
+        if(!str.empty() && str[str.size() - 1] == '=')
+        {
+            padding = str[str.size() - 2] == '=' ? 2 : 1;
+        }
+
+        // value of each character, -1 if out of the base64 alphabet, including the padding character
+        signed char values[256] = {};
+        for(unsigned int c = 0; c < 256; ++c)
+        {
+            values[c] = static_cast<signed char>(base64_digit_value(static_cast<char>(c)));
+        }
+
+        constexpr size_type bytes_per_block = bits_per_block / 8;
+        const size_type bytes_number = str.size() / 4 * 3 - padding;
+        dynamic_bitset<Block, Allocator> bitset(8 * bytes_number, 0, allocator);
+        const auto set_byte = [&bitset](size_type i_byte, unsigned int byte) {
+            bitset.m_blocks[i_byte / bytes_per_block] |=
+              static_cast<block_type>(static_cast<block_type>(byte) << (8 * (i_byte % bytes_per_block)));
+        };
+        // the invalid characters are checked once, their value having the sign bit set
+        int invalid = 0;
+        const auto decode = [&values, &invalid](const char* chars, size_type chars_number) {
+            unsigned int group = 0;
+            for(size_type i = 0; i < chars_number; ++i)
+            {
+                const int value = values[static_cast<unsigned char>(chars[i])];
+                invalid |= value;
+                group = (group << 6) | static_cast<unsigned int>(value & 0x3F);
+            }
+            return group << (6 * (4 - chars_number));
+        };
+
+        // groups of 4 characters of 6 bits decoded as 3 bytes, the last group holding the padding if any
+        const size_type full_groups = str.size() / 4 - (padding == 0 ? 0 : 1);
+        for(size_type i_group = 0; i_group < full_groups; ++i_group)
+        {
+            const unsigned int group = decode(str.data() + 4 * i_group, 4);
+            set_byte(3 * i_group, group >> 16);
+            set_byte(3 * i_group + 1, (group >> 8) & 0xFF);
+            set_byte(3 * i_group + 2, group & 0xFF);
+        }
+        if(padding != 0)
+        {
+            const unsigned int group = decode(str.data() + 4 * full_groups, 4 - padding);
+            set_byte(3 * full_groups, group >> 16);
+            if(padding == 1)
+            {
+                set_byte(3 * full_groups + 1, (group >> 8) & 0xFF);
+            }
+        }
+        if(invalid < 0)
+        {
+            throw std::invalid_argument("sul::dynamic_bitset::from_base64");
+        }
+        bitset.resize_decoded(nbits, "sul::dynamic_bitset::from_base64");
+        return bitset;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr unsigned long long dynamic_bitset<Block, Allocator>::extract_bits(size_type pos, size_type nbits) const
     {
-        if(m_bits_number == 0)
+        constexpr size_t ull_bits_number = std::numeric_limits<unsigned long long>::digits;
+        assert(nbits <= ull_bits_number);
+        assert(pos <= size() && nbits <= size() - pos);
+        if(nbits == 0)
         {
             return 0;
         }
 
-        constexpr size_t ul_bits_number = std::numeric_limits<unsigned long>::digits;
-        if(find_next(ul_bits_number - 1) != npos)
+        size_type i_block = block_index(pos);
+        const size_type offset = bit_index(pos);
+        unsigned long long result = static_cast<unsigned long long>(m_blocks[i_block] >> offset);
+        for(size_type extracted = bits_per_block - offset; extracted < nbits; extracted += bits_per_block)
         {
-            throw std::overflow_error("sul::dynamic_bitset::to_ulong");
+            result |= static_cast<unsigned long long>(m_blocks[++i_block]) << extracted;
         }
 
-        unsigned long result = 0;
-        const size_type result_bits_number = std::min(ul_bits_number, m_bits_number);
-        for(size_type i_block = 0; i_block <= block_index(result_bits_number - 1); ++i_block)
+        if(nbits < ull_bits_number)
         {
-            result |= (static_cast<unsigned long>(m_blocks[i_block]) << (i_block * bits_per_block));
+            result &= (1ull << nbits) - 1;
         }
-
         return result;
     }
 
     template<typename Block, typename Allocator>
-    constexpr unsigned long long dynamic_bitset<Block, Allocator>::to_ullong() const
+    constexpr typename dynamic_bitset<Block, Allocator>::slice_view
+    dynamic_bitset<Block, Allocator>::slice(size_type pos, size_type len)
     {
-        if(m_bits_number == 0)
+        return slice_view(*this, pos, len);
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::const_slice_view
+    dynamic_bitset<Block, Allocator>::slice(size_type pos, size_type len) const
+    {
+        return const_slice_view(*this, pos, len);
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr unsigned long long dynamic_bitset<Block, Allocator>::hash(unsigned long long seed) const noexcept
+    {
+        typedef unsigned long long word_type;
+        constexpr size_t word_bits = std::numeric_limits<word_type>::digits;
+        static_assert(word_bits == 64, "hash requires 64 bits unsigned long long");
+        constexpr word_type prime1 = 0x9E3779B185EBCA87ull;
+        constexpr word_type prime2 = 0xC2B2AE3D27D4EB4Full;
+        constexpr word_type prime3 = 0x165667B19E3779F9ull;
+        constexpr word_type prime4 = 0x85EBCA77C2B2AE63ull;
+        constexpr word_type prime5 = 0x27D4EB2F165667C5ull;
+
+        const auto rotate_left = [](word_type value, unsigned int shift) constexpr {
+            return (value << shift) | (value >> (word_bits - shift));
+        };
+        const auto hash_round = [&rotate_left](word_type accumulator, word_type input) constexpr {
+            return rotate_left(accumulator + input * prime2, 31) * prime1;
+        };
+        const auto merge_round = [&hash_round](word_type accumulator, word_type value) constexpr {
+            return (accumulator ^ hash_round(0, value)) * prime1 + prime4;
+        };
+
+        // 64 bits words of the blocks, the unused bits of the last block are 0
+        const size_type words_number = (m_bits_number + word_bits - 1) / word_bits;
+        const auto word = [this](size_type i) constexpr -> word_type {
+            if constexpr(bits_per_block >= word_bits)
+            {
+                const size_type first_bit = i * word_bits;
+                return static_cast<word_type>(m_blocks[block_index(first_bit)] >> bit_index(first_bit));
+            }
+            else
+            {
+                constexpr size_type blocks_per_word = word_bits / bits_per_block;
+                const size_type first_block = i * blocks_per_word;
+#if DYNAMIC_BITSET_CAN_LOAD_BLOCKS_AS_WORDS
+#    if defined(__cpp_lib_is_constant_evaluated)
+                if(!std::is_constant_evaluated())
+#    endif
+                {
+                    // whole words loaded at once, only the last word may be made of less blocks
+                    if(first_block + blocks_per_word <= m_blocks.size())
+                    {
+                        word_type result;
+                        std::memcpy(&result, m_blocks.data() + first_block, sizeof(result));
+                        return result;
+                    }
+                }
+#endif
+                const size_type last_block = std::min(first_block + blocks_per_word, m_blocks.size());
+                word_type result = 0;
+                for(size_type j = first_block; j < last_block; ++j)
+                {
+                    result |= static_cast<word_type>(m_blocks[j]) << ((j - first_block) * bits_per_block);
+                }
+                return result;
+            }
+        };
+
+        word_type result;
+        size_type i = 0;
+        if(words_number >= 4)
         {
-            return 0;
+            word_type accumulator1 = seed + prime1 + prime2;
+            word_type accumulator2 = seed + prime2;
+            word_type accumulator3 = seed;
+            word_type accumulator4 = seed - prime1;
+            for(; i + 4 <= words_number; i += 4)
+            {
+                accumulator1 = hash_round(accumulator1, word(i));
+                accumulator2 = hash_round(accumulator2, word(i + 1));
+                accumulator3 = hash_round(accumulator3, word(i + 2));
+                accumulator4 = hash_round(accumulator4, word(i + 3));
+            }
+            result = rotate_left(accumulator1, 1) + rotate_left(accumulator2, 7) + rotate_left(accumulator3, 12)
+                     + rotate_left(accumulator4, 18);
+            result = merge_round(result, accumulator1);
+            result = merge_round(result, accumulator2);
+            result = merge_round(result, accumulator3);
+            result = merge_round(result, accumulator4);
         }
-
-        constexpr size_t ull_bits_number = std::numeric_limits<unsigned long long>::digits;
-        if(find_next(ull_bits_number - 1) != npos)
+        else
         {
-            throw std::overflow_error("sul::dynamic_bitset::to_ullong");
+            result = seed + prime5;
         }
 
-        unsigned long long result = 0;
-        const size_type result_bits_number = std::min(ull_bits_number, m_bits_number);
-        for(size_type i_block = 0; i_block <= block_index(result_bits_number - 1); ++i_block)
+        result += static_cast<word_type>(m_bits_number);
+        for(; i < words_number; ++i)
         {
-            result |= (static_cast<unsigned long long>(m_blocks[i_block]) << (i_block * bits_per_block));
+            result ^= hash_round(0, word(i));
+            result = rotate_left(result, 27) * prime1 + prime4;
         }
 
+        // avalanche
+        result ^= result >> 33;
+        result *= prime2;
+        result ^= result >> 29;
+        result *= prime3;
+        result ^= result >> 32;
         return result;
     }
 
@@ -3049,90 +6443,119 @@ namespace sul
     }
 
     template<typename Block, typename Allocator>
-    constexpr typename dynamic_bitset<Block, Allocator>::block_type* dynamic_bitset<Block, Allocator>::data() noexcept
-    {
-        return m_blocks.data();
-    }
-
-    template<typename Block, typename Allocator>
-    constexpr const typename dynamic_bitset<Block, Allocator>::block_type*
-    dynamic_bitset<Block, Allocator>::data() const noexcept
-    {
-        return m_blocks.data();
-    }
-
-    template<typename Block_, typename Allocator_>
-    [[nodiscard]] constexpr bool operator==(const dynamic_bitset<Block_, Allocator_>& lhs,
-                                            const dynamic_bitset<Block_, Allocator_>& rhs)
-    {
-        return (lhs.m_bits_number == rhs.m_bits_number) && (lhs.m_blocks == rhs.m_blocks);
-    }
-
-    template<typename Block_, typename Allocator_>
-    [[nodiscard]] constexpr bool operator<(const dynamic_bitset<Block_, Allocator_>& lhs,
-                                           const dynamic_bitset<Block_, Allocator_>& rhs)
+    template<typename Function, typename... Parameters>
+    constexpr void dynamic_bitset<Block, Allocator>::iterate_bits_on_reverse(Function&& function,
+                                                                             Parameters&&... parameters) const
     {
-        using size_type = typename dynamic_bitset<Block_, Allocator_>::size_type;
-        using block_type = typename dynamic_bitset<Block_, Allocator_>::block_type;
-        const size_type lhs_size = lhs.size();
-        const size_type rhs_size = rhs.size();
-        const size_type lhs_blocks_size = lhs.m_blocks.size();
-        const size_type rhs_blocks_size = rhs.m_blocks.size();
+        if constexpr(!std::is_invocable_v<Function, size_t, Parameters...>)
+        {
+            static_assert(dependent_false<Function>::value, "Function take invalid arguments");
+            // function should take (size_t, parameters...) as arguments
+        }
 
-        if(lhs_size == rhs_size)
+        if constexpr(std::is_same_v<std::invoke_result_t<Function, size_t, Parameters...>, void>)
         {
-            // if comparison of two empty bitsets
-            if(lhs_size == 0)
+            size_type i_bit = find_last();
+            while(i_bit != npos)
             {
-                return false;
+                std::invoke(std::forward<Function>(function), i_bit, std::forward<Parameters>(parameters)...);
+                i_bit = find_prev(i_bit);
             }
-
-            for(size_type i = lhs_blocks_size - 1; i > 0; --i)
+        }
+        else if constexpr(std::is_convertible_v<std::invoke_result_t<Function, size_t, Parameters...>, bool>)
+        {
+            size_type i_bit = find_last();
+            while(i_bit != npos)
             {
-                if(lhs.m_blocks[i] != rhs.m_blocks[i])
+                if(!std::invoke(std::forward<Function>(function), i_bit, std::forward<Parameters>(parameters)...))
                 {
-                    return lhs.m_blocks[i] < rhs.m_blocks[i];
+                    break;
                 }
+                i_bit = find_prev(i_bit);
             }
-            return lhs.m_blocks[0] < rhs.m_blocks[0];
         }
-
-        // empty bitset inferior to 0-only bitset
-        if(lhs_size == 0)
+        else
         {
-            return true;
+            static_assert(dependent_false<Function>::value, "Function have invalid return type");
+            // return type should be void, or convertible to bool
         }
-        if(rhs_size == 0)
+    }
+
+    template<typename Block, typename Allocator>
+    template<typename Function, typename... Parameters>
+    constexpr void dynamic_bitset<Block, Allocator>::iterate_bits_off(Function&& function,
+                                                                      Parameters&&... parameters) const
+    {
+        if constexpr(!std::is_invocable_v<Function, size_t, Parameters...>)
         {
-            return false;
+            static_assert(dependent_false<Function>::value, "Function take invalid arguments");
+            // function should take (size_t, parameters...) as arguments
         }
 
-        const bool rhs_longer = rhs_size > lhs_size;
-        const dynamic_bitset<Block_, Allocator_>& longest_bitset = rhs_longer ? rhs : lhs;
-        const size_type longest_blocks_size = std::max(lhs_blocks_size, rhs_blocks_size);
-        const size_type shortest_blocks_size = std::min(lhs_blocks_size, rhs_blocks_size);
-        for(size_type i = longest_blocks_size - 1; i >= shortest_blocks_size; --i)
+        if constexpr(std::is_same_v<std::invoke_result_t<Function, size_t, Parameters...>, void>)
         {
-            if(longest_bitset.m_blocks[i] != block_type(0))
+            size_type i_bit = find_first_zero();
+            while(i_bit != npos)
             {
-                return rhs_longer;
+                std::invoke(std::forward<Function>(function), i_bit, std::forward<Parameters>(parameters)...);
+                i_bit = find_next_zero(i_bit);
             }
         }
-
-        for(size_type i = shortest_blocks_size - 1; i > 0; --i)
+        else if constexpr(std::is_convertible_v<std::invoke_result_t<Function, size_t, Parameters...>, bool>)
         {
-            if(lhs.m_blocks[i] != rhs.m_blocks[i])
+            size_type i_bit = find_first_zero();
+            while(i_bit != npos)
             {
-                return lhs.m_blocks[i] < rhs.m_blocks[i];
+                if(!std::invoke(std::forward<Function>(function), i_bit, std::forward<Parameters>(parameters)...))
+                {
+                    break;
+                }
+                i_bit = find_next_zero(i_bit);
             }
         }
-        if(lhs.m_blocks[0] != rhs.m_blocks[0])
+        else
         {
-            return lhs.m_blocks[0] < rhs.m_blocks[0];
+            static_assert(dependent_false<Function>::value, "Function have invalid return type");
+            // return type should be void, or convertible to bool
         }
-        return lhs_size < rhs_size;
     }
 
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::block_type* dynamic_bitset<Block, Allocator>::data() noexcept
+    {
+        return m_blocks.data();
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr const typename dynamic_bitset<Block, Allocator>::block_type*
+    dynamic_bitset<Block, Allocator>::data() const noexcept
+    {
+        return m_blocks.data();
+    }
+
+    template<typename Block_, typename Allocator_>
+    [[nodiscard]] constexpr bool operator==(const dynamic_bitset<Block_, Allocator_>& lhs,
+                                            const dynamic_bitset<Block_, Allocator_>& rhs)
+    {
+        return (lhs.m_bits_number == rhs.m_bits_number) && (lhs.m_blocks == rhs.m_blocks);
+    }
+
+    template<typename Block_, typename Allocator_>
+    [[nodiscard]] constexpr bool operator<(const dynamic_bitset<Block_, Allocator_>& lhs,
+                                           const dynamic_bitset<Block_, Allocator_>& rhs)
+    {
+        return dynamic_bitset<Block_, Allocator_>::compare(lhs, rhs) < 0;
+    }
+
+#if DYNAMIC_BITSET_CAN_USE_THREE_WAY_COMPARISON
+    template<typename Block_, typename Allocator_>
+    [[nodiscard]] constexpr std::strong_ordering operator<=>(const dynamic_bitset<Block_, Allocator_>& lhs,
+                                                             const dynamic_bitset<Block_, Allocator_>& rhs)
+    {
+        return dynamic_bitset<Block_, Allocator_>::compare(lhs, rhs) <=> 0;
+    }
+#endif
+
     //=================================================================================================
     // dynamic_bitset private functions implementations
     //=================================================================================================
@@ -3294,6 +6717,77 @@ namespace sul
 #endif
     }
 
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::size_type
+    dynamic_bitset<Block, Allocator>::count_range(size_type pos, size_type len) const
+    {
+        assert(len > 0);
+        const size_type first_block = block_index(pos);
+        const size_type last_block = block_index(pos + len - 1);
+        if(first_block == last_block)
+        {
+            return block_count(block_type(m_blocks[first_block] & bit_mask(pos, pos + len - 1)));
+        }
+
+        // partial first and last blocks
+        size_type count = block_count(block_type(m_blocks[first_block] & bit_mask(pos, block_last_bit_index)))
+                          + block_count(block_type(m_blocks[last_block] & bit_mask(0, pos + len - 1)));
+
+        // full blocks
+        return count + count_blocks(first_block + 1, last_block);
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::size_type
+    dynamic_bitset<Block, Allocator>::count_blocks(size_type first_block, size_type last_block) const
+    {
+        if(last_block <= first_block)
+        {
+            return 0;
+        }
+#if DYNAMIC_BITSET_CAN_USE_LIBPOPCNT
+        return static_cast<size_type>(popcnt(&m_blocks[first_block], (last_block - first_block) * sizeof(block_type)));
+#else
+        size_type count = 0;
+        for(size_type i = first_block; i < last_block; ++i)
+        {
+            count += block_count(m_blocks[i]);
+        }
+        return count;
+#endif
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::size_type
+    dynamic_bitset<Block, Allocator>::find_first_in(size_type pos, size_type len) const
+    {
+        if(len == 0)
+        {
+            return npos;
+        }
+        const size_type first_block = block_index(pos);
+        const size_type last_block = block_index(pos + len - 1);
+        for(size_type i = first_block; i <= last_block; ++i)
+        {
+            block_type block = m_blocks[i];
+            if(i == first_block)
+            {
+                block &= bit_mask(pos, block_last_bit_index);
+            }
+            if(i == last_block)
+            {
+                block &= bit_mask(0, pos + len - 1);
+            }
+            if(block != zero_block)
+            {
+                instrument(dynamic_bitset_event::find, i - first_block + 1);
+                return i * bits_per_block + count_block_trailing_zero(block);
+            }
+        }
+        instrument(dynamic_bitset_event::find, last_block - first_block + 1);
+        return npos;
+    }
+
     template<typename Block, typename Allocator>
     constexpr typename dynamic_bitset<Block, Allocator>::size_type
     dynamic_bitset<Block, Allocator>::count_block_trailing_zero(const block_type& block) noexcept
@@ -3343,30 +6837,118 @@ namespace sul
             _BitScanForward(&index, low);
             return static_cast<size_type>(index);
         }
-        unsigned long high = block >> ul_bits_number;
+        unsigned long high = block >> ul_bits_number;
+        unsigned long index = std::numeric_limits<unsigned long>::max();
+        _BitScanForward(&index, high);
+        return static_cast<size_type>(ul_bits_number + index);
+#        endif
+    }
+#    endif
+
+    block_type mask = block_type(1);
+    for(size_type i = 0; i < bits_per_block; ++i)
+    {
+        if((block & mask) != zero_block)
+        {
+            return i;
+        }
+        // mask <<= 1; not used because it trigger -Wconversion
+        // because of integral promotion for block_type smaller than int
+        mask = static_cast<block_type>(mask << 1);
+    }
+    assert(false); // LCOV_EXCL_LINE: unreachable
+    return npos; // LCOV_EXCL_LINE: unreachable
+#endif
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::size_type
+    dynamic_bitset<Block, Allocator>::count_block_leading_zero(const block_type& block) noexcept
+    {
+        assert(block != zero_block);
+#if DYNAMIC_BITSET_CAN_USE_STD_BITOPS
+        return static_cast<size_type>(std::countl_zero(block));
+#else
+#    if DYNAMIC_BITSET_CAN_USE_GCC_BUILTIN || DYNAMIC_BITSET_CAN_USE_CLANG_BUILTIN_CLZ
+    // the builtins count the leading zeros of the whole integer type, not only of the block bits
+    constexpr size_t u_bits_number = std::numeric_limits<unsigned>::digits;
+    constexpr size_t ul_bits_number = std::numeric_limits<unsigned long>::digits;
+    constexpr size_t ull_bits_number = std::numeric_limits<unsigned long long>::digits;
+    if constexpr(bits_per_block <= u_bits_number)
+    {
+        return static_cast<size_type>(__builtin_clz(static_cast<unsigned int>(block)))
+               - (u_bits_number - bits_per_block);
+    }
+    else if constexpr(bits_per_block <= ul_bits_number)
+    {
+        return static_cast<size_type>(__builtin_clzl(static_cast<unsigned long>(block)))
+               - (ul_bits_number - bits_per_block);
+    }
+    else if constexpr(bits_per_block <= ull_bits_number)
+    {
+        return static_cast<size_type>(__builtin_clzll(static_cast<unsigned long long>(block)))
+               - (ull_bits_number - bits_per_block);
+    }
+
+#    elif DYNAMIC_BITSET_CAN_USE_MSVC_BUILTIN_BITSCANREVERSE
+    constexpr size_t ul_bits_number = std::numeric_limits<unsigned long>::digits;
+    constexpr size_t ui64_bits_number = std::numeric_limits<unsigned __int64>::digits;
+    if constexpr(bits_per_block <= ul_bits_number)
+    {
+        unsigned long index = std::numeric_limits<unsigned long>::max();
+        _BitScanReverse(&index, static_cast<unsigned long>(block));
+        return bits_per_block - 1 - static_cast<size_type>(index);
+    }
+    else if constexpr(bits_per_block <= ui64_bits_number)
+    {
+#        if DYNAMIC_BITSET_CAN_USE_MSVC_BUILTIN_BITSCANREVERSE64
+        unsigned long index = std::numeric_limits<unsigned long>::max();
+        _BitScanReverse64(&index, static_cast<unsigned __int64>(block));
+        return bits_per_block - 1 - static_cast<size_type>(index);
+#        else
+        constexpr unsigned long max_ul = std::numeric_limits<unsigned long>::max();
+        unsigned long high = block >> ul_bits_number;
+        if(high != 0)
+        {
+            unsigned long index = std::numeric_limits<unsigned long>::max();
+            _BitScanReverse(&index, high);
+            return bits_per_block - 1 - static_cast<size_type>(ul_bits_number + index);
+        }
+        unsigned long low = block & max_ul;
         unsigned long index = std::numeric_limits<unsigned long>::max();
-        _BitScanForward(&index, high);
-        return static_cast<size_type>(ul_bits_number + index);
+        _BitScanReverse(&index, low);
+        return bits_per_block - 1 - static_cast<size_type>(index);
 #        endif
     }
 #    endif
 
-    block_type mask = block_type(1);
+    block_type mask = block_type(block_type(1) << (bits_per_block - 1));
     for(size_type i = 0; i < bits_per_block; ++i)
     {
         if((block & mask) != zero_block)
         {
             return i;
         }
-        // mask <<= 1; not used because it trigger -Wconversion
-        // because of integral promotion for block_type smaller than int
-        mask = static_cast<block_type>(mask << 1);
+        mask = static_cast<block_type>(mask >> 1);
     }
     assert(false); // LCOV_EXCL_LINE: unreachable
     return npos; // LCOV_EXCL_LINE: unreachable
 #endif
     }
 
+    template<typename Block, typename Allocator>
+    template<typename T>
+    constexpr T* dynamic_bitset<Block, Allocator>::assume_aligned(T* blocks) noexcept
+    {
+#if defined(__cpp_lib_assume_aligned)
+        return std::assume_aligned<storage_alignment>(blocks);
+#elif(defined(__GNUC__) || defined(__clang__)) && !defined(DYNAMIC_BITSET_NO_COMPILER_BUILTIN)
+        return static_cast<T*>(__builtin_assume_aligned(blocks, storage_alignment));
+#else
+        return blocks;
+#endif
+    }
+
     template<typename Block, typename Allocator>
     template<typename _CharT, typename _Traits>
     constexpr void
@@ -3381,17 +6963,127 @@ namespace sul
         const size_type size = std::min(n, str.size() - pos);
         m_bits_number = size;
 
+        const size_type old_capacity = instrumented_capacity();
         m_blocks.clear();
-        m_blocks.resize(blocks_required(size));
-        for(size_t i = 0; i < size; ++i)
+        m_blocks.resize(blocks_required(size), zero_block);
+        instrument_reallocation(old_capacity);
+        const _CharT* const data = str.data() + pos;
+        assert(std::all_of(data, data + size, [zero, one](_CharT c) { return c == zero || c == one; }));
+
+        // the characters of the bits of a block are contiguous, from its most significant bit
+        const size_type whole_blocks = size / bits_per_block;
+        for(size_type i_block = 0; i_block < whole_blocks; ++i_block)
+        {
+            m_blocks[i_block] = parse_block(data + (size - (i_block + 1) * bits_per_block), one);
+        }
+
+        // last partial block, at the start of the string
+        const size_type extra_bits = size % bits_per_block;
+        if(extra_bits > 0)
+        {
+            block_type block = zero_block;
+            for(size_type i = 0; i < extra_bits; ++i)
+            {
+                block = static_cast<block_type>((block << 1) | block_type(data[i] == one));
+            }
+            m_blocks[whole_blocks] = block;
+        }
+    }
+
+    template<typename Block, typename Allocator>
+    template<typename _CharT>
+    constexpr typename dynamic_bitset<Block, Allocator>::block_type
+    dynamic_bitset<Block, Allocator>::parse_block(const _CharT* chars, _CharT one) noexcept
+    {
+        block_type block = zero_block;
+#if DYNAMIC_BITSET_CAN_USE_SWAR_PARSING
+        if constexpr(sizeof(_CharT) == 1 && bits_per_block % 8 == 0)
         {
-            const _CharT c = str[(pos + size - 1) - i];
-            assert(c == zero || c == one);
-            if(c == one)
+#    if defined(__cpp_lib_is_constant_evaluated)
+            if(!std::is_constant_evaluated())
+#    endif
             {
-                set(i);
+                // compare 8 characters at once: the high bit of each byte is set if the character is not one,
+                // then gather the bits of the bytes, the first character giving the most significant bit
+                constexpr uint64_t low_bits = 0x7F7F7F7F7F7F7F7F;
+                constexpr uint64_t high_bits = 0x8080808080808080;
+                const uint64_t ones = uint64_t(0x0101010101010101) * static_cast<unsigned char>(one);
+                for(size_type i = 0; i < bits_per_block; i += 8)
+                {
+                    uint64_t chunk = 0;
+                    std::memcpy(&chunk, chars + i, 8);
+                    chunk ^= ones;
+                    const uint64_t not_one = (((chunk & low_bits) + low_bits) | chunk) & high_bits;
+                    const uint64_t is_one = (~not_one & high_bits) >> 7;
+                    block = static_cast<block_type>((block << 8) | block_type((is_one * 0x8040201008040201) >> 56));
+                }
+                return block;
             }
         }
+#endif
+        for(size_type i = 0; i < bits_per_block; ++i)
+        {
+            block = static_cast<block_type>((block << 1) | block_type(chars[i] == one));
+        }
+        return block;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr int dynamic_bitset<Block, Allocator>::hex_digit_value(char c) noexcept
+    {
+        if(c >= '0' && c <= '9')
+        {
+            return c - '0';
+        }
+        if(c >= 'a' && c <= 'f')
+        {
+            return c - 'a' + 10;
+        }
+        if(c >= 'A' && c <= 'F')
+        {
+            return c - 'A' + 10;
+        }
+        return -1;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr int dynamic_bitset<Block, Allocator>::base64_digit_value(char c) noexcept
+    {
+        if(c >= 'A' && c <= 'Z')
+        {
+            return c - 'A';
+        }
+        if(c >= 'a' && c <= 'z')
+        {
+            return c - 'a' + 26;
+        }
+        if(c >= '0' && c <= '9')
+        {
+            return c - '0' + 52;
+        }
+        if(c == '+')
+        {
+            return 62;
+        }
+        if(c == '/')
+        {
+            return 63;
+        }
+        return -1;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr void dynamic_bitset<Block, Allocator>::resize_decoded(size_type nbits, const char* function)
+    {
+        if(nbits == npos)
+        {
+            return;
+        }
+        if(nbits < m_bits_number && (nbits == 0 ? any() : find_next(nbits - 1) != npos))
+        {
+            throw std::invalid_argument(function);
+        }
+        resize(nbits);
     }
 
     template<typename Block, typename Allocator>
@@ -3420,6 +7112,187 @@ namespace sul
         return m_blocks[m_blocks.size() - 1];
     }
 
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::block_type
+    dynamic_bitset<Block, Allocator>::inverted_block(size_type index) const
+    {
+        const block_type inverted = block_type(~m_blocks[index]);
+        if(index == m_blocks.size() - 1 && extra_bits_number() != 0)
+        {
+            return block_type(inverted & (one_block >> unused_bits_number()));
+        }
+        return inverted;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::block_type
+    dynamic_bitset<Block, Allocator>::get_bits(size_type pos, size_type nbits) const noexcept
+    {
+        assert(nbits > 0 && nbits <= bits_per_block);
+        assert(pos + nbits - 1 < size());
+        const size_type block = block_index(pos);
+        const size_type offset = bit_index(pos);
+        block_type bits = block_type(m_blocks[block] >> offset);
+        if(offset + nbits > bits_per_block)
+        {
+            bits |= block_type(m_blocks[block + 1] << (bits_per_block - offset));
+        }
+        if(nbits < bits_per_block)
+        {
+            bits &= block_type((block_type(1) << nbits) - 1);
+        }
+        return bits;
+    }
+
+    template<typename Block, typename Allocator>
+    template<typename BinaryOperation>
+    constexpr void dynamic_bitset<Block, Allocator>::apply_bits(size_type pos,
+                                                                size_type nbits,
+                                                                block_type bits,
+                                                                BinaryOperation binary_op) noexcept
+    {
+        assert(nbits > 0 && bit_index(pos) + nbits <= bits_per_block);
+        block_type& block = m_blocks[block_index(pos)];
+        if(nbits == bits_per_block)
+        {
+            block = binary_op(block, bits);
+            return;
+        }
+        const block_type mask = bit_mask(pos, pos + nbits - 1);
+        const block_type result = binary_op(block, block_type(bits << bit_index(pos)));
+        block = block_type((block & block_type(~mask)) | (result & mask));
+    }
+
+    template<typename Block, typename Allocator>
+    template<typename BinaryOperation>
+    constexpr void dynamic_bitset<Block, Allocator>::transfer_bits(dynamic_bitset<Block, Allocator>& dst,
+                                                                   size_type dst_pos,
+                                                                   const dynamic_bitset<Block, Allocator>& src,
+                                                                   size_type src_pos,
+                                                                   size_type len,
+                                                                   BinaryOperation binary_op)
+    {
+        assert(dst_pos <= dst.size() && len <= dst.size() - dst_pos);
+        assert(src_pos <= src.size() && len <= src.size() - src_pos);
+        if(len == 0)
+        {
+            return;
+        }
+        instrument(dynamic_bitset_event::bitwise_operation,
+                   block_index(dst_pos + len - 1) - block_index(dst_pos) + 1);
+
+        // the bits are transferred by chunks ending on dst blocks boundaries, so each dst block is
+        // written once, in reverse order if the source bits could be overwritten before being read
+        if(&dst == &src && dst_pos > src_pos)
+        {
+            size_type remaining = len;
+            while(remaining > 0)
+            {
+                const size_type nbits = std::min(remaining, bit_index(dst_pos + remaining - 1) + 1);
+                remaining -= nbits;
+                dst.apply_bits(dst_pos + remaining, nbits, src.get_bits(src_pos + remaining, nbits), binary_op);
+            }
+        }
+        else
+        {
+            size_type done = 0;
+            while(done < len)
+            {
+                const size_type nbits = std::min(len - done, bits_per_block - bit_index(dst_pos + done));
+                dst.apply_bits(dst_pos + done, nbits, src.get_bits(src_pos + done, nbits), binary_op);
+                done += nbits;
+            }
+        }
+        assert(dst.check_consistency());
+    }
+
+    template<typename Block, typename Allocator>
+    template<typename BlockDifference>
+    constexpr typename dynamic_bitset<Block, Allocator>::size_type
+    dynamic_bitset<Block, Allocator>::find_last_different_block(size_type blocks_number,
+                                                                BlockDifference block_difference) noexcept
+    {
+        // chunks of 64 bytes, a cache line on most architectures
+        constexpr size_type chunk_blocks = std::max<size_type>(64 / sizeof(block_type), 1);
+
+        size_type end = blocks_number;
+        while(end >= chunk_blocks)
+        {
+            block_type difference = zero_block;
+            for(size_type i = end - chunk_blocks; i < end; ++i)
+            {
+                difference = block_type(difference | block_difference(i));
+            }
+            if(difference != zero_block)
+            {
+                break;
+            }
+            end -= chunk_blocks;
+        }
+        while(end > 0)
+        {
+            --end;
+            if(block_difference(end) != zero_block)
+            {
+                return end;
+            }
+        }
+        return npos;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr int dynamic_bitset<Block, Allocator>::compare(const dynamic_bitset<Block, Allocator>& lhs,
+                                                            const dynamic_bitset<Block, Allocator>& rhs) noexcept
+    {
+        const size_type lhs_size = lhs.size();
+        const size_type rhs_size = rhs.size();
+        const block_type* const lhs_blocks = lhs.m_blocks.data();
+        const block_type* const rhs_blocks = rhs.m_blocks.data();
+        const auto compare_blocks = [lhs_blocks, rhs_blocks](size_type i) {
+            return lhs_blocks[i] < rhs_blocks[i] ? -1 : 1;
+        };
+        const auto common_blocks_difference = [lhs_blocks, rhs_blocks](size_type i) {
+            return block_type(lhs_blocks[i] ^ rhs_blocks[i]);
+        };
+
+        if(lhs_size == rhs_size)
+        {
+            const size_type i = find_last_different_block(lhs.m_blocks.size(), common_blocks_difference);
+            return i == npos ? 0 : compare_blocks(i);
+        }
+
+        // empty bitset inferior to 0-only bitset
+        if(lhs_size == 0)
+        {
+            return -1;
+        }
+        if(rhs_size == 0)
+        {
+            return 1;
+        }
+
+        // a bit on in the extra blocks of the longest bitset makes it the greatest
+        const bool rhs_longer = rhs_size > lhs_size;
+        const block_type* const longest_blocks = rhs_longer ? rhs_blocks : lhs_blocks;
+        const size_type shortest_blocks_size = std::min(lhs.m_blocks.size(), rhs.m_blocks.size());
+        const size_type longest_blocks_size = std::max(lhs.m_blocks.size(), rhs.m_blocks.size());
+        const size_type extra_block = find_last_different_block(
+          longest_blocks_size - shortest_blocks_size, [longest_blocks, shortest_blocks_size](size_type i) {
+              return longest_blocks[shortest_blocks_size + i];
+          });
+        if(extra_block != npos)
+        {
+            return rhs_longer ? -1 : 1;
+        }
+
+        const size_type i = find_last_different_block(shortest_blocks_size, common_blocks_difference);
+        if(i != npos)
+        {
+            return compare_blocks(i);
+        }
+        return rhs_longer ? -1 : 1;
+    }
+
     template<typename Block, typename Allocator>
     constexpr typename dynamic_bitset<Block, Allocator>::size_type
     dynamic_bitset<Block, Allocator>::extra_bits_number() const noexcept
@@ -3529,6 +7402,44 @@ namespace sul
         }
     }
 
+    template<typename Block, typename Allocator>
+    constexpr void dynamic_bitset<Block, Allocator>::instrument([[maybe_unused]] dynamic_bitset_event event,
+                                                                [[maybe_unused]] size_type blocks) noexcept
+    {
+#if DYNAMIC_BITSET_USE_INSTRUMENTATION
+#    if defined(__cpp_lib_is_constant_evaluated)
+        if(std::is_constant_evaluated())
+        {
+            return;
+        }
+#    endif
+        DYNAMIC_BITSET_INSTRUMENTATION_HOOK(event, blocks);
+#endif
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename dynamic_bitset<Block, Allocator>::size_type
+    dynamic_bitset<Block, Allocator>::instrumented_capacity() const noexcept
+    {
+#if DYNAMIC_BITSET_USE_INSTRUMENTATION
+        return m_blocks.capacity();
+#else
+        return 0;
+#endif
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr void
+    dynamic_bitset<Block, Allocator>::instrument_reallocation([[maybe_unused]] size_type old_capacity) const noexcept
+    {
+#if DYNAMIC_BITSET_USE_INSTRUMENTATION
+        if(m_blocks.capacity() != old_capacity)
+        {
+            instrument(dynamic_bitset_event::reallocation, m_blocks.capacity());
+        }
+#endif
+    }
+
     template<typename Block, typename Allocator>
     constexpr bool dynamic_bitset<Block, Allocator>::check_unused_bits() const noexcept
     {
@@ -3584,40 +7495,99 @@ namespace sul
     constexpr dynamic_bitset<Block, Allocator> operator&(const dynamic_bitset<Block, Allocator>& lhs,
                                                          const dynamic_bitset<Block, Allocator>& rhs)
     {
-        dynamic_bitset<Block, Allocator> result(lhs);
-        return result &= rhs;
+        dynamic_bitset<Block, Allocator> result(lhs, temporary_allocator(lhs.get_allocator()));
+        result &= rhs;
+        return result;
     }
 
     template<typename Block, typename Allocator>
     constexpr dynamic_bitset<Block, Allocator> operator|(const dynamic_bitset<Block, Allocator>& lhs,
                                                          const dynamic_bitset<Block, Allocator>& rhs)
     {
-        dynamic_bitset<Block, Allocator> result(lhs);
-        return result |= rhs;
+        dynamic_bitset<Block, Allocator> result(lhs, temporary_allocator(lhs.get_allocator()));
+        result |= rhs;
+        return result;
     }
 
     template<typename Block, typename Allocator>
     constexpr dynamic_bitset<Block, Allocator> operator^(const dynamic_bitset<Block, Allocator>& lhs,
                                                          const dynamic_bitset<Block, Allocator>& rhs)
     {
-        dynamic_bitset<Block, Allocator> result(lhs);
-        return result ^= rhs;
+        dynamic_bitset<Block, Allocator> result(lhs, temporary_allocator(lhs.get_allocator()));
+        result ^= rhs;
+        return result;
     }
 
     template<typename Block, typename Allocator>
     constexpr dynamic_bitset<Block, Allocator> operator-(const dynamic_bitset<Block, Allocator>& lhs,
                                                          const dynamic_bitset<Block, Allocator>& rhs)
     {
-        dynamic_bitset<Block, Allocator> result(lhs);
-        return result -= rhs;
+        dynamic_bitset<Block, Allocator> result(lhs, temporary_allocator(lhs.get_allocator()));
+        result -= rhs;
+        return result;
+    }
+
+    // index of the stream storage holding the bitset_format
+    inline int bitset_format_index()
+    {
+        static const int index = std::ios_base::xalloc();
+        return index;
+    }
+
+    inline bitset_format get_bitset_format(std::ios_base& str)
+    {
+        return static_cast<bitset_format>(str.iword(bitset_format_index()));
+    }
+
+    inline std::ios_base& binary_bitset(std::ios_base& str)
+    {
+        str.iword(bitset_format_index()) = static_cast<long>(bitset_format::binary);
+        return str;
+    }
+
+    inline std::ios_base& hex_bitset(std::ios_base& str)
+    {
+        str.iword(bitset_format_index()) = static_cast<long>(bitset_format::hex);
+        return str;
+    }
+
+    inline std::ios_base& base64_bitset(std::ios_base& str)
+    {
+        str.iword(bitset_format_index()) = static_cast<long>(bitset_format::base64);
+        return str;
     }
 
     template<typename _CharT, typename _Traits, typename Block, typename Allocator>
     constexpr std::basic_ostream<_CharT, _Traits>& operator<<(std::basic_ostream<_CharT, _Traits>& os,
                                                               const dynamic_bitset<Block, Allocator>& bitset)
     {
-        // A better implementation is possible
-        return os << bitset.template to_string<_CharT, _Traits>();
+        std::string str;
+        switch(get_bitset_format(os))
+        {
+            case bitset_format::hex:
+                str = bitset.to_hex_string();
+                break;
+            case bitset_format::base64:
+                str = bitset.to_base64();
+                break;
+            case bitset_format::binary:
+            default:
+                return os << bitset.template to_string<_CharT, _Traits>();
+        }
+        if constexpr(std::is_same_v<_CharT, char>)
+        {
+            return os << str;
+        }
+        else
+        {
+            std::basic_string<_CharT, _Traits> widened;
+            widened.reserve(str.size());
+            for(const char c: str)
+            {
+                widened.push_back(os.widen(c));
+            }
+            return os << widened;
+        }
     }
 
     template<typename _CharT, typename _Traits, typename Block, typename Allocator>
@@ -3633,7 +7603,7 @@ namespace sul
             return is;
         }
 
-        dynamic_bitset<Block, Allocator> reverse_bitset;
+        dynamic_bitset<Block, Allocator> reverse_bitset(temporary_allocator(bitset.get_allocator()));
         _CharT val;
         is.get(val);
         while(is.good())
@@ -3674,8 +7644,107 @@ namespace sul
         bitset1.swap(bitset2);
     }
 
+    template<typename Block, typename Allocator>
+    constexpr void copy_bits(dynamic_bitset<Block, Allocator>& dst,
+                             size_t dst_pos,
+                             const dynamic_bitset<Block, Allocator>& src,
+                             size_t src_pos,
+                             size_t len)
+    {
+        dynamic_bitset<Block, Allocator>::transfer_bits(
+          dst, dst_pos, src, src_pos, len, [](const Block&, const Block& src_block) {
+              return src_block;
+          });
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr void or_bits(dynamic_bitset<Block, Allocator>& dst,
+                           size_t dst_pos,
+                           const dynamic_bitset<Block, Allocator>& src,
+                           size_t src_pos,
+                           size_t len)
+    {
+        dynamic_bitset<Block, Allocator>::transfer_bits(
+          dst, dst_pos, src, src_pos, len, std::bit_or<Block>());
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr void and_bits(dynamic_bitset<Block, Allocator>& dst,
+                            size_t dst_pos,
+                            const dynamic_bitset<Block, Allocator>& src,
+                            size_t src_pos,
+                            size_t len)
+    {
+        dynamic_bitset<Block, Allocator>::transfer_bits(
+          dst, dst_pos, src, src_pos, len, std::bit_and<Block>());
+    }
+
+#if DYNAMIC_BITSET_CAN_USE_PMR
+    namespace pmr
+    {
+        /**
+         * @brief      @ref sul::dynamic_bitset using a @a std::pmr::polymorphic_allocator.
+         *
+         * @details    The bitsets returned by the operators use the memory resource of their left
+         *             hand side operand, so all the bitsets and temporaries of a computation can be
+         *             allocated in an arena such as @a std::pmr::monotonic_buffer_resource and freed at
+         *             once.
+         *
+         * @remark     Only available if @a DYNAMIC_BITSET_CAN_USE_PMR is @a true (@a
+         *             \<memory_resource\> support).
+         *
+         * @tparam     Block  Block type to use for storing the bits, must be an unsigned integral type
+         *
+         * @since      1.4.0
+         */
+        template<typename Block = unsigned long long>
+        using dynamic_bitset = dynamic_bitset<Block, std::pmr::polymorphic_allocator<Block>>;
+    } // namespace pmr
+#endif
+
 #ifndef DYNAMIC_BITSET_NO_NAMESPACE
 } // namespace sul
 #endif
 
+namespace std
+{
+    /**
+     * @brief      Hash support for @ref sul::dynamic_bitset, to be used as key of unordered containers.
+     *
+     * @details    Defined with @ref sul::dynamic_bitset::hash() with the default seed.
+     *
+     * @tparam     Block      Block type used by the @ref sul::dynamic_bitset for storing the bits
+     * @tparam     Allocator  Allocator type used by the @ref sul::dynamic_bitset for memory management
+     *
+     * @since      1.4.0
+     */
+    template<typename Block, typename Allocator>
+#ifndef DYNAMIC_BITSET_NO_NAMESPACE
+    struct hash<sul::dynamic_bitset<Block, Allocator>>
+#else
+    struct hash<::dynamic_bitset<Block, Allocator>>
+#endif
+    {
+        /**
+         * @brief      Computes the hash of @p bitset.
+         *
+         * @param[in]  bitset  @ref sul::dynamic_bitset to hash
+         *
+         * @return     The hash of @p bitset
+         *
+         * @complexity Linear in the size of @p bitset.
+         *
+         * @since      1.4.0
+         */
+#ifndef DYNAMIC_BITSET_NO_NAMESPACE
+        size_t operator()(const sul::dynamic_bitset<Block, Allocator>& bitset) const noexcept
+#else
+        size_t operator()(const ::dynamic_bitset<Block, Allocator>& bitset) const noexcept
+#endif
+        {
+            return static_cast<size_t>(bitset.hash());
+        }
+    };
+} // namespace std
+
 #endif // SUL_DYNAMIC_BITSET_HPP
@@ -0,0 +1,818 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef SUL_FINGERPRINTED_DYNAMIC_BITSET_HPP
+#define SUL_FINGERPRINTED_DYNAMIC_BITSET_HPP
+
+/** @file
+ * @brief      @ref sul::fingerprinted_dynamic_bitset declaration and implementation.
+ *
+ * @details    Depends on @a sul/dynamic_bitset.hpp.
+ *
+ * @remark     Include multiple standard library headers.
+ *
+ * @since      1.4.0
+ */
+
+#include "dynamic_bitset.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <utility>
+
+#ifndef DYNAMIC_BITSET_NO_NAMESPACE
+namespace sul
+{
+#endif
+
+    /**
+     * @brief      @ref sul::dynamic_bitset maintaining a fingerprint of its content for constant time
+     *             inequality checks.
+     *
+     * @details    The fingerprint is the XOR of a 64-bit mix of each non-zero block with its index,
+     *             it is updated by every modification of the bits for a cost proportional to the
+     *             number of blocks modified, which is never more than the cost of the modification
+     *             itself. @ref operator==() first compares the sizes and the fingerprints and only
+     *             compares the blocks if they are equal, so most mismatches are rejected in constant
+     *             time.
+     *
+     *             The bits can be read with @ref bitset(), but can only be modified with the member
+     *             functions of the @ref fingerprinted_dynamic_bitset (or with @ref modify(), which
+     *             recomputes the whole fingerprint) so the fingerprint is never outdated.
+     *
+     * @tparam     Block      Block type to use for storing the bits, must be an unsigned integral type
+     * @tparam     Allocator  Allocator type to use for memory management, must meet the standard
+     *                        requirements of @a Allocator
+     *
+     * @since      1.4.0
+     */
+    template<typename Block = unsigned long long, typename Allocator = std::allocator<Block>>
+    class fingerprinted_dynamic_bitset
+    {
+    public:
+        /**
+         * @brief      Type of the fingerprinted @ref sul::dynamic_bitset.
+         *
+         * @since      1.4.0
+         */
+        typedef dynamic_bitset<Block, Allocator> bitset_type;
+
+        /**
+         * @brief      Type used to represent the size of a @ref fingerprinted_dynamic_bitset.
+         *
+         * @since      1.4.0
+         */
+        typedef typename bitset_type::size_type size_type;
+
+        /**
+         * @brief      Same type as @p Block.
+         *
+         * @since      1.4.0
+         */
+        typedef typename bitset_type::block_type block_type;
+
+        /**
+         * @brief      Constructs an empty @ref fingerprinted_dynamic_bitset.
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
+         */
+        constexpr fingerprinted_dynamic_bitset() = default;
+
+        /**
+         * @brief      Constructs a @ref fingerprinted_dynamic_bitset of @p nbits bits of value @p
+         *             value.
+         *
+         * @param[in]  nbits  Number of bits of the @ref fingerprinted_dynamic_bitset
+         * @param[in]  value  Value of the bits
+         *
+         * @complexity Linear in @p nbits / @ref bitset_type::bits_per_block.
+         *
+         * @since      1.4.0
+         */
+        constexpr explicit fingerprinted_dynamic_bitset(size_type nbits, bool value = false);
+
+        /**
+         * @brief      Constructs a @ref fingerprinted_dynamic_bitset with the content of @p bitset.
+         *
+         * @param[in]  bitset  @ref sul::dynamic_bitset to copy
+         *
+         * @complexity Linear in the size of @p bitset.
+         *
+         * @since      1.4.0
+         */
+        constexpr explicit fingerprinted_dynamic_bitset(const bitset_type& bitset);
+
+        /**
+         * @brief      Constructs a @ref fingerprinted_dynamic_bitset with the content of @p bitset.
+         *
+         * @param[in]  bitset  @ref sul::dynamic_bitset to move
+         *
+         * @complexity Linear in the size of @p bitset.
+         *
+         * @since      1.4.0
+         */
+        constexpr explicit fingerprinted_dynamic_bitset(bitset_type&& bitset);
+
+        /**
+         * @brief      Gives read-only access to the fingerprinted @ref sul::dynamic_bitset.
+         *
+         * @return     The fingerprinted @ref sul::dynamic_bitset
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] constexpr const bitset_type& bitset() const noexcept;
+
+        /**
+         * @brief      Gives the fingerprint of the content.
+         *
+         * @details    Equal contents have equal fingerprints, the fingerprint does not depend on the
+         *             size. The value is not guaranteed to be stable between versions and must not be
+         *             persisted.
+         *
+         * @return     The fingerprint of the content
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] constexpr unsigned long long fingerprint() const noexcept;
+
+        /**
+         * @brief      Gives the number of bits of the @ref fingerprinted_dynamic_bitset.
+         *
+         * @return     The number of bits
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] constexpr size_type size() const noexcept;
+
+        /**
+         * @brief      Checks if the @ref fingerprinted_dynamic_bitset is empty.
+         *
+         * @return     @a true if it contains no bits, @a false otherwise
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] constexpr bool empty() const noexcept;
+
+        /**
+         * @brief      Test the value of the bit at position @p pos.
+         *
+         * @param[in]  pos   Position of the bit to test
+         *
+         * @return     The value of the bit
+         *
+         * @pre        @code
+         *             pos < size()
+         *             @endcode
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] constexpr bool test(size_type pos) const;
+
+        /**
+         * @brief      Accesses the value of the bit at position @p pos.
+         *
+         * @param[in]  pos   Position of the bit to access
+         *
+         * @return     The value of the bit
+         *
+         * @pre        @code
+         *             pos < size()
+         *             @endcode
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] constexpr bool operator[](size_type pos) const;
+
+        /**
+         * @brief      Set the bits of the range \[@p pos, @p pos + @p len\[ to value @p value, see
+         *             @ref sul::dynamic_bitset::set(size_type, size_type, bool).
+         *
+         * @complexity Linear in @p len.
+         *
+         * @since      1.4.0
+         */
+        constexpr fingerprinted_dynamic_bitset& set(size_type pos, size_type len, bool value);
+
+        /**
+         * @brief      Set the bit at position @p pos to @p value, see @ref
+         *             sul::dynamic_bitset::set(size_type, bool).
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
+         */
+        constexpr fingerprinted_dynamic_bitset& set(size_type pos, bool value = true);
+
+        /**
+         * @brief      Set all the bits to @a true, see @ref sul::dynamic_bitset::set().
+         *
+         * @complexity Linear in the size of the @ref fingerprinted_dynamic_bitset.
+         *
+         * @since      1.4.0
+         */
+        constexpr fingerprinted_dynamic_bitset& set();
+
+        /**
+         * @brief      Reset the bits of the range \[@p pos, @p pos + @p len\[ to @a false, see @ref
+         *             sul::dynamic_bitset::reset(size_type, size_type).
+         *
+         * @complexity Linear in @p len.
+         *
+         * @since      1.4.0
+         */
+        constexpr fingerprinted_dynamic_bitset& reset(size_type pos, size_type len);
+
+        /**
+         * @brief      Reset the bit at position @p pos to @a false, see @ref
+         *             sul::dynamic_bitset::reset(size_type).
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
+         */
+        constexpr fingerprinted_dynamic_bitset& reset(size_type pos);
+
+        /**
+         * @brief      Reset all the bits to @a false, see @ref sul::dynamic_bitset::reset().
+         *
+         * @complexity Linear in the size of the @ref fingerprinted_dynamic_bitset.
+         *
+         * @since      1.4.0
+         */
+        constexpr fingerprinted_dynamic_bitset& reset();
+
+        /**
+         * @brief      Flip the bits of the range \[@p pos, @p pos + @p len\[, see @ref
+         *             sul::dynamic_bitset::flip(size_type, size_type).
+         *
+         * @complexity Linear in @p len.
+         *
+         * @since      1.4.0
+         */
+        constexpr fingerprinted_dynamic_bitset& flip(size_type pos, size_type len);
+
+        /**
+         * @brief      Flip the bit at position @p pos, see @ref sul::dynamic_bitset::flip(size_type).
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
+         */
+        constexpr fingerprinted_dynamic_bitset& flip(size_type pos);
+
+        /**
+         * @brief      Flip all the bits, see @ref sul::dynamic_bitset::flip().
+         *
+         * @complexity Linear in the size of the @ref fingerprinted_dynamic_bitset.
+         *
+         * @since      1.4.0
+         */
+        constexpr fingerprinted_dynamic_bitset& flip();
+
+        /**
+         * @brief      Test the value of the bit at position @p pos and set it to @p value, see @ref
+         *             sul::dynamic_bitset::test_set().
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
+         */
+        constexpr bool test_set(size_type pos, bool value = true);
+
+        /**
+         * @brief      Resize to contain @p nbits bits, see @ref sul::dynamic_bitset::resize().
+         *
+         * @complexity Linear in the difference between @ref size() and @p nbits.
+         *
+         * @since      1.4.0
+         */
+        constexpr void resize(size_type nbits, bool value = false);
+
+        /**
+         * @brief      Clears the @ref fingerprinted_dynamic_bitset, see @ref
+         *             sul::dynamic_bitset::clear().
+         *
+         * @complexity Linear in the size of the @ref fingerprinted_dynamic_bitset.
+         *
+         * @since      1.4.0
+         */
+        constexpr void clear();
+
+        /**
+         * @brief      Add a bit of value @p value at the end, see @ref sul::dynamic_bitset::push_back().
+         *
+         * @complexity Amortized constant.
+         *
+         * @since      1.4.0
+         */
+        constexpr void push_back(bool value);
+
+        /**
+         * @brief      Remove the last bit, see @ref sul::dynamic_bitset::pop_back().
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
+         */
+        constexpr void pop_back();
+
+        /**
+         * @brief      Sets the bits to the result of binary AND with the bits of @p rhs, see @ref
+         *             sul::dynamic_bitset::operator&=().
+         *
+         * @complexity Linear in the size of the @ref fingerprinted_dynamic_bitset.
+         *
+         * @since      1.4.0
+         */
+        constexpr fingerprinted_dynamic_bitset& operator&=(const bitset_type& rhs);
+
+        /**
+         * @brief      Sets the bits to the result of binary OR with the bits of @p rhs, see @ref
+         *             sul::dynamic_bitset::operator|=().
+         *
+         * @complexity Linear in the size of the @ref fingerprinted_dynamic_bitset.
+         *
+         * @since      1.4.0
+         */
+        constexpr fingerprinted_dynamic_bitset& operator|=(const bitset_type& rhs);
+
+        /**
+         * @brief      Sets the bits to the result of binary XOR with the bits of @p rhs, see @ref
+         *             sul::dynamic_bitset::operator^=().
+         *
+         * @complexity Linear in the size of the @ref fingerprinted_dynamic_bitset.
+         *
+         * @since      1.4.0
+         */
+        constexpr fingerprinted_dynamic_bitset& operator^=(const bitset_type& rhs);
+
+        /**
+         * @brief      Sets the bits to the result of the binary difference with the bits of @p rhs,
+         *             see @ref sul::dynamic_bitset::operator-=().
+         *
+         * @complexity Linear in the size of the @ref fingerprinted_dynamic_bitset.
+         *
+         * @since      1.4.0
+         */
+        constexpr fingerprinted_dynamic_bitset& operator-=(const bitset_type& rhs);
+
+        /**
+         * @brief      Performs binary shift left of @p shift bits, see @ref
+         *             sul::dynamic_bitset::operator<<=().
+         *
+         * @complexity Linear in the size of the @ref fingerprinted_dynamic_bitset.
+         *
+         * @since      1.4.0
+         */
+        constexpr fingerprinted_dynamic_bitset& operator<<=(size_type shift);
+
+        /**
+         * @brief      Performs binary shift right of @p shift bits, see @ref
+         *             sul::dynamic_bitset::operator>>=().
+         *
+         * @complexity Linear in the size of the @ref fingerprinted_dynamic_bitset.
+         *
+         * @since      1.4.0
+         */
+        constexpr fingerprinted_dynamic_bitset& operator>>=(size_type shift);
+
+        /**
+         * @brief      Modify the fingerprinted @ref sul::dynamic_bitset with @p function and
+         *             recompute the fingerprint.
+         *
+         * @details    Allow any modification of the @ref sul::dynamic_bitset, the fingerprint is
+         *             recomputed from all the blocks after the call, even if @p function throws.
+         *
+         * @param      function  Function called with a reference to the @ref sul::dynamic_bitset
+         *
+         * @tparam     Function  Type of @p function, must be invocable with a @ref bitset_type&
+         *
+         * @throws     Any exception thrown by @p function, the fingerprint then matches the bits
+         *             modified before the exception
+         *
+         * @complexity Complexity of @p function plus linear in the size of the @ref
+         *             fingerprinted_dynamic_bitset.
+         *
+         * @since      1.4.0
+         */
+        template<typename Function>
+        void modify(Function&& function);
+
+        /**
+         * @brief      Test if two @ref fingerprinted_dynamic_bitset have the same content.
+         *
+         * @details    The blocks are only compared if the sizes and the fingerprints are equal.
+         *
+         * @param[in]  lhs   The left hand side @ref fingerprinted_dynamic_bitset of the operator
+         * @param[in]  rhs   The right hand side @ref fingerprinted_dynamic_bitset of the operator
+         *
+         * @return     @a true if they contain the same bits, @a false otherwise
+         *
+         * @complexity Constant if the sizes or the fingerprints differ, linear in the size of the
+         *             @ref fingerprinted_dynamic_bitset otherwise.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] friend constexpr bool operator==(const fingerprinted_dynamic_bitset& lhs,
+                                                       const fingerprinted_dynamic_bitset& rhs)
+        {
+            return lhs.size() == rhs.size() && lhs.m_fingerprint == rhs.m_fingerprint && lhs.m_bitset == rhs.m_bitset;
+        }
+
+        /**
+         * @brief      Test if two @ref fingerprinted_dynamic_bitset content are different.
+         *
+         * @param[in]  lhs   The left hand side @ref fingerprinted_dynamic_bitset of the operator
+         * @param[in]  rhs   The right hand side @ref fingerprinted_dynamic_bitset of the operator
+         *
+         * @return     @a true if they do not contain the same bits, @a false otherwise
+         *
+         * @complexity Same as @ref operator==().
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] friend constexpr bool operator!=(const fingerprinted_dynamic_bitset& lhs,
+                                                       const fingerprinted_dynamic_bitset& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        static constexpr unsigned long long mix(unsigned long long value) noexcept;
+        // contribution of a block to the fingerprint, 0 for zero blocks
+        static constexpr unsigned long long block_fingerprint(size_type index, block_type block) noexcept;
+        // XOR of the contributions of the blocks [first_block, last_block[
+        constexpr unsigned long long blocks_fingerprint(size_type first_block, size_type last_block) const noexcept;
+
+        // update the fingerprint for a modification of the blocks [first_block, last_block[ by function,
+        // last_block is clamped to the number of blocks before and after the modification, the fingerprint
+        // is unchanged if function throws
+        template<typename Function>
+        constexpr void update(size_type first_block, size_type last_block, Function&& function);
+
+        bitset_type m_bitset;
+        unsigned long long m_fingerprint = 0;
+    };
+
+    //=================================================================================================
+    // fingerprinted_dynamic_bitset functions implementations
+    //=================================================================================================
+
+    template<typename Block, typename Allocator>
+    constexpr fingerprinted_dynamic_bitset<Block, Allocator>::fingerprinted_dynamic_bitset(size_type nbits, bool value)
+    {
+        resize(nbits, value);
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr fingerprinted_dynamic_bitset<Block, Allocator>::fingerprinted_dynamic_bitset(const bitset_type& bitset)
+        : m_bitset(bitset)
+        , m_fingerprint(blocks_fingerprint(0, m_bitset.num_blocks()))
+    {
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr fingerprinted_dynamic_bitset<Block, Allocator>::fingerprinted_dynamic_bitset(bitset_type&& bitset)
+        : m_bitset(std::move(bitset))
+        , m_fingerprint(blocks_fingerprint(0, m_bitset.num_blocks()))
+    {
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr const typename fingerprinted_dynamic_bitset<Block, Allocator>::bitset_type&
+    fingerprinted_dynamic_bitset<Block, Allocator>::bitset() const noexcept
+    {
+        return m_bitset;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr unsigned long long fingerprinted_dynamic_bitset<Block, Allocator>::fingerprint() const noexcept
+    {
+        return m_fingerprint;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr typename fingerprinted_dynamic_bitset<Block, Allocator>::size_type
+    fingerprinted_dynamic_bitset<Block, Allocator>::size() const noexcept
+    {
+        return m_bitset.size();
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr bool fingerprinted_dynamic_bitset<Block, Allocator>::empty() const noexcept
+    {
+        return m_bitset.empty();
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr bool fingerprinted_dynamic_bitset<Block, Allocator>::test(size_type pos) const
+    {
+        return m_bitset.test(pos);
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr bool fingerprinted_dynamic_bitset<Block, Allocator>::operator[](size_type pos) const
+    {
+        return m_bitset[pos];
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr fingerprinted_dynamic_bitset<Block, Allocator>&
+    fingerprinted_dynamic_bitset<Block, Allocator>::set(size_type pos, size_type len, bool value)
+    {
+        if(len == 0)
+        {
+            m_bitset.set(pos, len, value);
+            return *this;
+        }
+        update(pos / bitset_type::bits_per_block, (pos + len - 1) / bitset_type::bits_per_block + 1, [&]() {
+            m_bitset.set(pos, len, value);
+        });
+        return *this;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr fingerprinted_dynamic_bitset<Block, Allocator>&
+    fingerprinted_dynamic_bitset<Block, Allocator>::set(size_type pos, bool value)
+    {
+        const size_type block = pos / bitset_type::bits_per_block;
+        update(block, block + 1, [&]() {
+            m_bitset.set(pos, value);
+        });
+        return *this;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr fingerprinted_dynamic_bitset<Block, Allocator>& fingerprinted_dynamic_bitset<Block, Allocator>::set()
+    {
+        update(0, bitset_type::npos, [&]() {
+            m_bitset.set();
+        });
+        return *this;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr fingerprinted_dynamic_bitset<Block, Allocator>&
+    fingerprinted_dynamic_bitset<Block, Allocator>::reset(size_type pos, size_type len)
+    {
+        return set(pos, len, false);
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr fingerprinted_dynamic_bitset<Block, Allocator>&
+    fingerprinted_dynamic_bitset<Block, Allocator>::reset(size_type pos)
+    {
+        return set(pos, false);
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr fingerprinted_dynamic_bitset<Block, Allocator>& fingerprinted_dynamic_bitset<Block, Allocator>::reset()
+    {
+        m_bitset.reset();
+        m_fingerprint = 0;
+        return *this;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr fingerprinted_dynamic_bitset<Block, Allocator>&
+    fingerprinted_dynamic_bitset<Block, Allocator>::flip(size_type pos, size_type len)
+    {
+        if(len == 0)
+        {
+            m_bitset.flip(pos, len);
+            return *this;
+        }
+        update(pos / bitset_type::bits_per_block, (pos + len - 1) / bitset_type::bits_per_block + 1, [&]() {
+            m_bitset.flip(pos, len);
+        });
+        return *this;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr fingerprinted_dynamic_bitset<Block, Allocator>&
+    fingerprinted_dynamic_bitset<Block, Allocator>::flip(size_type pos)
+    {
+        const size_type block = pos / bitset_type::bits_per_block;
+        update(block, block + 1, [&]() {
+            m_bitset.flip(pos);
+        });
+        return *this;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr fingerprinted_dynamic_bitset<Block, Allocator>& fingerprinted_dynamic_bitset<Block, Allocator>::flip()
+    {
+        update(0, bitset_type::npos, [&]() {
+            m_bitset.flip();
+        });
+        return *this;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr bool fingerprinted_dynamic_bitset<Block, Allocator>::test_set(size_type pos, bool value)
+    {
+        const bool previous = m_bitset.test(pos);
+        if(previous != value)
+        {
+            flip(pos);
+        }
+        return previous;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr void fingerprinted_dynamic_bitset<Block, Allocator>::resize(size_type nbits, bool value)
+    {
+        // only the blocks from the one containing the last kept bit are modified
+        update(std::min(nbits, m_bitset.size()) / bitset_type::bits_per_block, bitset_type::npos, [&]() {
+            m_bitset.resize(nbits, value);
+        });
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr void fingerprinted_dynamic_bitset<Block, Allocator>::clear()
+    {
+        m_bitset.clear();
+        m_fingerprint = 0;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr void fingerprinted_dynamic_bitset<Block, Allocator>::push_back(bool value)
+    {
+        update(m_bitset.size() / bitset_type::bits_per_block, bitset_type::npos, [&]() {
+            m_bitset.push_back(value);
+        });
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr void fingerprinted_dynamic_bitset<Block, Allocator>::pop_back()
+    {
+        if(m_bitset.empty())
+        {
+            return;
+        }
+        update((m_bitset.size() - 1) / bitset_type::bits_per_block, bitset_type::npos, [&]() {
+            m_bitset.pop_back();
+        });
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr fingerprinted_dynamic_bitset<Block, Allocator>&
+    fingerprinted_dynamic_bitset<Block, Allocator>::operator&=(const bitset_type& rhs)
+    {
+        update(0, bitset_type::npos, [&]() {
+            m_bitset &= rhs;
+        });
+        return *this;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr fingerprinted_dynamic_bitset<Block, Allocator>&
+    fingerprinted_dynamic_bitset<Block, Allocator>::operator|=(const bitset_type& rhs)
+    {
+        update(0, bitset_type::npos, [&]() {
+            m_bitset |= rhs;
+        });
+        return *this;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr fingerprinted_dynamic_bitset<Block, Allocator>&
+    fingerprinted_dynamic_bitset<Block, Allocator>::operator^=(const bitset_type& rhs)
+    {
+        update(0, bitset_type::npos, [&]() {
+            m_bitset ^= rhs;
+        });
+        return *this;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr fingerprinted_dynamic_bitset<Block, Allocator>&
+    fingerprinted_dynamic_bitset<Block, Allocator>::operator-=(const bitset_type& rhs)
+    {
+        update(0, bitset_type::npos, [&]() {
+            m_bitset -= rhs;
+        });
+        return *this;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr fingerprinted_dynamic_bitset<Block, Allocator>&
+    fingerprinted_dynamic_bitset<Block, Allocator>::operator<<=(size_type shift)
+    {
+        update(0, bitset_type::npos, [&]() {
+            m_bitset <<= shift;
+        });
+        return *this;
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr fingerprinted_dynamic_bitset<Block, Allocator>&
+    fingerprinted_dynamic_bitset<Block, Allocator>::operator>>=(size_type shift)
+    {
+        update(0, bitset_type::npos, [&]() {
+            m_bitset >>= shift;
+        });
+        return *this;
+    }
+
+    template<typename Block, typename Allocator>
+    template<typename Function>
+    void fingerprinted_dynamic_bitset<Block, Allocator>::modify(Function&& function)
+    {
+        try
+        {
+            std::forward<Function>(function)(m_bitset);
+        }
+        catch(...)
+        {
+            // the bits may have been modified before the exception
+            m_fingerprint = blocks_fingerprint(0, m_bitset.num_blocks());
+            throw;
+        }
+        m_fingerprint = blocks_fingerprint(0, m_bitset.num_blocks());
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr unsigned long long fingerprinted_dynamic_bitset<Block, Allocator>::mix(unsigned long long value) noexcept
+    {
+        // splitmix64 finalizer
+        value += 0x9E3779B97F4A7C15ull;
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+        return value ^ (value >> 31);
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr unsigned long long
+    fingerprinted_dynamic_bitset<Block, Allocator>::block_fingerprint(size_type index, block_type block) noexcept
+    {
+        if(block == block_type(0))
+        {
+            return 0;
+        }
+
+        constexpr size_t ull_bits_number = std::numeric_limits<unsigned long long>::digits;
+        unsigned long long value = static_cast<unsigned long long>(block);
+        if constexpr(bitset_type::bits_per_block > ull_bits_number)
+        {
+            for(size_t shift = ull_bits_number; shift < bitset_type::bits_per_block; shift += ull_bits_number)
+            {
+                value ^= mix(static_cast<unsigned long long>(block >> shift));
+            }
+        }
+        return mix(value ^ mix(static_cast<unsigned long long>(index)));
+    }
+
+    template<typename Block, typename Allocator>
+    constexpr unsigned long long
+    fingerprinted_dynamic_bitset<Block, Allocator>::blocks_fingerprint(size_type first_block,
+                                                                        size_type last_block) const noexcept
+    {
+        const block_type* const blocks = m_bitset.data();
+        unsigned long long result = 0;
+        for(size_type i = first_block; i < last_block; ++i)
+        {
+            result ^= block_fingerprint(i, blocks[i]);
+        }
+        return result;
+    }
+
+    template<typename Block, typename Allocator>
+    template<typename Function>
+    constexpr void fingerprinted_dynamic_bitset<Block, Allocator>::update(size_type first_block,
+                                                                          size_type last_block,
+                                                                          Function&& function)
+    {
+        // the fingerprint is only updated once the modification succeeded, so that it still matches the
+        // unmodified bits if the modification throws
+        const unsigned long long old_fingerprint =
+          blocks_fingerprint(first_block, std::min(last_block, m_bitset.num_blocks()));
+        std::forward<Function>(function)();
+        m_fingerprint ^= old_fingerprint ^ blocks_fingerprint(first_block, std::min(last_block, m_bitset.num_blocks()));
+    }
+
+#ifndef DYNAMIC_BITSET_NO_NAMESPACE
+} // namespace sul
+#endif
+
+#endif // SUL_FINGERPRINTED_DYNAMIC_BITSET_HPP
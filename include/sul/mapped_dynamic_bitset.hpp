@@ -0,0 +1,639 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef SUL_MAPPED_DYNAMIC_BITSET_HPP
+#define SUL_MAPPED_DYNAMIC_BITSET_HPP
+
+/** @file
+ * @brief      @ref sul::mapped_dynamic_bitset declaration and implementation.
+ *
+ * @details    Depends on @a sul/dynamic_bitset.hpp and @a sul/mmap_allocator.hpp.
+ *
+ *             @ref sul::mapped_dynamic_bitset is only declared if the POSIX memory mapping and file
+ *             functions are available, in which case @a SUL_MAPPED_DYNAMIC_BITSET_AVAILABLE is
+ *             defined to @a true.
+ *
+ * @remark     Include multiple standard library headers, @a sys/mman.h, @a sys/stat.h, @a fcntl.h
+ *             and @a unistd.h.
+ *
+ * @since      1.4.0
+ */
+
+#include "dynamic_bitset.hpp"
+#include "mmap_allocator.hpp"
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+// define SUL_MAPPED_DYNAMIC_BITSET_AVAILABLE
+#if SUL_MMAP_ALLOCATOR_AVAILABLE && __has_include(<fcntl.h>) && __has_include(<sys/stat.h>)
+#    include <fcntl.h>
+#    include <sys/stat.h>
+#    define SUL_MAPPED_DYNAMIC_BITSET_AVAILABLE true
+#else
+#    define SUL_MAPPED_DYNAMIC_BITSET_AVAILABLE false
+#endif
+
+#if SUL_MAPPED_DYNAMIC_BITSET_AVAILABLE
+
+#    ifndef DYNAMIC_BITSET_NO_NAMESPACE
+namespace sul
+{
+#    endif
+
+    /**
+     * @brief      File holding the blocks of a @ref mapped_dynamic_bitset.
+     *
+     * @details    The file starts with a header followed, at a page aligned offset, by the raw blocks.
+     *             Used by @ref mapped_file_allocator to map the blocks storage, not intended to be used
+     *             directly.
+     *
+     * @since      1.4.0
+     */
+    class mapped_file
+    {
+    public:
+        /**
+         * @brief      Header stored at the beginning of the file.
+         *
+         * @since      1.4.0
+         */
+        struct header
+        {
+            char magic[8];              ///< Identifies the file format
+            std::uint32_t version;      ///< File format version
+            std::uint32_t block_size;   ///< Size in bytes of the blocks
+            std::uint64_t data_offset;  ///< Offset in bytes of the first block in the file
+            std::uint64_t bits_number;  ///< Number of bits stored in the file
+        };
+
+        /**
+         * @brief      Open the file at @p path, creating it if it does not exist.
+         *
+         * @param[in]  path        Path of the file
+         * @param[in]  block_size  Size in bytes of the blocks stored in the file
+         *
+         * @throws     std::system_error   if the file can't be opened, read or written
+         * @throws     std::runtime_error  if the file is not a valid bitset file for @p block_size
+         *
+         * @since      1.4.0
+         */
+        mapped_file(const std::string& path, size_t block_size);
+
+        mapped_file(const mapped_file&) = delete;
+        mapped_file& operator=(const mapped_file&) = delete;
+
+        /**
+         * @brief      Close the file, the mappings remain valid until unmapped.
+         *
+         * @since      1.4.0
+         */
+        ~mapped_file();
+
+        /**
+         * @brief      Get the number of bits stored in the file, as of the last header write.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] size_t stored_bits_number() const noexcept;
+
+        /**
+         * @brief      Write @p bits_number in the file header.
+         *
+         * @param[in]  bits_number  Number of bits stored in the file
+         *
+         * @throws     std::system_error  if the header can't be written
+         *
+         * @since      1.4.0
+         */
+        void write_header(size_t bits_number);
+
+        /**
+         * @brief      Map @p size bytes of blocks of the file, growing the file if needed.
+         *
+         * @details    The file is never shrunk, mappings of different sizes share the same blocks.
+         *
+         * @param[in]  size  Number of bytes to map, multiple of the page size
+         *
+         * @return     Pointer to the first block
+         *
+         * @throws     std::bad_alloc  if the file can't be grown or mapped
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] void* map(size_t size);
+
+        /**
+         * @brief      Flush @p size bytes of the mapping starting at @p data, and the header, to the file.
+         *
+         * @param      data  Pointer returned by @ref map()
+         * @param[in]  size  Number of bytes to flush
+         * @param[in]  wait  Wait for the data to be written, otherwise only schedule the write
+         *
+         * @throws     std::system_error  if the flush fails
+         *
+         * @since      1.4.0
+         */
+        void sync(void* data, size_t size, bool wait);
+
+        /**
+         * @brief      If @a true, blocks constructed without value are left with the file content.
+         *
+         * @details    @a true until the container mapping the file adopted the stored blocks, so that
+         *             they are not read or written when opening the file.
+         *
+         * @since      1.4.0
+         */
+        bool adopt_blocks = true;
+
+    private:
+        static constexpr char file_magic[8] = {'S', 'U', 'L', 'B', 'I', 'T', 'S', '\0'};
+        static constexpr std::uint32_t file_version = 1;
+
+        [[noreturn]] static void throw_errno(const char* what);
+
+        int m_fd;
+        header m_header;
+    };
+
+    /**
+     * @brief      Allocator mapping the storage from a @ref mapped_file.
+     *
+     * @details    Allocator used by @ref mapped_dynamic_bitset, the storage of all the allocations
+     *             made with the same file start at the first block of the file, as the storage of a
+     *             @a std::vector is reallocated by allocating the new storage before moving the
+     *             elements from the old one, the reallocations do not move the blocks.
+     *
+     *             Copies of a container using a file allocator use anonymous memory from a @ref
+     *             mmap_allocator (@ref select_on_container_copy_construction()), so that copies made
+     *             by the operators of @ref dynamic_bitset don't write into the file.
+     *
+     * @tparam     T     Type of the allocated elements
+     *
+     * @since      1.4.0
+     */
+    template<typename T>
+    class mapped_file_allocator
+    {
+    public:
+        /**
+         * @brief      Type of the allocated elements.
+         *
+         * @since      1.4.0
+         */
+        typedef T value_type;
+
+        /**
+         * @brief      Rebind the allocator to another type of elements.
+         *
+         * @tparam     U     Type of the allocated elements of the rebound allocator
+         *
+         * @since      1.4.0
+         */
+        template<typename U>
+        struct rebind
+        {
+            /**
+             * @brief      Rebound allocator type.
+             */
+            typedef mapped_file_allocator<U> other;
+        };
+
+        /**
+         * @brief      Constructs a @ref mapped_file_allocator.
+         *
+         * @param      file  File to map the storage from, anonymous memory is used if @a nullptr
+         *
+         * @since      1.4.0
+         */
+        constexpr explicit mapped_file_allocator(mapped_file* file = nullptr) noexcept;
+
+        /**
+         * @brief      Constructs a @ref mapped_file_allocator from an allocator of another type of
+         *             elements.
+         *
+         * @param      other  Allocator to copy the file from
+         *
+         * @tparam     U      Type of the elements allocated by the other allocator
+         *
+         * @since      1.4.0
+         */
+        template<typename U>
+        constexpr mapped_file_allocator(const mapped_file_allocator<U>& other) noexcept;
+
+        /**
+         * @brief      Allocate storage for @p n elements of type @p T.
+         *
+         * @param[in]  n     Number of elements to allocate storage for
+         *
+         * @return     Pointer to the first element of the storage
+         *
+         * @throws     std::bad_alloc  if the mapping fails
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] T* allocate(size_t n);
+
+        /**
+         * @brief      Deallocate the storage pointed by @p p, unmapping its memory.
+         *
+         * @param      p     Pointer obtained from @ref allocate()
+         * @param[in]  n     Number of elements passed to @ref allocate()
+         *
+         * @since      1.4.0
+         */
+        void deallocate(T* p, size_t n) noexcept;
+
+        /**
+         * @brief      Constructs an element at @p p from @p args.
+         *
+         * @since      1.4.0
+         */
+        template<typename U, typename... Args>
+        void construct(U* p, Args&&... args) noexcept(std::is_nothrow_constructible_v<U, Args...>);
+
+        /**
+         * @brief      Constructs an element without value at @p p, value-initialized unless the file
+         *             blocks are being adopted (see @ref mapped_file::adopt_blocks).
+         *
+         * @since      1.4.0
+         */
+        template<typename U>
+        void construct(U* p) noexcept(std::is_nothrow_default_constructible_v<U>);
+
+        /**
+         * @brief      Get the allocator used by a copy of a container using this allocator.
+         *
+         * @return     An allocator using anonymous memory
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] constexpr mapped_file_allocator select_on_container_copy_construction() const noexcept;
+
+        /**
+         * @brief      Get the file the storage is mapped from, @a nullptr for anonymous memory.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] constexpr mapped_file* file() const noexcept;
+
+        /**
+         * @brief      Test if two @ref mapped_file_allocator map the same file.
+         *
+         * @since      1.4.0
+         */
+        template<typename U>
+        [[nodiscard]] constexpr bool operator==(const mapped_file_allocator<U>& other) const noexcept;
+
+        /**
+         * @brief      Test if two @ref mapped_file_allocator map different files.
+         *
+         * @since      1.4.0
+         */
+        template<typename U>
+        [[nodiscard]] constexpr bool operator!=(const mapped_file_allocator<U>& other) const noexcept;
+
+    private:
+        static size_t mapping_size(size_t n) noexcept;
+
+        mapped_file* m_file;
+    };
+
+    /**
+     * @brief      Dynamic bitset stored in a file through a shared memory mapping.
+     *
+     * @details    A @ref dynamic_bitset whose blocks live in a file: opening an existing file maps its
+     *             blocks without reading or parsing them, and the modifications are written back to the
+     *             file by the kernel. The full query and mutation API of @ref dynamic_bitset is
+     *             available, @ref resize() and the other growing operations grow the file.
+     *
+     *             The file stores a small header followed by the raw blocks, it is only portable
+     *             between systems with the same endianness. The number of bits stored in the header is
+     *             updated by @ref flush() and on destruction, the file is never shrunk.
+     *
+     *             Copies of a @ref mapped_dynamic_bitset, like the results of the non-assignment
+     *             operators, are regular bitsets using anonymous memory; a @ref mapped_dynamic_bitset
+     *             is not copyable, movable or swappable itself.
+     *
+     * @tparam     Block  Block type to use for storing the bits, must be an unsigned integral type
+     *
+     * @since      1.4.0
+     */
+    template<typename Block = unsigned long long>
+    class mapped_dynamic_bitset
+      : private mapped_file
+      , public dynamic_bitset<Block, mapped_file_allocator<Block>>
+    {
+    public:
+        /**
+         * @brief      Type of the underlying @ref dynamic_bitset.
+         *
+         * @since      1.4.0
+         */
+        typedef dynamic_bitset<Block, mapped_file_allocator<Block>> base_type;
+
+        using base_type::operator=;
+
+        /**
+         * @brief      Open the bitset stored in the file at @p path, creating an empty bitset if the
+         *             file does not exist.
+         *
+         * @param[in]  path  Path of the file
+         *
+         * @throws     std::system_error   if the file can't be opened, read or written
+         * @throws     std::runtime_error  if the file is not a valid bitset file for @p Block
+         *
+         * @complexity Constant (the blocks are not read).
+         *
+         * @since      1.4.0
+         */
+        explicit mapped_dynamic_bitset(const std::string& path);
+
+        mapped_dynamic_bitset(const mapped_dynamic_bitset&) = delete;
+        mapped_dynamic_bitset& operator=(const mapped_dynamic_bitset&) = delete;
+
+        /**
+         * @brief      Write the number of bits in the file header and unmap the file.
+         *
+         * @details    The mapped blocks are written to the file by the kernel, call @ref flush() before
+         *             to wait for the write.
+         *
+         * @since      1.4.0
+         */
+        ~mapped_dynamic_bitset();
+
+        /**
+         * @brief      Flush the blocks and the number of bits to the file (with @a msync).
+         *
+         * @param[in]  wait  Wait for the data to be written (@a MS_SYNC), otherwise only schedule
+         *                   the write (@a MS_ASYNC)
+         *
+         * @throws     std::system_error  if the flush fails
+         *
+         * @complexity Linear in the number of modified pages.
+         *
+         * @since      1.4.0
+         */
+        void flush(bool wait = true);
+    };
+
+    //=================================================================================================
+    // mapped_file functions implementations
+    //=================================================================================================
+
+    inline mapped_file::mapped_file(const std::string& path, size_t block_size)
+        : m_fd(::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644)), m_header()
+    {
+        if(m_fd == -1)
+        {
+            throw_errno("open");
+        }
+
+        struct stat file_stat;
+        if(::fstat(m_fd, &file_stat) == -1)
+        {
+            ::close(m_fd);
+            throw_errno("fstat");
+        }
+
+        if(file_stat.st_size == 0)
+        {
+            // new file, the blocks start on the first page after the header
+            std::memcpy(m_header.magic, file_magic, sizeof(file_magic));
+            m_header.version = file_version;
+            m_header.block_size = static_cast<std::uint32_t>(block_size);
+            m_header.data_offset = static_cast<std::uint64_t>(::sysconf(_SC_PAGESIZE));
+            try
+            {
+                write_header(0);
+            }
+            catch(...)
+            {
+                ::close(m_fd);
+                throw;
+            }
+            return;
+        }
+
+        const bool header_read = ::pread(m_fd, &m_header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header));
+        const std::uint64_t page_size = static_cast<std::uint64_t>(::sysconf(_SC_PAGESIZE));
+        const bool header_valid = header_read && std::memcmp(m_header.magic, file_magic, sizeof(file_magic)) == 0
+                                  && m_header.version == file_version && m_header.block_size == block_size
+                                  && m_header.data_offset != 0 && m_header.data_offset % page_size == 0;
+        const std::uint64_t block_bits = std::uint64_t(block_size) * 8;
+        const std::uint64_t stored_bytes = (m_header.bits_number + block_bits - 1) / block_bits * block_size;
+        if(!header_valid || static_cast<std::uint64_t>(file_stat.st_size) < m_header.data_offset + stored_bytes)
+        {
+            ::close(m_fd);
+            throw std::runtime_error("mapped_file: invalid bitset file");
+        }
+    }
+
+    inline mapped_file::~mapped_file()
+    {
+        ::close(m_fd);
+    }
+
+    inline size_t mapped_file::stored_bits_number() const noexcept
+    {
+        return static_cast<size_t>(m_header.bits_number);
+    }
+
+    inline void mapped_file::write_header(size_t bits_number)
+    {
+        m_header.bits_number = bits_number;
+        if(::pwrite(m_fd, &m_header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header)))
+        {
+            throw_errno("pwrite");
+        }
+    }
+
+    inline void* mapped_file::map(size_t size)
+    {
+        struct stat file_stat;
+        if(::fstat(m_fd, &file_stat) == -1)
+        {
+            throw std::bad_alloc();
+        }
+        const off_t required_size = static_cast<off_t>(m_header.data_offset + size);
+        if(file_stat.st_size < required_size && ::ftruncate(m_fd, required_size) == -1)
+        {
+            throw std::bad_alloc();
+        }
+
+        void* const mapping = ::mmap(
+          nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, static_cast<off_t>(m_header.data_offset));
+        if(mapping == MAP_FAILED)
+        {
+            throw std::bad_alloc();
+        }
+        return mapping;
+    }
+
+    inline void mapped_file::sync(void* data, size_t size, bool wait)
+    {
+        if(data != nullptr && size != 0 && ::msync(data, size, wait ? MS_SYNC : MS_ASYNC) == -1)
+        {
+            throw_errno("msync");
+        }
+        if(wait && ::fsync(m_fd) == -1)
+        {
+            throw_errno("fsync");
+        }
+    }
+
+    inline void mapped_file::throw_errno(const char* what)
+    {
+        throw std::system_error(errno, std::generic_category(), std::string("mapped_file: ") + what);
+    }
+
+    //=================================================================================================
+    // mapped_file_allocator functions implementations
+    //=================================================================================================
+
+    template<typename T>
+    constexpr mapped_file_allocator<T>::mapped_file_allocator(mapped_file* file) noexcept : m_file(file)
+    {
+    }
+
+    template<typename T>
+    template<typename U>
+    constexpr mapped_file_allocator<T>::mapped_file_allocator(const mapped_file_allocator<U>& other) noexcept
+        : m_file(other.file())
+    {
+    }
+
+    template<typename T>
+    T* mapped_file_allocator<T>::allocate(size_t n)
+    {
+        if(m_file == nullptr)
+        {
+            return mmap_allocator<T>().allocate(n);
+        }
+        if(n > (std::numeric_limits<size_t>::max() / 2) / sizeof(T))
+        {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(m_file->map(mapping_size(n)));
+    }
+
+    template<typename T>
+    void mapped_file_allocator<T>::deallocate(T* p, size_t n) noexcept
+    {
+        if(m_file == nullptr)
+        {
+            mmap_allocator<T>().deallocate(p, n);
+            return;
+        }
+        ::munmap(static_cast<void*>(p), mapping_size(n));
+    }
+
+    template<typename T>
+    template<typename U, typename... Args>
+    void mapped_file_allocator<T>::construct(U* p, Args&&... args) noexcept(std::is_nothrow_constructible_v<U, Args...>)
+    {
+        ::new(static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+
+    template<typename T>
+    template<typename U>
+    void mapped_file_allocator<T>::construct(U* p) noexcept(std::is_nothrow_default_constructible_v<U>)
+    {
+        if(m_file != nullptr && m_file->adopt_blocks)
+        {
+            ::new(static_cast<void*>(p)) U;
+        }
+        else
+        {
+            ::new(static_cast<void*>(p)) U();
+        }
+    }
+
+    template<typename T>
+    constexpr mapped_file_allocator<T> mapped_file_allocator<T>::select_on_container_copy_construction()
+      const noexcept
+    {
+        return mapped_file_allocator();
+    }
+
+    template<typename T>
+    constexpr mapped_file* mapped_file_allocator<T>::file() const noexcept
+    {
+        return m_file;
+    }
+
+    template<typename T>
+    template<typename U>
+    constexpr bool mapped_file_allocator<T>::operator==(const mapped_file_allocator<U>& other) const noexcept
+    {
+        return m_file == other.file();
+    }
+
+    template<typename T>
+    template<typename U>
+    constexpr bool mapped_file_allocator<T>::operator!=(const mapped_file_allocator<U>& other) const noexcept
+    {
+        return m_file != other.file();
+    }
+
+    template<typename T>
+    size_t mapped_file_allocator<T>::mapping_size(size_t n) noexcept
+    {
+        const size_t bytes = (n == 0 ? 1 : n) * sizeof(T);
+        const size_t page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        return (bytes + page_size - 1) / page_size * page_size;
+    }
+
+    //=================================================================================================
+    // mapped_dynamic_bitset functions implementations
+    //=================================================================================================
+
+    template<typename Block>
+    mapped_dynamic_bitset<Block>::mapped_dynamic_bitset(const std::string& path)
+        : mapped_file(path, sizeof(Block))
+        , base_type(mapped_file_allocator<Block>(this))
+    {
+        this->resize_for_overwrite(stored_bits_number());
+        adopt_blocks = false;
+    }
+
+    template<typename Block>
+    mapped_dynamic_bitset<Block>::~mapped_dynamic_bitset()
+    {
+        try
+        {
+            write_header(this->size());
+        }
+        catch(...)
+        {
+            // the blocks are still written, only the size may be outdated
+        }
+    }
+
+    template<typename Block>
+    void mapped_dynamic_bitset<Block>::flush(bool wait)
+    {
+        write_header(this->size());
+        sync(this->data(), this->num_blocks() * sizeof(Block), wait);
+    }
+
+#    ifndef DYNAMIC_BITSET_NO_NAMESPACE
+} // namespace sul
+#    endif
+
+#endif // SUL_MAPPED_DYNAMIC_BITSET_AVAILABLE
+
+#endif // SUL_MAPPED_DYNAMIC_BITSET_HPP
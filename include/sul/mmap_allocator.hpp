@@ -0,0 +1,311 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef SUL_MMAP_ALLOCATOR_HPP
+#define SUL_MMAP_ALLOCATOR_HPP
+
+/** @file
+ * @brief      @ref sul::mmap_allocator declaration and implementation.
+ *
+ * @details    Standalone file, does not depend on other implementation files or dependencies other
+ *             than the standard library and the POSIX memory mapping functions.
+ *
+ *             @ref sul::mmap_allocator is only declared if @a \<sys/mman.h\> and @a \<unistd.h\> are
+ *             available, in which case @a SUL_MMAP_ALLOCATOR_AVAILABLE is defined to @a true.
+ *
+ * @remark     Include multiple standard library headers, @a sys/mman.h and @a unistd.h.
+ *
+ * @since      1.4.0
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+// define SUL_MMAP_ALLOCATOR_AVAILABLE
+#if __has_include(<sys/mman.h>) && __has_include(<unistd.h>)
+#    include <sys/mman.h>
+#    include <unistd.h>
+#    define SUL_MMAP_ALLOCATOR_AVAILABLE true
+#else
+#    define SUL_MMAP_ALLOCATOR_AVAILABLE false
+#endif
+
+#if SUL_MMAP_ALLOCATOR_AVAILABLE
+
+#    ifndef DYNAMIC_BITSET_NO_NAMESPACE
+namespace sul
+{
+#    endif
+
+    /**
+     * @brief      Allocator obtaining memory directly from the kernel with anonymous memory
+     *             mappings.
+     *
+     * @details    Meet the standard requirements of @a Allocator and is intended to be used as @p
+     *             Allocator of @ref sul::dynamic_bitset for multi-gigabytes bitsets:
+     *             - the memory is obtained with @a mmap and returned with @a munmap, so it is
+     *               given back to the system as soon as it is deallocated;
+     *             - allocations of at least @ref huge_page_size bytes are aligned on @ref
+     *               huge_page_size bytes and advised with @a MADV_HUGEPAGE (if available) to be
+     *               backed by transparent huge pages, reducing TLB misses during full scans;
+     *             - if @p Populate is @a true, the pages are pre-faulted on allocation
+     *               (@a MADV_POPULATE_WRITE, or @a MAP_POPULATE, or by writing a byte per page when
+     *               the running kernel does not support @a MADV_POPULATE_WRITE), moving the page
+     *               faults cost out of the first scan.
+     *
+     *             Growing a @ref sul::dynamic_bitset allocates new storage and copies the blocks,
+     *             the copy can be avoided by reserving the final capacity upfront: the pages of an
+     *             anonymous mapping are only backed by physical memory once written, so reserving
+     *             more than needed only costs address space.
+     *
+     * @tparam     T         Type of the allocated elements
+     * @tparam     Populate  Pre-fault the pages on allocation
+     *
+     * @since      1.4.0
+     */
+    template<typename T, bool Populate = false>
+    class mmap_allocator
+    {
+    public:
+        /**
+         * @brief      Type of the allocated elements.
+         *
+         * @since      1.4.0
+         */
+        typedef T value_type;
+
+        /**
+         * @brief      All @ref mmap_allocator instances are equal.
+         *
+         * @since      1.4.0
+         */
+        typedef std::true_type is_always_equal;
+
+        /**
+         * @brief      Rebind the allocator to another type of elements, keeping @p Populate.
+         *
+         * @tparam     U     Type of the allocated elements of the rebound allocator
+         *
+         * @since      1.4.0
+         */
+        template<typename U>
+        struct rebind
+        {
+            /**
+             * @brief      Rebound allocator type.
+             */
+            typedef mmap_allocator<U, Populate> other;
+        };
+
+        /**
+         * @brief      Size in bytes of the huge pages allocations are aligned on.
+         *
+         * @since      1.4.0
+         */
+        static constexpr size_t huge_page_size = size_t(2) * 1024 * 1024;
+
+        /**
+         * @brief      Constructs a @ref mmap_allocator.
+         *
+         * @since      1.4.0
+         */
+        constexpr mmap_allocator() noexcept = default;
+
+        /**
+         * @brief      Constructs a @ref mmap_allocator from an allocator of another type of elements.
+         *
+         * @tparam     U     Type of the elements allocated by the other allocator
+         *
+         * @since      1.4.0
+         */
+        template<typename U>
+        constexpr mmap_allocator(const mmap_allocator<U, Populate>&) noexcept;
+
+        /**
+         * @brief      Allocate storage for @p n elements of type @p T.
+         *
+         * @details    The storage is zero-initialized and its size is rounded up to a multiple of the
+         *             page size (or of @ref huge_page_size for allocations of at least @ref
+         *             huge_page_size bytes).
+         *
+         * @param[in]  n     Number of elements to allocate storage for
+         *
+         * @return     Pointer to the first element of the storage
+         *
+         * @throws     std::bad_alloc  if the mapping fails
+         *
+         * @complexity Constant if @p Populate is @a false, linear in @p n otherwise.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] T* allocate(size_t n);
+
+        /**
+         * @brief      Deallocate the storage pointed by @p p, unmapping its memory.
+         *
+         * @param      p     Pointer obtained from @ref allocate()
+         * @param[in]  n     Number of elements passed to @ref allocate()
+         *
+         * @complexity Linear in the number of mapped pages.
+         *
+         * @since      1.4.0
+         */
+        void deallocate(T* p, size_t n) noexcept;
+
+        /**
+         * @brief      Test if two @ref mmap_allocator are equal, always @a true.
+         *
+         * @since      1.4.0
+         */
+        template<typename U>
+        [[nodiscard]] constexpr bool operator==(const mmap_allocator<U, Populate>&) const noexcept;
+
+        /**
+         * @brief      Test if two @ref mmap_allocator are different, always @a false.
+         *
+         * @since      1.4.0
+         */
+        template<typename U>
+        [[nodiscard]] constexpr bool operator!=(const mmap_allocator<U, Populate>&) const noexcept;
+
+    private:
+        static size_t mapping_size(size_t n) noexcept;
+        // pre-fault the pages of the size bytes of zeroed memory at p by writing them
+        static void touch_pages(char* p, size_t size) noexcept;
+    };
+
+    //=================================================================================================
+    // mmap_allocator functions implementations
+    //=================================================================================================
+
+    template<typename T, bool Populate>
+    template<typename U>
+    constexpr mmap_allocator<T, Populate>::mmap_allocator(const mmap_allocator<U, Populate>&) noexcept
+    {
+    }
+
+    template<typename T, bool Populate>
+    T* mmap_allocator<T, Populate>::allocate(size_t n)
+    {
+        if(n == 0)
+        {
+            n = 1;
+        }
+        if(n > (std::numeric_limits<size_t>::max() - 2 * huge_page_size) / sizeof(T))
+        {
+            throw std::bad_alloc();
+        }
+
+        const size_t size = mapping_size(n);
+        int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#    if defined(MAP_POPULATE) && !defined(MADV_POPULATE_WRITE)
+        if constexpr(Populate)
+        {
+            flags |= MAP_POPULATE;
+        }
+#    endif
+
+        char* p = nullptr;
+        if(size < huge_page_size)
+        {
+            void* const mapping = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+            if(mapping == MAP_FAILED)
+            {
+                throw std::bad_alloc();
+            }
+            p = static_cast<char*>(mapping);
+        }
+        else
+        {
+            // over-allocate to align the mapping on a huge page, then unmap the excess
+            void* const mapping = ::mmap(nullptr, size + huge_page_size, PROT_READ | PROT_WRITE, flags, -1, 0);
+            if(mapping == MAP_FAILED)
+            {
+                throw std::bad_alloc();
+            }
+            const std::uintptr_t mapping_address = reinterpret_cast<std::uintptr_t>(mapping);
+            const std::uintptr_t offset =
+              ((mapping_address + huge_page_size - 1) & ~std::uintptr_t(huge_page_size - 1)) - mapping_address;
+            p = static_cast<char*>(mapping) + offset;
+            if(offset != 0)
+            {
+                ::munmap(mapping, offset);
+            }
+            ::munmap(p + size, huge_page_size - offset);
+
+#    if defined(MADV_HUGEPAGE)
+            ::madvise(p, size, MADV_HUGEPAGE); // only a hint, failure is not an error
+#    endif
+        }
+
+#    if defined(MADV_POPULATE_WRITE)
+        if constexpr(Populate)
+        {
+            // kernels older than the headers (before Linux 5.14) fail with EINVAL, the pages are then touched
+            if(::madvise(p, size, MADV_POPULATE_WRITE) != 0)
+            {
+                touch_pages(p, size);
+            }
+        }
+#    endif
+        return static_cast<T*>(static_cast<void*>(p));
+    }
+
+    template<typename T, bool Populate>
+    void mmap_allocator<T, Populate>::deallocate(T* p, size_t n) noexcept
+    {
+        if(n == 0)
+        {
+            n = 1;
+        }
+        ::munmap(static_cast<void*>(p), mapping_size(n));
+    }
+
+    template<typename T, bool Populate>
+    template<typename U>
+    constexpr bool mmap_allocator<T, Populate>::operator==(const mmap_allocator<U, Populate>&) const noexcept
+    {
+        return true;
+    }
+
+    template<typename T, bool Populate>
+    template<typename U>
+    constexpr bool mmap_allocator<T, Populate>::operator!=(const mmap_allocator<U, Populate>&) const noexcept
+    {
+        return false;
+    }
+
+    template<typename T, bool Populate>
+    size_t mmap_allocator<T, Populate>::mapping_size(size_t n) noexcept
+    {
+        const size_t bytes = n * sizeof(T);
+        const size_t page_size = bytes < huge_page_size ? static_cast<size_t>(::sysconf(_SC_PAGESIZE)) : huge_page_size;
+        return (bytes + page_size - 1) / page_size * page_size;
+    }
+
+    template<typename T, bool Populate>
+    void mmap_allocator<T, Populate>::touch_pages(char* p, size_t size) noexcept
+    {
+        const size_t page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        volatile char* const pages = p;
+        for(size_t i = 0; i < size; i += page_size)
+        {
+            // the anonymous mapping is zeroed, writing a zero faults the page in without changing it
+            pages[i] = 0;
+        }
+    }
+
+#    ifndef DYNAMIC_BITSET_NO_NAMESPACE
+} // namespace sul
+#    endif
+
+#endif // SUL_MMAP_ALLOCATOR_AVAILABLE
+
+#endif // SUL_MMAP_ALLOCATOR_HPP
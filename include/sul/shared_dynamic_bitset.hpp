@@ -0,0 +1,634 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef SUL_SHARED_DYNAMIC_BITSET_HPP
+#define SUL_SHARED_DYNAMIC_BITSET_HPP
+
+/** @file
+ * @brief      @ref sul::shared_dynamic_bitset declaration and implementation.
+ *
+ * @details    Depends on @a sul/dynamic_bitset.hpp.
+ *
+ *             @ref sul::shared_dynamic_bitset is only declared if the POSIX shared memory functions
+ *             and atomic operations on plain integers (C++20 @a std::atomic_ref or GCC/Clang @a
+ *             __atomic builtins) are available, in which case @a SUL_SHARED_DYNAMIC_BITSET_AVAILABLE
+ *             is defined to @a true.
+ *
+ * @remark     Include multiple standard library headers, @a sys/mman.h, @a sys/stat.h, @a fcntl.h
+ *             and @a unistd.h. On some systems, using POSIX shared memory requires linking with @a
+ *             librt.
+ *
+ * @since      1.4.0
+ */
+
+#include "dynamic_bitset.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+
+// define SUL_SHARED_DYNAMIC_BITSET_AVAILABLE
+#if __has_include(<sys/mman.h>) && __has_include(<sys/stat.h>) && __has_include(<fcntl.h>) \
+  && __has_include(<unistd.h>) && (defined(__cpp_lib_atomic_ref) || defined(__GNUC__) || defined(__clang__))
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#    define SUL_SHARED_DYNAMIC_BITSET_AVAILABLE true
+#else
+#    define SUL_SHARED_DYNAMIC_BITSET_AVAILABLE false
+#endif
+
+#if SUL_SHARED_DYNAMIC_BITSET_AVAILABLE
+
+#    ifndef DYNAMIC_BITSET_NO_NAMESPACE
+namespace sul
+{
+#    endif
+
+    /**
+     * @brief      Fixed size bitset in POSIX shared memory, updated with atomic operations.
+     *
+     * @details    The bits are stored in a shared memory object (@a shm_open) mapped by every
+     *             process opening it with the same name, after a small header describing the layout.
+     *             The bits modifications are atomic operations on the blocks, so different processes
+     *             (or threads) can @ref set(), @ref reset(), @ref test_set() and @ref count()
+     *             concurrently without locks.
+     *
+     *             The size is fixed when the shared memory object is created, @ref snapshot() can be
+     *             used to get a @ref sul::dynamic_bitset copy for the operations not provided.
+     *
+     *             The shared memory object persists until @ref remove() is called (or the system
+     *             restarts), even if no process has it open.
+     *
+     * @tparam     Block  Block type to use for storing the bits, must be an unsigned integral type
+     *                    with lock-free atomic operations
+     *
+     * @since      1.4.0
+     */
+    template<typename Block = unsigned long long>
+    class shared_dynamic_bitset
+    {
+        static_assert(std::is_unsigned<Block>::value, "Block is not an unsigned integral type");
+        static_assert(std::atomic<Block>::is_always_lock_free, "Block atomic operations are not lock-free");
+
+    public:
+        /**
+         * @brief      Type used to represent the size of a @ref sul::shared_dynamic_bitset.
+         *
+         * @since      1.4.0
+         */
+        typedef size_t size_type;
+
+        /**
+         * @brief      Same type as @p Block.
+         *
+         * @since      1.4.0
+         */
+        typedef Block block_type;
+
+        /**
+         * @brief      Number of bits that can be stored in a block.
+         *
+         * @since      1.4.0
+         */
+        static constexpr size_type bits_per_block = std::numeric_limits<block_type>::digits;
+
+        /**
+         * @brief      Open the shared bitset @p name, creating it with @p nbits bits set to @a false if
+         *             it does not exist.
+         *
+         * @details    If the shared memory object is being created by another process, wait for its
+         *             initialization.
+         *
+         * @param[in]  name   Name of the shared memory object, as for @a shm_open (@a "/name")
+         * @param[in]  nbits  Number of bits of the bitset
+         *
+         * @throws     std::system_error   if the shared memory object can't be created, opened or mapped
+         * @throws     std::runtime_error  if the existing shared memory object is not a bitset with @p
+         *                                 nbits bits of type @p Block
+         *
+         * @complexity Constant if the shared bitset exists, linear in @p nbits otherwise.
+         *
+         * @since      1.4.0
+         */
+        shared_dynamic_bitset(const std::string& name, size_type nbits);
+
+        shared_dynamic_bitset(const shared_dynamic_bitset&) = delete;
+        shared_dynamic_bitset& operator=(const shared_dynamic_bitset&) = delete;
+
+        /**
+         * @brief      Unmap the shared bitset, the shared memory object is not removed.
+         *
+         * @since      1.4.0
+         */
+        ~shared_dynamic_bitset();
+
+        /**
+         * @brief      Remove the shared memory object @p name.
+         *
+         * @details    The processes that opened it keep their mapping, the name can be reused
+         *             immediately.
+         *
+         * @param[in]  name  Name of the shared memory object
+         *
+         * @return     @a true if the shared memory object was removed, @a false otherwise
+         *
+         * @since      1.4.0
+         */
+        static bool remove(const std::string& name) noexcept;
+
+        /**
+         * @brief      Give the number of bits of the @ref sul::shared_dynamic_bitset.
+         *
+         * @return     The number of bits of the @ref sul::shared_dynamic_bitset.
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] size_type size() const noexcept;
+
+        /**
+         * @brief      Give the number of blocks used by the @ref sul::shared_dynamic_bitset.
+         *
+         * @return     The number of blocks used by the @ref sul::shared_dynamic_bitset.
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] size_type num_blocks() const noexcept;
+
+        /**
+         * @brief      Atomically set the bit at position @p pos to @a true or value @p value.
+         *
+         * @param[in]  pos    Position of the bit to set
+         * @param[in]  value  Value to set the bit to
+         *
+         * @pre        @code
+         *             pos < size()
+         *             @endcode
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
+         */
+        void set(size_type pos, bool value = true) noexcept;
+
+        /**
+         * @brief      Atomically reset the bit at position @p pos to @a false.
+         *
+         * @param[in]  pos   Position of the bit to reset
+         *
+         * @pre        @code
+         *             pos < size()
+         *             @endcode
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
+         */
+        void reset(size_type pos) noexcept;
+
+        /**
+         * @brief      Atomically flip the bit at position @p pos.
+         *
+         * @param[in]  pos   Position of the bit to flip
+         *
+         * @pre        @code
+         *             pos < size()
+         *             @endcode
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
+         */
+        void flip(size_type pos) noexcept;
+
+        /**
+         * @brief      Atomically test the value of the bit at position @p pos.
+         *
+         * @param[in]  pos   Position of the bit to test
+         *
+         * @return     The tested bit value
+         *
+         * @pre        @code
+         *             pos < size()
+         *             @endcode
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] bool test(size_type pos) const noexcept;
+
+        /**
+         * @brief      Atomically test the value of the bit at position @p pos and set it to @a true or
+         *             value @p value.
+         *
+         * @details    Among concurrent calls setting the same bit to the same value, exactly one
+         *             observes the previous value.
+         *
+         * @param[in]  pos    Position of the bit to test and set
+         * @param[in]  value  Value to set the bit to
+         *
+         * @return     The tested bit value
+         *
+         * @pre        @code
+         *             pos < size()
+         *             @endcode
+         *
+         * @complexity Constant.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] bool test_set(size_type pos, bool value = true) noexcept;
+
+        /**
+         * @brief      Count the number of bits set to @a true.
+         *
+         * @details    Each block is loaded atomically, the result is exact if there are no concurrent
+         *             modifications.
+         *
+         * @return     The number of bits set to @a true
+         *
+         * @complexity Linear in the size of the @ref sul::shared_dynamic_bitset.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] size_type count() const noexcept;
+
+        /**
+         * @brief      Copy the bits in a @ref sul::dynamic_bitset.
+         *
+         * @details    Each block is loaded atomically, the copy is exact if there are no concurrent
+         *             modifications.
+         *
+         * @return     A @ref sul::dynamic_bitset with the same bits
+         *
+         * @complexity Linear in the size of the @ref sul::shared_dynamic_bitset.
+         *
+         * @since      1.4.0
+         */
+        [[nodiscard]] dynamic_bitset<Block> snapshot() const;
+
+    private:
+        struct header
+        {
+            std::uint32_t state; // initialization state, atomically set to ready_state by the creator
+            std::uint32_t version;
+            char magic[8];
+            std::uint32_t block_size;
+            std::uint32_t reserved;
+            std::uint64_t data_offset;
+            std::uint64_t bits_number;
+        };
+
+        static constexpr std::uint32_t ready_state = 1;
+        static constexpr std::uint32_t layout_version = 1;
+        static constexpr char layout_magic[8] = {'S', 'U', 'L', 'B', 'I', 'T', 'S', '\0'};
+        // blocks start on a new cache line
+        static constexpr size_t data_offset = 64;
+        static_assert(sizeof(header) <= data_offset, "header doesn't fit before the blocks");
+
+        static constexpr block_type zero_block = block_type(0);
+        static constexpr block_type one_block = block_type(~zero_block);
+
+        static constexpr size_type blocks_required(size_type nbits) noexcept;
+        static constexpr size_type block_index(size_type pos) noexcept;
+        static constexpr block_type bit_mask(size_type pos) noexcept;
+
+        // atomic operations on plain integers shared between processes
+        template<typename T>
+        static T atomic_load(T& value) noexcept;
+        template<typename T>
+        static void atomic_store(T& value, T desired) noexcept;
+        static block_type atomic_fetch_or(block_type& block, block_type mask) noexcept;
+        static block_type atomic_fetch_and(block_type& block, block_type mask) noexcept;
+        static block_type atomic_fetch_xor(block_type& block, block_type mask) noexcept;
+
+        [[noreturn]] static void throw_errno(const char* what);
+
+        header* m_header;
+        block_type* m_blocks;
+        size_type m_bits_number;
+        size_t m_mapping_size;
+    };
+
+    //=================================================================================================
+    // shared_dynamic_bitset functions implementations
+    //=================================================================================================
+
+    template<typename Block>
+    shared_dynamic_bitset<Block>::shared_dynamic_bitset(const std::string& name, size_type nbits)
+        : m_header(nullptr)
+        , m_blocks(nullptr)
+        , m_bits_number(nbits)
+        , m_mapping_size(data_offset + blocks_required(nbits) * sizeof(block_type))
+    {
+        bool created = true;
+        int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        if(fd == -1 && errno == EEXIST)
+        {
+            created = false;
+            fd = ::shm_open(name.c_str(), O_RDWR, 0600);
+        }
+        if(fd == -1)
+        {
+            throw_errno("shm_open");
+        }
+
+        if(created)
+        {
+            if(::ftruncate(fd, static_cast<off_t>(m_mapping_size)) == -1)
+            {
+                const int error = errno;
+                ::close(fd);
+                ::shm_unlink(name.c_str());
+                errno = error;
+                throw_errno("ftruncate");
+            }
+        }
+        else
+        {
+            // wait for the creator to set the size of the shared memory object
+            struct stat object_stat;
+            for(int tries = 0;; ++tries)
+            {
+                if(::fstat(fd, &object_stat) == -1)
+                {
+                    const int error = errno;
+                    ::close(fd);
+                    errno = error;
+                    throw_errno("fstat");
+                }
+                if(static_cast<size_t>(object_stat.st_size) >= sizeof(header) || tries == 1000)
+                {
+                    break;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            if(static_cast<size_t>(object_stat.st_size) != m_mapping_size)
+            {
+                ::close(fd);
+                throw std::runtime_error("shared_dynamic_bitset: shared memory object size mismatch");
+            }
+        }
+
+        void* const mapping = ::mmap(nullptr, m_mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        const int mmap_error = errno;
+        ::close(fd);
+        if(mapping == MAP_FAILED)
+        {
+            if(created)
+            {
+                // the header is never initialized, the object would make the next openers fail
+                ::shm_unlink(name.c_str());
+            }
+            errno = mmap_error;
+            throw_errno("mmap");
+        }
+        m_header = static_cast<header*>(mapping);
+        m_blocks = reinterpret_cast<block_type*>(static_cast<unsigned char*>(mapping) + data_offset);
+
+        if(created)
+        {
+            // the blocks are zero-initialized by ftruncate
+            std::memcpy(m_header->magic, layout_magic, sizeof(layout_magic));
+            m_header->version = layout_version;
+            m_header->block_size = sizeof(block_type);
+            m_header->data_offset = data_offset;
+            m_header->bits_number = nbits;
+            atomic_store(m_header->state, ready_state);
+            return;
+        }
+
+        // wait for the creator to initialize the header
+        for(int tries = 0; atomic_load(m_header->state) != ready_state; ++tries)
+        {
+            if(tries == 1000)
+            {
+                ::munmap(mapping, m_mapping_size);
+                throw std::runtime_error("shared_dynamic_bitset: shared memory object not initialized");
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        if(std::memcmp(m_header->magic, layout_magic, sizeof(layout_magic)) != 0
+           || m_header->version != layout_version || m_header->block_size != sizeof(block_type)
+           || m_header->data_offset != data_offset || m_header->bits_number != nbits)
+        {
+            ::munmap(mapping, m_mapping_size);
+            throw std::runtime_error("shared_dynamic_bitset: shared memory object layout mismatch");
+        }
+    }
+
+    template<typename Block>
+    shared_dynamic_bitset<Block>::~shared_dynamic_bitset()
+    {
+        ::munmap(static_cast<void*>(m_header), m_mapping_size);
+    }
+
+    template<typename Block>
+    bool shared_dynamic_bitset<Block>::remove(const std::string& name) noexcept
+    {
+        return ::shm_unlink(name.c_str()) == 0;
+    }
+
+    template<typename Block>
+    typename shared_dynamic_bitset<Block>::size_type shared_dynamic_bitset<Block>::size() const noexcept
+    {
+        return m_bits_number;
+    }
+
+    template<typename Block>
+    typename shared_dynamic_bitset<Block>::size_type shared_dynamic_bitset<Block>::num_blocks() const noexcept
+    {
+        return blocks_required(m_bits_number);
+    }
+
+    template<typename Block>
+    void shared_dynamic_bitset<Block>::set(size_type pos, bool value) noexcept
+    {
+        assert(pos < size());
+        if(value)
+        {
+            atomic_fetch_or(m_blocks[block_index(pos)], bit_mask(pos));
+        }
+        else
+        {
+            atomic_fetch_and(m_blocks[block_index(pos)], block_type(~bit_mask(pos)));
+        }
+    }
+
+    template<typename Block>
+    void shared_dynamic_bitset<Block>::reset(size_type pos) noexcept
+    {
+        set(pos, false);
+    }
+
+    template<typename Block>
+    void shared_dynamic_bitset<Block>::flip(size_type pos) noexcept
+    {
+        assert(pos < size());
+        atomic_fetch_xor(m_blocks[block_index(pos)], bit_mask(pos));
+    }
+
+    template<typename Block>
+    bool shared_dynamic_bitset<Block>::test(size_type pos) const noexcept
+    {
+        assert(pos < size());
+        return (atomic_load(m_blocks[block_index(pos)]) & bit_mask(pos)) != zero_block;
+    }
+
+    template<typename Block>
+    bool shared_dynamic_bitset<Block>::test_set(size_type pos, bool value) noexcept
+    {
+        assert(pos < size());
+        const block_type previous = value ? atomic_fetch_or(m_blocks[block_index(pos)], bit_mask(pos))
+                                          : atomic_fetch_and(m_blocks[block_index(pos)], block_type(~bit_mask(pos)));
+        return (previous & bit_mask(pos)) != zero_block;
+    }
+
+    template<typename Block>
+    typename shared_dynamic_bitset<Block>::size_type shared_dynamic_bitset<Block>::count() const noexcept
+    {
+        size_type result = 0;
+        const size_type blocks = num_blocks();
+        for(size_type i = 0; i < blocks; ++i)
+        {
+            block_type block = atomic_load(m_blocks[i]);
+#    if DYNAMIC_BITSET_CAN_USE_STD_BITOPS
+            result += static_cast<size_type>(std::popcount(block));
+#    elif DYNAMIC_BITSET_CAN_USE_GCC_BUILTIN || DYNAMIC_BITSET_CAN_USE_CLANG_BUILTIN_POPCOUNT
+            result += static_cast<size_type>(__builtin_popcountll(static_cast<unsigned long long>(block)));
+#    else
+            for(; block != zero_block; ++result)
+            {
+                block &= block_type(block - 1);
+            }
+#    endif
+        }
+        return result;
+    }
+
+    template<typename Block>
+    dynamic_bitset<Block> shared_dynamic_bitset<Block>::snapshot() const
+    {
+        dynamic_bitset<Block> result;
+        result.reserve(m_bits_number);
+        const size_type blocks = num_blocks();
+        for(size_type i = 0; i < blocks; ++i)
+        {
+            result.append(atomic_load(m_blocks[i]));
+        }
+        result.resize(m_bits_number);
+        return result;
+    }
+
+    template<typename Block>
+    constexpr typename shared_dynamic_bitset<Block>::size_type shared_dynamic_bitset<Block>::blocks_required(
+      size_type nbits) noexcept
+    {
+        return nbits / bits_per_block + static_cast<size_type>(nbits % bits_per_block > 0);
+    }
+
+    template<typename Block>
+    constexpr typename shared_dynamic_bitset<Block>::size_type shared_dynamic_bitset<Block>::block_index(
+      size_type pos) noexcept
+    {
+        return pos / bits_per_block;
+    }
+
+    template<typename Block>
+    constexpr typename shared_dynamic_bitset<Block>::block_type shared_dynamic_bitset<Block>::bit_mask(
+      size_type pos) noexcept
+    {
+        return block_type(block_type(1u) << (pos % bits_per_block));
+    }
+
+    template<typename Block>
+    template<typename T>
+    T shared_dynamic_bitset<Block>::atomic_load(T& value) noexcept
+    {
+#    if defined(__cpp_lib_atomic_ref)
+        return std::atomic_ref<T>(value).load(std::memory_order_acquire);
+#    else
+        return __atomic_load_n(&value, __ATOMIC_ACQUIRE);
+#    endif
+    }
+
+    template<typename Block>
+    template<typename T>
+    void shared_dynamic_bitset<Block>::atomic_store(T& value, T desired) noexcept
+    {
+#    if defined(__cpp_lib_atomic_ref)
+        std::atomic_ref<T>(value).store(desired, std::memory_order_release);
+#    else
+        __atomic_store_n(&value, desired, __ATOMIC_RELEASE);
+#    endif
+    }
+
+    template<typename Block>
+    typename shared_dynamic_bitset<Block>::block_type shared_dynamic_bitset<Block>::atomic_fetch_or(
+      block_type& block,
+      block_type mask) noexcept
+    {
+#    if defined(__cpp_lib_atomic_ref)
+        return std::atomic_ref<block_type>(block).fetch_or(mask, std::memory_order_acq_rel);
+#    else
+        return __atomic_fetch_or(&block, mask, __ATOMIC_ACQ_REL);
+#    endif
+    }
+
+    template<typename Block>
+    typename shared_dynamic_bitset<Block>::block_type shared_dynamic_bitset<Block>::atomic_fetch_and(
+      block_type& block,
+      block_type mask) noexcept
+    {
+#    if defined(__cpp_lib_atomic_ref)
+        return std::atomic_ref<block_type>(block).fetch_and(mask, std::memory_order_acq_rel);
+#    else
+        return __atomic_fetch_and(&block, mask, __ATOMIC_ACQ_REL);
+#    endif
+    }
+
+    template<typename Block>
+    typename shared_dynamic_bitset<Block>::block_type shared_dynamic_bitset<Block>::atomic_fetch_xor(
+      block_type& block,
+      block_type mask) noexcept
+    {
+#    if defined(__cpp_lib_atomic_ref)
+        return std::atomic_ref<block_type>(block).fetch_xor(mask, std::memory_order_acq_rel);
+#    else
+        return __atomic_fetch_xor(&block, mask, __ATOMIC_ACQ_REL);
+#    endif
+    }
+
+    template<typename Block>
+    void shared_dynamic_bitset<Block>::throw_errno(const char* what)
+    {
+        throw std::system_error(errno, std::generic_category(), std::string("shared_dynamic_bitset: ") + what);
+    }
+
+#    ifndef DYNAMIC_BITSET_NO_NAMESPACE
+} // namespace sul
+#    endif
+
+#endif // SUL_SHARED_DYNAMIC_BITSET_AVAILABLE
+
+#endif // SUL_SHARED_DYNAMIC_BITSET_HPP
@@ -10,6 +10,8 @@
 
 #include <sul/dynamic_bitset.hpp>
 
+#include <memory>
+#include <new>
 #include <type_traits>
 
 template<typename T>
@@ -29,8 +31,8 @@ constexpr bool bit_value(T value, size_t bit_pos) noexcept
     return (value & (T(1) << bit_pos)) != T(0);
 }
 
-template<typename T>
-constexpr bool check_unused_bits(const sul::dynamic_bitset<T>& bitset) noexcept
+template<typename T, typename Allocator>
+constexpr bool check_unused_bits(const sul::dynamic_bitset<T, Allocator>& bitset) noexcept
 {
     const size_t extra_bits = bitset.size() % sul::dynamic_bitset<T>::bits_per_block;
     if(extra_bits > 0)
@@ -42,18 +44,47 @@ constexpr bool check_unused_bits(const sul::dynamic_bitset<T>& bitset) noexcept
     return true;
 }
 
-template<typename T>
-constexpr bool check_size(const sul::dynamic_bitset<T>& bitset) noexcept
+template<typename T, typename Allocator>
+constexpr bool check_size(const sul::dynamic_bitset<T, Allocator>& bitset) noexcept
 {
     const size_t blocks_required = bitset.size() / sul::dynamic_bitset<T>::bits_per_block
                                    + static_cast<size_t>(bitset.size() % sul::dynamic_bitset<T>::bits_per_block > 0);
     return blocks_required == bitset.num_blocks();
 }
 
-template<typename T>
-constexpr bool check_consistency(const sul::dynamic_bitset<T>& bitset) noexcept
+template<typename T, typename Allocator>
+constexpr bool check_consistency(const sul::dynamic_bitset<T, Allocator>& bitset) noexcept
 {
     return check_unused_bits(bitset) && check_size(bitset);
 }
 
+// allocator throwing std::bad_alloc while failing_allocator_fail is true
+inline bool failing_allocator_fail = false;
+
+template<typename T>
+struct failing_allocator : std::allocator<T>
+{
+    template<typename U>
+    struct rebind
+    {
+        typedef failing_allocator<U> other;
+    };
+
+    failing_allocator() = default;
+
+    template<typename U>
+    constexpr failing_allocator(const failing_allocator<U>&) noexcept
+    {
+    }
+
+    T* allocate(size_t n)
+    {
+        if(failing_allocator_fail)
+        {
+            throw std::bad_alloc();
+        }
+        return std::allocator<T>::allocate(n);
+    }
+};
+
 #endif // DYNAMIC_BITSET_UTILS_HPP
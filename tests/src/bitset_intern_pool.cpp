@@ -0,0 +1,93 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "RandomDynamicBitsetGenerator.hpp"
+#include "config.hpp"
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_adapters.hpp>
+#include <sul/bitset_intern_pool.hpp>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+TEMPLATE_TEST_CASE("bitset_intern_pool", "[dynamic_bitset][intern]", uint16_t, uint32_t, uint64_t)
+{
+    using pool_type = sul::bitset_intern_pool<TestType>;
+    pool_type pool;
+    REQUIRE(pool.empty());
+
+    SECTION("deduplication")
+    {
+        const sul::dynamic_bitset<TestType> bitset =
+          GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
+        CAPTURE(bitset);
+
+        const typename pool_type::handle handle1 = pool.intern(bitset);
+        REQUIRE(*handle1 == bitset);
+        REQUIRE(pool.size() == 1);
+
+        sul::dynamic_bitset<TestType> copy = bitset;
+        const typename pool_type::handle handle2 = pool.intern(std::move(copy));
+        REQUIRE(handle1 == handle2);
+        REQUIRE(pool.size() == 1);
+
+        // same bits but different size
+        sul::dynamic_bitset<TestType> longer = bitset;
+        longer.push_back(false);
+        const typename pool_type::handle handle3 = pool.intern(longer);
+        REQUIRE(*handle3 == longer);
+        REQUIRE(handle3 != handle1);
+        REQUIRE(pool.size() == 2);
+
+        if(!bitset.empty())
+        {
+            sul::dynamic_bitset<TestType> flipped = bitset;
+            flipped.flip(flipped.size() - 1);
+            const typename pool_type::handle handle4 = pool.intern(flipped);
+            REQUIRE(*handle4 == flipped);
+            REQUIRE(handle4 != handle1);
+            REQUIRE(pool.size() == 3);
+        }
+    }
+
+    SECTION("many duplicates")
+    {
+        std::vector<typename pool_type::handle> handles;
+        for(size_t i = 0; i < 1000; ++i)
+        {
+            handles.push_back(pool.intern(sul::dynamic_bitset<TestType>(100, i % 10)));
+        }
+        REQUIRE(pool.size() == 10);
+        for(size_t i = 0; i < handles.size(); ++i)
+        {
+            REQUIRE(handles[i] == handles[i % 10]);
+            REQUIRE(*handles[i] == sul::dynamic_bitset<TestType>(100, i % 10));
+        }
+    }
+
+    SECTION("release_unused and clear")
+    {
+        typename pool_type::handle kept = pool.intern(sul::dynamic_bitset<TestType>(10, 1));
+        {
+            const typename pool_type::handle released = pool.intern(sul::dynamic_bitset<TestType>(10, 2));
+            REQUIRE(pool.size() == 2);
+            REQUIRE(pool.release_unused() == 0);
+        }
+        REQUIRE(pool.release_unused() == 1);
+        REQUIRE(pool.size() == 1);
+        REQUIRE(pool.intern(sul::dynamic_bitset<TestType>(10, 1)) == kept);
+
+        pool.clear();
+        REQUIRE(pool.empty());
+        REQUIRE(*kept == sul::dynamic_bitset<TestType>(10, 1));
+        REQUIRE(pool.intern(sul::dynamic_bitset<TestType>(10, 1)) != kept);
+    }
+}
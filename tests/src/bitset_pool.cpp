@@ -0,0 +1,165 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "RandomDynamicBitsetGenerator.hpp"
+#include "config.hpp"
+#include "utils.hpp"
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_adapters.hpp>
+#include <sul/bitset_pool.hpp>
+#include <sul/dynamic_bitset.hpp>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+TEST_CASE("bitset_pool", "[bitset_pool]")
+{
+    sul::bitset_pool pool;
+    REQUIRE(pool.cached() == 0);
+
+    void* const p1 = pool.allocate(64);
+    void* const p2 = pool.allocate(128);
+    pool.deallocate(p1, 64);
+    pool.deallocate(p2, 128);
+    REQUIRE(pool.cached() == 2);
+
+    // storages are reused for allocations of the same size only
+    REQUIRE(pool.allocate(64) == p1);
+    REQUIRE(pool.cached() == 1);
+    void* const p3 = pool.allocate(64);
+    REQUIRE(pool.cached() == 1);
+    pool.deallocate(p1, 64);
+    pool.deallocate(p3, 64);
+
+    // at most max_cached_per_size storages of the same size are kept
+    std::vector<void*> storages;
+    for(size_t i = 0; i < 2 * sul::bitset_pool::max_cached_per_size; ++i)
+    {
+        storages.push_back(pool.allocate(32));
+    }
+    for(void* p: storages)
+    {
+        pool.deallocate(p, 32);
+    }
+    REQUIRE(pool.cached() == 3 + sul::bitset_pool::max_cached_per_size);
+
+    pool.release();
+    REQUIRE(pool.cached() == 0);
+
+    // at most max_sizes different sizes are kept
+    for(size_t i = 1; i <= sul::bitset_pool::max_sizes + 1; ++i)
+    {
+        pool.deallocate(pool.allocate(i * 8), i * 8);
+    }
+    REQUIRE(pool.cached() == sul::bitset_pool::max_sizes);
+}
+
+TEST_CASE("bitset_pool eviction", "[bitset_pool]")
+{
+    sul::bitset_pool pool;
+
+    // sizes used once, such as the sizes of a growing storage, fill the sizes of the pool
+    for(size_t i = 1; i <= sul::bitset_pool::max_sizes; ++i)
+    {
+        pool.deallocate(pool.allocate(i * 8), i * 8);
+    }
+    REQUIRE(pool.cached() == sul::bitset_pool::max_sizes);
+
+    // a size used repeatedly afterwards, interleaved with other sizes used once, is still recycled
+    constexpr size_t size = 1000;
+    void* const p = pool.allocate(size);
+    pool.deallocate(p, size);
+    for(size_t i = 1; i <= 2 * sul::bitset_pool::max_sizes; ++i)
+    {
+        const size_t other_size = size + i * 8;
+        pool.deallocate(pool.allocate(other_size), other_size);
+        REQUIRE(pool.allocate(size) == p);
+        pool.deallocate(p, size);
+    }
+    REQUIRE(pool.cached() == sul::bitset_pool::max_sizes);
+
+    pool.release();
+    REQUIRE(pool.cached() == 0);
+}
+
+TEMPLATE_TEST_CASE("recycling_allocator", "[dynamic_bitset][bitset_pool]", uint16_t, uint32_t, uint64_t)
+{
+    using bitset_type = sul::dynamic_bitset<TestType, sul::recycling_allocator<TestType>>;
+    sul::bitset_pool* const pool = sul::bitset_pool::thread_pool();
+    REQUIRE(pool != nullptr);
+    REQUIRE(sul::bitset_pool::thread_pool() == pool);
+    pool->release();
+
+    SECTION("operations")
+    {
+        const sul::dynamic_bitset<TestType> reference =
+          GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
+        CAPTURE(reference);
+        bitset_type bitset(reference.size());
+        for(size_t i = 0; i < reference.size(); ++i)
+        {
+            bitset[i] = reference[i];
+        }
+
+        const bitset_type result = (bitset & ~bitset) | (bitset << 3) | (bitset >> 1);
+        const sul::dynamic_bitset<TestType> expected = (reference & ~reference) | (reference << 3) | (reference >> 1);
+        REQUIRE(result.to_string() == expected.to_string());
+        REQUIRE(check_consistency(result));
+    }
+
+    SECTION("temporaries recycle the storage")
+    {
+        const bitset_type bitset(1000, 0xF0F0);
+        const TestType* data = nullptr;
+        {
+            const bitset_type temporary = ~bitset;
+            data = temporary.data();
+        }
+        REQUIRE(pool->cached() == 1);
+        const bitset_type temporary = ~bitset;
+        REQUIRE(temporary.data() == data);
+        REQUIRE(pool->cached() == 0);
+    }
+
+    pool->release();
+}
+
+TEST_CASE("recycling_allocator without pool", "[bitset_pool]")
+{
+    // storage allocated by a thread after the destruction of its pool, so without pool, then recycled by
+    // the pool of this thread which links the cached storages through their first bytes
+    uint16_t* storage = nullptr;
+    std::thread([&storage]() noexcept {
+        struct late_allocation
+        {
+            uint16_t** storage;
+
+            ~late_allocation()
+            {
+                *storage = sul::recycling_allocator<uint16_t>().allocate(1);
+            }
+        };
+        // constructed before the pool of the thread, so destroyed after it
+        thread_local late_allocation allocation{&storage};
+        static_cast<void>(allocation);
+        static_cast<void>(sul::bitset_pool::thread_pool());
+    }).join();
+    REQUIRE(storage != nullptr);
+
+    sul::bitset_pool* const pool = sul::bitset_pool::thread_pool();
+    REQUIRE(pool != nullptr);
+    pool->release();
+    sul::recycling_allocator<uint16_t>().deallocate(storage, 1);
+    REQUIRE(pool->cached() == 1);
+    REQUIRE(sul::recycling_allocator<uint16_t>().allocate(1) == storage);
+    sul::recycling_allocator<uint16_t>().deallocate(storage, 1);
+    pool->release();
+}
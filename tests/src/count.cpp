@@ -16,7 +16,11 @@
 #include <catch2/generators/catch_generators_adapters.hpp>
 #include <sul/dynamic_bitset.hpp>
 
+#include <algorithm>
 #include <cstdint>
+#include <iterator>
+#include <limits>
+#include <vector>
 
 #if DYNAMIC_BITSET_CAN_USE_LIBPOPCNT
 #    define COUNT_TESTED_IMPL "libpopcnt"
@@ -70,3 +74,92 @@ TEMPLATE_TEST_CASE(
         }
     }
 }
+
+TEMPLATE_TEST_CASE("count range (" COUNT_TESTED_IMPL ")",
+                   "[dynamic_bitset][libpopcnt][builtin][c++20]",
+                   uint16_t,
+                   uint32_t,
+                   uint64_t)
+{
+    SECTION("empty bitset")
+    {
+        sul::dynamic_bitset<TestType> bitset;
+
+        REQUIRE(bitset.count(0, 0) == 0);
+    }
+
+    SECTION("non-empty bitset")
+    {
+        const sul::dynamic_bitset<TestType> bitset =
+          GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
+        CAPTURE(bitset);
+
+        const size_t lengths[] = {0,
+                                  1,
+                                  bits_number<TestType> - 1,
+                                  bits_number<TestType>,
+                                  bits_number<TestType> + 1,
+                                  3 * bits_number<TestType> + 5};
+        for(size_t pos = 0; pos <= bitset.size(); ++pos)
+        {
+            for(size_t len: lengths)
+            {
+                len = std::min(len, bitset.size() - pos);
+                CAPTURE(pos, len);
+                size_t count = 0;
+                for(size_t i = pos; i < pos + len; ++i)
+                {
+                    count += static_cast<size_t>(bitset[i]);
+                }
+                REQUIRE(bitset.count(pos, len) == count);
+            }
+        }
+        REQUIRE(bitset.count(0, bitset.size()) == bitset.count());
+    }
+}
+
+TEMPLATE_TEST_CASE("segment_counts (" COUNT_TESTED_IMPL ")",
+                   "[dynamic_bitset][libpopcnt][builtin][c++20]",
+                   uint16_t,
+                   uint32_t,
+                   uint64_t)
+{
+    SECTION("empty bitset")
+    {
+        sul::dynamic_bitset<TestType> bitset;
+        std::vector<size_t> counts;
+
+        bitset.segment_counts(8, std::back_inserter(counts));
+        REQUIRE(counts.empty());
+    }
+
+    SECTION("non-empty bitset")
+    {
+        const sul::dynamic_bitset<TestType> bitset =
+          GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
+        CAPTURE(bitset);
+
+        const size_t segment_bits = GENERATE(size_t(1),
+                                             size_t(7),
+                                             bits_number<TestType> - 1,
+                                             bits_number<TestType>,
+                                             3 * bits_number<TestType>,
+                                             3 * bits_number<TestType> + 5,
+                                             std::numeric_limits<size_t>::max());
+        CAPTURE(segment_bits);
+
+        std::vector<size_t> counts;
+        bitset.segment_counts(segment_bits, std::back_inserter(counts));
+
+        std::vector<size_t> expected;
+        for(size_t i = 0; i < bitset.size(); ++i)
+        {
+            if(i % segment_bits == 0)
+            {
+                expected.push_back(0);
+            }
+            expected.back() += static_cast<size_t>(bitset[i]);
+        }
+        REQUIRE(counts == expected);
+    }
+}
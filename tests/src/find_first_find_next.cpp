@@ -68,3 +68,39 @@ TEMPLATE_TEST_CASE("find_first find_next (" FIND_FIRST_FIND_NEXT_TESTED_IMPL ")"
         REQUIRE(bitset.find_next(bitset.size()) == bitset.npos);
     }
 }
+
+TEMPLATE_TEST_CASE("find_first_zero find_next_zero (" FIND_FIRST_FIND_NEXT_TESTED_IMPL ")",
+                   "[dynamic_bitset][builtin][c++20]",
+                   uint16_t,
+                   uint32_t,
+                   uint64_t)
+{
+    SECTION("empty-bitset")
+    {
+        sul::dynamic_bitset<TestType> bitset;
+
+        REQUIRE(bitset.find_first_zero() == bitset.npos);
+        REQUIRE(bitset.find_next_zero(0) == bitset.npos);
+    }
+
+    SECTION("non-empty bitset")
+    {
+        const std::tuple<size_t, size_t> values = GENERATE(multitake(RANDOM_VECTORS_TO_TEST,
+                                                                     random<size_t>(0, 5 * bits_number<TestType>),
+                                                                     random<size_t>(0, 5 * bits_number<TestType>)));
+        const size_t first_bit_pos = std::get<0>(values);
+        const size_t second_bit_pos = first_bit_pos + 1 + std::get<1>(values);
+        CAPTURE(first_bit_pos, second_bit_pos);
+
+        // the unused bits of the last block must not be found
+        sul::dynamic_bitset<TestType> bitset(second_bit_pos + 12);
+        bitset.set();
+        REQUIRE(bitset.find_first_zero() == bitset.npos);
+        bitset.reset(first_bit_pos);
+        bitset.reset(second_bit_pos);
+        REQUIRE(bitset.find_first_zero() == first_bit_pos);
+        REQUIRE(bitset.find_next_zero(first_bit_pos) == second_bit_pos);
+        REQUIRE(bitset.find_next_zero(second_bit_pos) == bitset.npos);
+        REQUIRE(bitset.find_next_zero(bitset.size()) == bitset.npos);
+    }
+}
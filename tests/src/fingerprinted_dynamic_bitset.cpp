@@ -0,0 +1,210 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "RandomDynamicBitsetGenerator.hpp"
+#include "config.hpp"
+#include "utils.hpp"
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_adapters.hpp>
+#include <catch2/generators/catch_generators_random.hpp>
+#include <sul/fingerprinted_dynamic_bitset.hpp>
+
+#include <cstdint>
+#include <new>
+#include <random>
+#include <stdexcept>
+#include <utility>
+
+TEMPLATE_TEST_CASE("fingerprinted_dynamic_bitset", "[dynamic_bitset][fingerprint]", uint16_t, uint32_t, uint64_t)
+{
+    using fingerprinted = sul::fingerprinted_dynamic_bitset<TestType>;
+
+    SECTION("constructors")
+    {
+        REQUIRE(fingerprinted().fingerprint() == 0);
+        REQUIRE(fingerprinted(100).fingerprint() == 0);
+        REQUIRE(fingerprinted(100, true).bitset().all());
+
+        const sul::dynamic_bitset<TestType> bitset =
+          GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
+        CAPTURE(bitset);
+        const fingerprinted copied(bitset);
+        REQUIRE(copied.bitset() == bitset);
+        REQUIRE(fingerprinted(sul::dynamic_bitset<TestType>(bitset)).fingerprint() == copied.fingerprint());
+        REQUIRE((copied.fingerprint() == 0) == bitset.none());
+    }
+
+    SECTION("modifications keep the fingerprint up to date")
+    {
+        const uint32_t seed = GENERATE(take(RANDOM_VECTORS_TO_TEST, random<uint32_t>(0, 100000)));
+        CAPTURE(seed);
+        std::minstd_rand engine(seed);
+        const auto random_value = [&](size_t max) {
+            return std::uniform_int_distribution<size_t>(0, max)(engine);
+        };
+        const auto random_bitset = [&](size_t size) {
+            sul::dynamic_bitset<TestType> result(size);
+            for(size_t i = 0; i < size; ++i)
+            {
+                result[i] = random_value(1) == 1;
+            }
+            return result;
+        };
+
+        fingerprinted bitset(random_bitset(random_value(200)));
+        for(size_t i = 0; i < 50; ++i)
+        {
+            const size_t size = bitset.size();
+            const size_t pos = size == 0 ? 0 : random_value(size - 1);
+            const size_t len = size == 0 ? 0 : random_value(size - pos);
+            const bool value = random_value(1) == 1;
+            const size_t operation = random_value(18);
+            CAPTURE(size, pos, len, value, operation);
+            switch(operation)
+            {
+                case 0:
+                    bitset.set(pos, len, value);
+                    break;
+                case 1:
+                    if(size > 0)
+                    {
+                        bitset.set(pos, value);
+                    }
+                    break;
+                case 2:
+                    bitset.set();
+                    break;
+                case 3:
+                    bitset.reset(pos, len);
+                    break;
+                case 4:
+                    if(size > 0)
+                    {
+                        bitset.reset(pos);
+                    }
+                    break;
+                case 5:
+                    bitset.reset();
+                    break;
+                case 6:
+                    bitset.flip(pos, len);
+                    break;
+                case 7:
+                    if(size > 0)
+                    {
+                        bitset.flip(pos);
+                    }
+                    break;
+                case 8:
+                    bitset.flip();
+                    break;
+                case 9:
+                    if(size > 0)
+                    {
+                        const bool previous = bitset.test(pos);
+                        REQUIRE(bitset.test_set(pos, value) == previous);
+                    }
+                    break;
+                case 10:
+                    bitset.resize(random_value(200), value);
+                    break;
+                case 11:
+                    bitset.push_back(value);
+                    break;
+                case 12:
+                    bitset.pop_back();
+                    break;
+                case 13:
+                    bitset &= random_bitset(size);
+                    break;
+                case 14:
+                    bitset |= random_bitset(size);
+                    break;
+                case 15:
+                    bitset ^= random_bitset(size);
+                    break;
+                case 16:
+                    bitset -= random_bitset(size);
+                    break;
+                case 17:
+                    bitset <<= random_value(size);
+                    break;
+                default:
+                    bitset >>= random_value(size);
+                    break;
+            }
+            REQUIRE(check_consistency(bitset.bitset()));
+            REQUIRE(bitset.fingerprint() == fingerprinted(bitset.bitset()).fingerprint());
+        }
+
+        bitset.modify([&](sul::dynamic_bitset<TestType>& modified) {
+            modified.append(static_cast<TestType>(random_value(1000)));
+        });
+        REQUIRE(bitset.fingerprint() == fingerprinted(bitset.bitset()).fingerprint());
+
+        bitset.clear();
+        REQUIRE(bitset.fingerprint() == 0);
+    }
+
+    SECTION("failed modifications keep the fingerprint up to date")
+    {
+        const sul::dynamic_bitset<TestType> bitset =
+          GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
+        CAPTURE(bitset);
+        fingerprinted modified(bitset);
+        const auto failure = [](sul::dynamic_bitset<TestType>& value) {
+            value.push_back(true);
+            value.flip(0);
+            throw std::runtime_error("modification failure");
+        };
+        REQUIRE_THROWS_AS(modified.modify(failure), std::runtime_error);
+        REQUIRE(modified.size() == bitset.size() + 1);
+        REQUIRE(modified.fingerprint() == fingerprinted(modified.bitset()).fingerprint());
+        fingerprinted expected(bitset);
+        expected.push_back(true);
+        expected.flip(0);
+        REQUIRE(modified == expected);
+
+        using failing = sul::fingerprinted_dynamic_bitset<TestType, failing_allocator<TestType>>;
+        sul::dynamic_bitset<TestType, failing_allocator<TestType>> storage(bitset.size(), 0b1011);
+        storage.shrink_to_fit();
+        failing allocating(std::move(storage));
+        const unsigned long long allocating_fingerprint = allocating.fingerprint();
+        failing_allocator_fail = true;
+        REQUIRE_THROWS_AS(allocating.resize(bitset.size() + 1000, true), std::bad_alloc);
+        failing_allocator_fail = false;
+        REQUIRE(allocating.fingerprint() == allocating_fingerprint);
+        REQUIRE(allocating.fingerprint() == failing(allocating.bitset()).fingerprint());
+    }
+
+    SECTION("equality")
+    {
+        const sul::dynamic_bitset<TestType> bitset =
+          GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
+        CAPTURE(bitset);
+        fingerprinted lhs(bitset);
+        fingerprinted rhs(bitset);
+        REQUIRE(lhs == rhs);
+        REQUIRE_FALSE(lhs != rhs);
+
+        rhs.push_back(false);
+        REQUIRE(lhs != rhs);
+        lhs.push_back(false);
+        REQUIRE(lhs == rhs);
+
+        const size_t pos = bitset.size() / 2;
+        rhs.flip(pos);
+        REQUIRE(lhs != rhs);
+        REQUIRE(lhs.fingerprint() != rhs.fingerprint());
+        rhs.flip(pos);
+        REQUIRE(lhs == rhs);
+        REQUIRE(lhs.fingerprint() == rhs.fingerprint());
+    }
+}
@@ -0,0 +1,101 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "RandomDynamicBitsetGenerator.hpp"
+#include "config.hpp"
+#include "utils.hpp"
+
+#include <catch2/catch_message.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_adapters.hpp>
+#include <sul/dynamic_bitset.hpp>
+
+#include <cstdint>
+
+#if !DYNAMIC_BITSET_USE_INSTRUMENTATION
+#    error "instrumentation tests require DYNAMIC_BITSET_INSTRUMENTATION to be defined"
+#endif
+
+TEMPLATE_TEST_CASE("instrumentation", "[dynamic_bitset][instrumentation]", uint16_t, uint32_t, uint64_t)
+{
+    sul::dynamic_bitset_counters& counters = sul::dynamic_bitset_thread_counters();
+
+    SECTION("reallocation and resize")
+    {
+        sul::dynamic_bitset<TestType> bitset;
+        counters.reset();
+
+        bitset.resize(3 * bits_number<TestType>);
+        REQUIRE(counters[sul::dynamic_bitset_event::resize].calls == 1);
+        REQUIRE(counters[sul::dynamic_bitset_event::resize].blocks == 3);
+        REQUIRE(counters[sul::dynamic_bitset_event::reallocation].calls == 1);
+        REQUIRE(counters[sul::dynamic_bitset_event::reallocation].blocks == bitset.capacity() / bits_number<TestType>);
+
+        // no reallocation when the capacity is sufficient
+        bitset.reserve(10 * bits_number<TestType>);
+        REQUIRE(counters[sul::dynamic_bitset_event::reallocation].calls == 2);
+        for(size_t i = 0; i < 6 * bits_number<TestType>; ++i)
+        {
+            bitset.push_back(true);
+        }
+        bitset.append(TestType(42));
+        REQUIRE(counters[sul::dynamic_bitset_event::reallocation].calls == 2);
+
+        bitset.shrink_to_fit();
+        REQUIRE(counters[sul::dynamic_bitset_event::reallocation].calls == 2);
+        bitset.push_back(true);
+        REQUIRE(counters[sul::dynamic_bitset_event::reallocation].calls == 3);
+    }
+
+    SECTION("bitwise operators")
+    {
+        sul::dynamic_bitset<TestType> bitset1 = GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
+        sul::dynamic_bitset<TestType> bitset2(bitset1.size());
+        counters.reset();
+
+        bitset1 &= bitset2;
+        bitset1 |= bitset2;
+        bitset1 ^= bitset2;
+        bitset1 -= bitset2;
+        bitset1 <<= 1;
+        bitset1 >>= 1;
+        static_cast<void>(~bitset1);
+        static_cast<void>(bitset1 & bitset2);
+        REQUIRE(counters[sul::dynamic_bitset_event::bitwise_operation].calls == 8);
+        REQUIRE(counters[sul::dynamic_bitset_event::bitwise_operation].blocks == 8 * bitset1.num_blocks());
+    }
+
+    SECTION("count and to_string")
+    {
+        sul::dynamic_bitset<TestType> bitset = GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
+        counters.reset();
+
+        static_cast<void>(bitset.count());
+        static_cast<void>(bitset.to_string());
+        REQUIRE(counters[sul::dynamic_bitset_event::count].calls == 1);
+        REQUIRE(counters[sul::dynamic_bitset_event::count].blocks == bitset.num_blocks());
+        REQUIRE(counters[sul::dynamic_bitset_event::to_string].calls == 1);
+        REQUIRE(counters[sul::dynamic_bitset_event::to_string].blocks == bitset.num_blocks());
+    }
+
+    SECTION("find")
+    {
+        sul::dynamic_bitset<TestType> bitset(5 * bits_number<TestType>);
+        bitset.set(2 * bits_number<TestType> + 1);
+        counters.reset();
+
+        REQUIRE(bitset.find_first() == 2 * bits_number<TestType> + 1);
+        REQUIRE(counters[sul::dynamic_bitset_event::find].calls == 1);
+        REQUIRE(counters[sul::dynamic_bitset_event::find].blocks == 3);
+
+        REQUIRE(bitset.find_next(2 * bits_number<TestType> + 1) == sul::dynamic_bitset<TestType>::npos);
+        REQUIRE(counters[sul::dynamic_bitset_event::find].calls == 2);
+        REQUIRE(counters[sul::dynamic_bitset_event::find].blocks == 6);
+    }
+}
@@ -0,0 +1,134 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "RandomDynamicBitsetGenerator.hpp"
+#include "config.hpp"
+#include "utils.hpp"
+
+#include <catch2/catch_message.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_adapters.hpp>
+#include <sul/dynamic_bitset.hpp>
+#include <sul/mapped_dynamic_bitset.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#if SUL_MAPPED_DYNAMIC_BITSET_AVAILABLE
+
+namespace
+{
+    std::string temporary_file_path(const char* name)
+    {
+        return (std::string(P_tmpdir) + "/sul_dynamic_bitset_") + name + "_" + std::to_string(::getpid());
+    }
+} // namespace
+
+TEMPLATE_TEST_CASE("mapped_dynamic_bitset", "[dynamic_bitset][mmap]", uint16_t, uint32_t, uint64_t)
+{
+    const std::string path = temporary_file_path("mapped");
+    std::remove(path.c_str());
+
+    SECTION("persistence")
+    {
+        const sul::dynamic_bitset<TestType> bitset =
+          GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
+        CAPTURE(bitset);
+
+        {
+            sul::mapped_dynamic_bitset<TestType> mapped(path);
+            REQUIRE(mapped.empty());
+            for(size_t i = 0; i < bitset.size(); ++i)
+            {
+                mapped.push_back(bitset[i]);
+            }
+            REQUIRE(mapped.to_string() == bitset.to_string());
+            mapped.flush();
+        }
+
+        {
+            sul::mapped_dynamic_bitset<TestType> mapped(path);
+            REQUIRE(mapped.size() == bitset.size());
+            REQUIRE(mapped.to_string() == bitset.to_string());
+            REQUIRE(check_consistency(mapped));
+
+            mapped.flip();
+            mapped.resize(mapped.size() + 100, true);
+        }
+
+        sul::mapped_dynamic_bitset<TestType> mapped(path);
+        sul::dynamic_bitset<TestType> expected = ~bitset;
+        expected.resize(expected.size() + 100, true);
+        REQUIRE(mapped.to_string() == expected.to_string());
+        REQUIRE(check_consistency(mapped));
+    }
+
+    SECTION("mutations and copies")
+    {
+        sul::mapped_dynamic_bitset<TestType> mapped(path);
+        mapped.resize(1000);
+        mapped.set(10, 500, true);
+        REQUIRE(mapped.count() == 500);
+
+        // copies use anonymous memory and do not modify the file
+        sul::dynamic_bitset<TestType, sul::mapped_file_allocator<TestType>> copy = mapped;
+        REQUIRE(copy.get_allocator().file() == nullptr);
+        copy.reset();
+        REQUIRE(mapped.count() == 500);
+        REQUIRE((mapped & copy).none());
+
+        // the results of the operators use anonymous memory and do not modify the file
+        const std::string content = mapped.to_string();
+        const auto conjunction = mapped & copy;
+        REQUIRE(conjunction.get_allocator().file() == nullptr);
+        REQUIRE(mapped.to_string() == content);
+        const auto complement = ~mapped;
+        REQUIRE(complement.get_allocator().file() == nullptr);
+        REQUIRE(complement.count() == 500);
+        REQUIRE(mapped.to_string() == content);
+        const auto shifted = mapped << 3;
+        REQUIRE(shifted.get_allocator().file() == nullptr);
+        REQUIRE(mapped.to_string() == content);
+        REQUIRE(mapped.count() == 500);
+
+        mapped.resize(10);
+        mapped.shrink_to_fit();
+        mapped.resize(2000);
+        REQUIRE(mapped.count() == 0);
+        REQUIRE(check_consistency(mapped));
+
+        mapped = copy;
+        REQUIRE(mapped.size() == 1000);
+        REQUIRE(mapped.none());
+        mapped.flush(false);
+    }
+
+    SECTION("invalid files")
+    {
+        {
+            std::ofstream file(path, std::ios::binary);
+            file << "not a bitset file";
+        }
+        REQUIRE_THROWS_AS(sul::mapped_dynamic_bitset<TestType>(path), std::runtime_error);
+        std::remove(path.c_str());
+
+        {
+            sul::mapped_dynamic_bitset<uint8_t> other_block_type(path);
+            other_block_type.resize(10);
+        }
+        REQUIRE_THROWS_AS(sul::mapped_dynamic_bitset<TestType>(path), std::runtime_error);
+    }
+
+    std::remove(path.c_str());
+}
+
+#endif
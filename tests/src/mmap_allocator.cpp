@@ -0,0 +1,75 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "RandomDynamicBitsetGenerator.hpp"
+#include "config.hpp"
+#include "utils.hpp"
+
+#include <catch2/catch_message.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_adapters.hpp>
+#include <sul/dynamic_bitset.hpp>
+#include <sul/mmap_allocator.hpp>
+
+#include <cstdint>
+
+#if SUL_MMAP_ALLOCATOR_AVAILABLE
+
+TEMPLATE_TEST_CASE("mmap_allocator", "[dynamic_bitset][mmap]", uint16_t, uint32_t, uint64_t)
+{
+    using mmap_bitset = sul::dynamic_bitset<TestType, sul::mmap_allocator<TestType>>;
+    using populated_mmap_bitset = sul::dynamic_bitset<TestType, sul::mmap_allocator<TestType, true>>;
+
+    SECTION("small bitsets")
+    {
+        const sul::dynamic_bitset<TestType> bitset =
+          GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
+        CAPTURE(bitset);
+
+        mmap_bitset mapped;
+        for(size_t i = 0; i < bitset.size(); ++i)
+        {
+            mapped.push_back(bitset[i]);
+        }
+        REQUIRE(mapped.to_string() == bitset.to_string());
+        REQUIRE(mapped.count() == bitset.count());
+        REQUIRE(check_consistency(mapped));
+
+        mapped.shrink_to_fit();
+        REQUIRE(mapped.to_string() == bitset.to_string());
+    }
+
+    SECTION("huge page sized bitsets")
+    {
+        constexpr size_t bits = 8 * sul::mmap_allocator<TestType>::huge_page_size + 3;
+
+        mmap_bitset mapped(bits);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(mapped.data()) % sul::mmap_allocator<TestType>::huge_page_size == 0);
+        REQUIRE(mapped.none());
+        mapped.set(0);
+        mapped.set(bits - 1);
+        REQUIRE(mapped.count() == 2);
+
+        populated_mmap_bitset populated(bits, 0b101);
+        REQUIRE(populated.count() == 2);
+        populated.resize(2 * bits, true);
+        REQUIRE(populated.count() == bits + 2);
+        REQUIRE(check_consistency(populated));
+    }
+
+    SECTION("allocator")
+    {
+        const sul::mmap_allocator<TestType> allocator;
+        const sul::mmap_allocator<char> rebound(allocator);
+        REQUIRE(rebound == allocator);
+        REQUIRE_FALSE(rebound != allocator);
+    }
+}
+
+#endif
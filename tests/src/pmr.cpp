@@ -0,0 +1,148 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "RandomDynamicBitsetGenerator.hpp"
+#include "config.hpp"
+#include "utils.hpp"
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_adapters.hpp>
+#include <sul/dynamic_bitset.hpp>
+
+#include <cstdint>
+#include <sstream>
+#include <type_traits>
+#include <utility>
+
+#if DYNAMIC_BITSET_CAN_USE_PMR
+
+#    include <memory_resource>
+
+namespace
+{
+    // memory resource counting the allocations it serves
+    class counting_resource : public std::pmr::memory_resource
+    {
+    public:
+        size_t allocations = 0;
+
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override
+        {
+            ++allocations;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override
+        {
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+
+    // any allocation from the default memory resource throws while in scope
+    class no_default_resource
+    {
+    public:
+        no_default_resource() : m_previous(std::pmr::set_default_resource(std::pmr::null_memory_resource()))
+        {
+        }
+
+        no_default_resource(const no_default_resource&) = delete;
+        no_default_resource& operator=(const no_default_resource&) = delete;
+
+        ~no_default_resource()
+        {
+            std::pmr::set_default_resource(m_previous);
+        }
+
+    private:
+        std::pmr::memory_resource* m_previous;
+    };
+} // namespace
+
+TEMPLATE_TEST_CASE("pmr", "[dynamic_bitset][pmr]", uint16_t, uint32_t, uint64_t)
+{
+    using bitset_type = sul::pmr::dynamic_bitset<TestType>;
+    using allocator_type = std::pmr::polymorphic_allocator<TestType>;
+    STATIC_REQUIRE(std::is_same_v<typename bitset_type::allocator_type, allocator_type>);
+
+    const sul::dynamic_bitset<TestType> reference =
+      GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
+    CAPTURE(reference);
+
+    counting_resource resource;
+    const allocator_type allocator(&resource);
+    const no_default_resource guard;
+
+    bitset_type bitset(allocator);
+    for(size_t i = 0; i < reference.size(); ++i)
+    {
+        bitset.push_back(reference[i]);
+    }
+    const bitset_type other(reference.size(), 0b1011, allocator);
+
+    SECTION("operators propagate the memory resource")
+    {
+        const bitset_type result = ((bitset & other) | (bitset ^ other)) - (~bitset << 3) - (bitset >> 2);
+        REQUIRE(result.get_allocator().resource() == &resource);
+
+        const sul::dynamic_bitset<TestType> expected =
+          ((reference & sul::dynamic_bitset<TestType>(reference.size(), 0b1011))
+           | (reference ^ sul::dynamic_bitset<TestType>(reference.size(), 0b1011)))
+          - (~reference << 3) - (reference >> 2);
+        REQUIRE(result.to_string() == expected.to_string());
+        REQUIRE(check_consistency(result));
+        REQUIRE(resource.allocations > 0);
+    }
+
+    SECTION("allocator-extended constructors")
+    {
+        counting_resource other_resource;
+
+        const bitset_type copy(bitset, allocator_type(&other_resource));
+        REQUIRE(copy == bitset);
+        REQUIRE(copy.get_allocator().resource() == &other_resource);
+
+        // the copy constructor uses the default memory resource, as for the standard containers
+        bitset_type moved_from(bitset, allocator);
+        const bitset_type moved(std::move(moved_from), allocator_type(&other_resource));
+        REQUIRE(moved == bitset);
+        REQUIRE(moved.get_allocator().resource() == &other_resource);
+    }
+
+    SECTION("stream extraction")
+    {
+        std::istringstream stream(reference.to_string());
+        bitset_type extracted(allocator);
+        stream >> extracted;
+        REQUIRE(extracted.get_allocator().resource() == &resource);
+        REQUIRE(extracted.to_string() == reference.to_string());
+    }
+}
+
+TEST_CASE("pmr monotonic_buffer_resource", "[dynamic_bitset][pmr]")
+{
+    // the arena has no upstream, the buffer has to hold all the bitsets
+    alignas(std::max_align_t) unsigned char buffer[4096];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+    const no_default_resource guard;
+
+    const std::pmr::polymorphic_allocator<uint64_t> allocator(&arena);
+    const sul::pmr::dynamic_bitset<uint64_t> lhs(256, 0xF0F0, allocator);
+    const sul::pmr::dynamic_bitset<uint64_t> rhs(256, 0xFF00, allocator);
+    const sul::pmr::dynamic_bitset<uint64_t> result = ~(lhs & rhs) >> 4;
+    REQUIRE(result.count() == 256 - 4 - 4);
+}
+
+#endif
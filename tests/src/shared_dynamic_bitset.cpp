@@ -0,0 +1,134 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "utils.hpp"
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <sul/shared_dynamic_bitset.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#if SUL_SHARED_DYNAMIC_BITSET_AVAILABLE
+
+#    include <sys/wait.h>
+
+namespace
+{
+    std::string shared_name(const char* name, size_t block_size)
+    {
+        return std::string("/sul_dynamic_bitset_") + name + "_" + std::to_string(block_size) + "_"
+               + std::to_string(::getpid());
+    }
+} // namespace
+
+TEMPLATE_TEST_CASE("shared_dynamic_bitset", "[dynamic_bitset][shm]", uint16_t, uint32_t, uint64_t)
+{
+    const std::string name = shared_name("shared", sizeof(TestType));
+    sul::shared_dynamic_bitset<TestType>::remove(name);
+
+    SECTION("single process")
+    {
+        constexpr size_t bits = 1000;
+        sul::shared_dynamic_bitset<TestType> shared(name, bits);
+        REQUIRE(shared.size() == bits);
+        REQUIRE(shared.num_blocks() == (bits + bits_number<TestType> - 1) / bits_number<TestType>);
+        REQUIRE(shared.count() == 0);
+
+        sul::shared_dynamic_bitset<TestType> other(name, bits);
+        REQUIRE_FALSE(shared.test_set(3));
+        REQUIRE(other.test_set(3));
+        REQUIRE(other.test(3));
+        other.set(bits - 1);
+        shared.flip(10);
+        shared.flip(11);
+        other.flip(11);
+        REQUIRE(shared.count() == 3);
+
+        sul::dynamic_bitset<TestType> expected(bits);
+        expected.set(3).set(10).set(bits - 1);
+        REQUIRE(shared.snapshot() == expected);
+
+        REQUIRE(other.test_set(3, false));
+        shared.reset(10);
+        REQUIRE(shared.count() == 1);
+
+        REQUIRE_THROWS_AS(sul::shared_dynamic_bitset<TestType>(name, bits + 1), std::runtime_error);
+    }
+
+    SECTION("forked processes")
+    {
+        constexpr size_t bits = 100000;
+        constexpr size_t workers = 4;
+        const std::string claimed_name = shared_name("claimed", sizeof(TestType));
+        const std::string first_name = shared_name("first", sizeof(TestType));
+        sul::shared_dynamic_bitset<TestType>::remove(claimed_name);
+        sul::shared_dynamic_bitset<TestType>::remove(first_name);
+
+        sul::shared_dynamic_bitset<TestType> shared(name, bits);
+        pid_t children[workers];
+        for(size_t worker = 0; worker < workers; ++worker)
+        {
+            children[worker] = ::fork();
+            REQUIRE(children[worker] != -1);
+            if(children[worker] != 0)
+            {
+                continue;
+            }
+
+            // child: no Catch2 assertions, report failures through the exit status
+            int status = 0;
+            try
+            {
+                sul::shared_dynamic_bitset<TestType> own_bits(name, bits);
+                sul::shared_dynamic_bitset<TestType> claimed(claimed_name, bits);
+                sul::shared_dynamic_bitset<TestType> first(first_name, bits);
+                for(size_t i = worker; i < bits; i += workers)
+                {
+                    own_bits.set(i);
+                }
+                for(size_t j = 0; j < bits; ++j)
+                {
+                    const size_t i = (j + worker * (bits / workers)) % bits;
+                    if(!claimed.test_set(i) && first.test_set(i))
+                    {
+                        status = 1; // claimed twice
+                    }
+                }
+            }
+            catch(...)
+            {
+                status = 2;
+            }
+            ::_exit(status);
+        }
+
+        for(pid_t child: children)
+        {
+            int status = 0;
+            REQUIRE(::waitpid(child, &status, 0) == child);
+            REQUIRE(WIFEXITED(status));
+            REQUIRE(WEXITSTATUS(status) == 0);
+        }
+
+        sul::shared_dynamic_bitset<TestType> claimed(claimed_name, bits);
+        sul::shared_dynamic_bitset<TestType> first(first_name, bits);
+        REQUIRE(shared.count() == bits);
+        REQUIRE(claimed.count() == bits);
+        REQUIRE(first.count() == bits);
+        REQUIRE(shared.snapshot().all());
+
+        sul::shared_dynamic_bitset<TestType>::remove(claimed_name);
+        sul::shared_dynamic_bitset<TestType>::remove(first_name);
+    }
+
+    REQUIRE(sul::shared_dynamic_bitset<TestType>::remove(name));
+}
+
+#endif
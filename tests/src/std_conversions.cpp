@@ -0,0 +1,133 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "RandomDynamicBitsetGenerator.hpp"
+#include "config.hpp"
+#include "utils.hpp"
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_adapters.hpp>
+#include <sul/dynamic_bitset.hpp>
+
+#include <bitset>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+    // convert the first N bits of reference to std::bitset and back
+    template<size_t N, typename Block>
+    void check_std_bitset(const sul::dynamic_bitset<Block>& reference)
+    {
+        CAPTURE(N);
+        std::bitset<N> expected;
+        for(size_t i = 0; i < N && i < reference.size(); ++i)
+        {
+            expected[i] = reference[i];
+        }
+
+        const sul::dynamic_bitset<Block> bitset(expected);
+        REQUIRE(bitset.size() == N);
+        for(size_t i = 0; i < N; ++i)
+        {
+            CAPTURE(i);
+            REQUIRE(bitset[i] == expected[i]);
+        }
+        REQUIRE(check_consistency(bitset));
+        REQUIRE(bitset.template to_std_bitset<N>() == expected);
+
+        if(reference.size() <= N || reference.find_next(N - 1) == sul::dynamic_bitset<Block>::npos)
+        {
+            const std::bitset<N> converted = reference.template to_std_bitset<N>();
+            REQUIRE(converted == expected);
+            REQUIRE(converted.count() == expected.count());
+        }
+        else
+        {
+            REQUIRE_THROWS_AS(reference.template to_std_bitset<N>(), std::overflow_error);
+        }
+    }
+} // namespace
+
+TEMPLATE_TEST_CASE("std::bitset conversions", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
+{
+    const sul::dynamic_bitset<TestType> reference =
+      GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
+    CAPTURE(reference);
+
+    check_std_bitset<1>(reference);
+    check_std_bitset<7>(reference);
+    check_std_bitset<16>(reference);
+    check_std_bitset<33>(reference);
+    check_std_bitset<64>(reference);
+    check_std_bitset<100>(reference);
+    check_std_bitset<1000>(reference);
+
+    // truncated conversions
+    sul::dynamic_bitset<TestType> low_bits = reference;
+    low_bits.reset(std::min<size_t>(13, low_bits.size()), low_bits.size() - std::min<size_t>(13, low_bits.size()));
+    check_std_bitset<13>(low_bits);
+
+    REQUIRE(sul::dynamic_bitset<TestType>(std::bitset<0>()).empty());
+    REQUIRE(sul::dynamic_bitset<TestType>().template to_std_bitset<0>() == std::bitset<0>());
+}
+
+TEMPLATE_TEST_CASE("std::vector<bool> conversions", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
+{
+    const sul::dynamic_bitset<TestType> reference =
+      GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>(0, 1000)));
+    CAPTURE(reference);
+
+    const std::vector<bool> vector = reference.to_vector_bool();
+    REQUIRE(vector.size() == reference.size());
+    for(size_t i = 0; i < vector.size(); ++i)
+    {
+        CAPTURE(i);
+        REQUIRE(vector[i] == reference[i]);
+    }
+
+    const sul::dynamic_bitset<TestType> bitset(vector);
+    REQUIRE(bitset == reference);
+    REQUIRE(check_consistency(bitset));
+
+    // the bits past the end of the vector in its last word are not copied
+    std::vector<bool> longer = vector;
+    longer.resize(vector.size() + 70, true);
+    longer.resize(vector.size());
+    const sul::dynamic_bitset<TestType> truncated(longer);
+    REQUIRE(truncated == reference);
+    REQUIRE(check_consistency(truncated));
+}
+
+#if defined(__cpp_lib_is_constant_evaluated) && defined(__cpp_lib_constexpr_vector)
+namespace
+{
+    // the words copies are not used in constant evaluation
+    template<typename Block>
+    constexpr bool check_constant_conversions()
+    {
+        const std::bitset<70> source(0b1011);
+        const sul::dynamic_bitset<Block> bitset(source);
+        const std::vector<bool> vector = bitset.to_vector_bool();
+        const sul::dynamic_bitset<Block> converted(vector);
+        bool result = bitset.size() == 70 && bitset.count() == 3 && vector.size() == 70 && vector[3] && !vector[2]
+                      && converted == bitset;
+#    if defined(__cpp_lib_constexpr_bitset)
+        result = result && bitset.template to_std_bitset<70>() == source;
+#    endif
+        return result;
+    }
+} // namespace
+
+TEMPLATE_TEST_CASE("constant evaluated std conversions", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
+{
+    STATIC_REQUIRE(check_constant_conversions<TestType>());
+}
+#endif
@@ -23,7 +23,11 @@
 #include <algorithm>
 #include <cstdint>
 #include <list>
+#include <random>
 #include <sstream>
+#include <string>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 TEMPLATE_TEST_CASE("constructors", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
@@ -295,6 +299,60 @@ TEMPLATE_TEST_CASE("resize", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
     }
 }
 
+TEMPLATE_TEST_CASE("resize_for_overwrite", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
+{
+    using bitset_type = sul::dynamic_bitset<TestType, sul::default_init_allocator<TestType>>;
+    const sul::dynamic_bitset<TestType> reference =
+      GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
+    CAPTURE(reference);
+
+    bitset_type bitset(reference.to_string());
+    REQUIRE(bitset.to_string() == reference.to_string());
+    REQUIRE(check_consistency(bitset));
+
+    size_t size_change = GENERATE(take(RANDOM_VARIATIONS_TO_TEST, random<size_t>(0, 128)));
+    CAPTURE(size_change);
+
+    SECTION("incrementing size")
+    {
+        const size_t old_num_blocks = bitset.num_blocks();
+        const size_t new_size = bitset.size() + size_change;
+        bitset.resize_for_overwrite(new_size);
+        REQUIRE(bitset.size() == new_size);
+        REQUIRE(check_consistency(bitset));
+
+        // overwrite the new blocks
+        for(size_t i = old_num_blocks; i < bitset.num_blocks(); ++i)
+        {
+            bitset.data()[i] = TestType(0);
+        }
+        for(size_t i = 0; i < reference.size(); ++i)
+        {
+            CAPTURE(i);
+            REQUIRE(bitset[i] == reference[i]);
+        }
+        if(size_change > 0)
+        {
+            bitset.set(reference.size(), size_change, true);
+        }
+        REQUIRE(bitset.count() == reference.count() + size_change);
+        REQUIRE(check_consistency(bitset));
+    }
+
+    SECTION("decrementing size")
+    {
+        const size_t new_size = size_change > bitset.size() ? 0 : size_change;
+        bitset.resize_for_overwrite(new_size);
+        REQUIRE(bitset.size() == new_size);
+        for(size_t i = 0; i < bitset.size(); ++i)
+        {
+            CAPTURE(i);
+            REQUIRE(bitset[i] == reference[i]);
+        }
+        REQUIRE(check_consistency(bitset));
+    }
+}
+
 TEMPLATE_TEST_CASE("clear", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
 {
     sul::dynamic_bitset<TestType> bitset = GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
@@ -529,6 +587,285 @@ TEMPLATE_TEST_CASE("append", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
         }
         REQUIRE(check_consistency(bitset));
     }
+
+    SECTION("bitset")
+    {
+        const sul::dynamic_bitset<TestType> other =
+          GENERATE(take(RANDOM_VARIATIONS_TO_TEST, randomDynamicBitset<TestType>()));
+        CAPTURE(other);
+
+        sul::dynamic_bitset<TestType> expected = bitset_copy;
+        for(size_t i = 0; i < other.size(); ++i)
+        {
+            expected.push_back(other[i]);
+        }
+
+        bitset.append(other);
+        REQUIRE(bitset == expected);
+        REQUIRE(check_consistency(bitset));
+
+        sul::dynamic_bitset<TestType> moved_other = other;
+        sul::dynamic_bitset<TestType> bitset2 = bitset_copy;
+        bitset2.append(std::move(moved_other));
+        REQUIRE(bitset2 == expected);
+        REQUIRE(check_consistency(bitset2));
+
+        sul::dynamic_bitset<TestType> empty_bitset;
+        moved_other = other;
+        empty_bitset.append(std::move(moved_other));
+        REQUIRE(empty_bitset == other);
+        REQUIRE(check_consistency(empty_bitset));
+    }
+
+    SECTION("itself")
+    {
+        sul::dynamic_bitset<TestType> expected = bitset_copy;
+        for(size_t i = 0; i < bitset_copy.size(); ++i)
+        {
+            expected.push_back(bitset_copy[i]);
+        }
+
+        bitset.append(bitset);
+        REQUIRE(bitset == expected);
+        REQUIRE(check_consistency(bitset));
+
+        sul::dynamic_bitset<TestType> bitset2 = bitset_copy;
+        bitset2.append(std::move(bitset2));
+        REQUIRE(bitset2 == expected);
+        REQUIRE(check_consistency(bitset2));
+    }
+}
+
+TEMPLATE_TEST_CASE("insert erase", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
+{
+    sul::dynamic_bitset<TestType> bitset = GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
+    CAPTURE(bitset);
+    const sul::dynamic_bitset<TestType> bitset_copy = bitset;
+
+    const size_t pos = GENERATE_COPY(take(RANDOM_VARIATIONS_TO_TEST, random<size_t>(0, bitset.size())));
+    CAPTURE(pos);
+
+    SECTION("insert")
+    {
+        const size_t len = GENERATE(take(RANDOM_VARIATIONS_TO_TEST, random<size_t>(0, 4 * bits_number<TestType>)));
+        const bool value = GENERATE(false, true);
+        CAPTURE(len, value);
+
+        sul::dynamic_bitset<TestType> expected;
+        for(size_t i = 0; i < bitset_copy.size() + len; ++i)
+        {
+            if(i < pos)
+            {
+                expected.push_back(bitset_copy[i]);
+            }
+            else if(i < pos + len)
+            {
+                expected.push_back(value);
+            }
+            else
+            {
+                expected.push_back(bitset_copy[i - len]);
+            }
+        }
+
+        bitset.insert(pos, len, value);
+        REQUIRE(bitset == expected);
+        REQUIRE(check_consistency(bitset));
+
+        bitset.erase(pos, len);
+        REQUIRE(bitset == bitset_copy);
+        REQUIRE(check_consistency(bitset));
+    }
+
+    SECTION("erase")
+    {
+        const size_t len = GENERATE_COPY(take(RANDOM_VARIATIONS_TO_TEST, random<size_t>(0, bitset.size() - pos)));
+        CAPTURE(len);
+
+        sul::dynamic_bitset<TestType> expected;
+        for(size_t i = 0; i < bitset_copy.size() - len; ++i)
+        {
+            expected.push_back(bitset_copy[i < pos ? i : i + len]);
+        }
+
+        bitset.erase(pos, len);
+        REQUIRE(bitset == expected);
+        REQUIRE(check_consistency(bitset));
+    }
+}
+
+TEMPLATE_TEST_CASE("bit_writer", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
+{
+    using bit_writer = typename sul::dynamic_bitset<TestType>::bit_writer;
+    using buffer_type = typename bit_writer::buffer_type;
+
+    const sul::dynamic_bitset<TestType> bitset =
+      GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
+    CAPTURE(bitset);
+
+    SECTION("fields")
+    {
+        const std::vector<size_t> widths = GENERATE(
+          take(RANDOM_VARIATIONS_TO_TEST, randomChunk<size_t>(0, 100, random<size_t>(0, bit_writer::buffer_bits))));
+        CAPTURE(widths);
+
+        std::minstd_rand engine(static_cast<std::minstd_rand::result_type>(widths.size()));
+        sul::dynamic_bitset<TestType> expected = bitset;
+        sul::dynamic_bitset<TestType> result = bitset;
+        {
+            bit_writer writer(result);
+            for(const size_t width: widths)
+            {
+                const buffer_type value = (buffer_type(engine()) << 32) ^ buffer_type(engine());
+                writer.write(value, width);
+                for(size_t i = 0; i < width; ++i)
+                {
+                    expected.push_back(bit_value(value, i));
+                }
+                REQUIRE(writer.size() == expected.size());
+            }
+        }
+        REQUIRE(result == expected);
+        REQUIRE(check_consistency(result));
+    }
+
+    SECTION("flush and reserve")
+    {
+        sul::dynamic_bitset<TestType> expected = bitset;
+        sul::dynamic_bitset<TestType> result = bitset;
+        bit_writer writer(result);
+        writer.reserve(200);
+        REQUIRE(result.capacity() >= bitset.size() + 200);
+        for(size_t i = 0; i < 200; ++i)
+        {
+            const bool value = (i % 3) == 0;
+            writer.write(value);
+            expected.push_back(value);
+            if(i % 37 == 0)
+            {
+                writer.flush();
+                REQUIRE(result == expected);
+                REQUIRE(check_consistency(result));
+            }
+        }
+        writer.flush();
+        REQUIRE(result == expected);
+        REQUIRE(check_consistency(result));
+    }
+
+    SECTION("allocation failure")
+    {
+        using bitset_type = sul::dynamic_bitset<TestType, failing_allocator<TestType>>;
+        bitset_type result(1, 1);
+        result.shrink_to_fit();
+        {
+            typename bitset_type::bit_writer writer(result);
+            // the full buffer is transferred to the blocks, the last bit stays in the buffer
+            writer.write(0, bit_writer::buffer_bits - 1);
+            writer.write(true);
+            REQUIRE(result.size() == bit_writer::buffer_bits);
+            failing_allocator_fail = true;
+            if(result.capacity() < writer.size())
+            {
+                REQUIRE_THROWS_AS(writer.flush(), std::bad_alloc);
+                REQUIRE(result.size() == bit_writer::buffer_bits);
+                REQUIRE(check_consistency(result));
+            }
+        } // the flush of the destructor fails without throwing
+        failing_allocator_fail = false;
+        REQUIRE(result.size() == bit_writer::buffer_bits);
+        REQUIRE(result.count() == 1);
+        REQUIRE(result.test(0));
+        REQUIRE(check_consistency(result));
+    }
+
+    SECTION("allocation failure of a write")
+    {
+        using bitset_type = sul::dynamic_bitset<TestType, failing_allocator<TestType>>;
+        const bool flushed = GENERATE(false, true);
+        CAPTURE(flushed);
+        bitset_type result;
+        {
+            typename bitset_type::bit_writer writer(result);
+            writer.write(0, 20);
+            if(flushed)
+            {
+                writer.flush();
+            }
+            failing_allocator_fail = true;
+            if(result.capacity() < bit_writer::buffer_bits)
+            {
+                // the buffer is filled by the write, its transfer to the blocks fails
+                const auto ones = static_cast<typename bit_writer::buffer_type>(~0ull);
+                REQUIRE_THROWS_AS(writer.write(ones, bit_writer::buffer_bits - 10), std::bad_alloc);
+                REQUIRE(writer.size() == 20);
+                REQUIRE(result.size() == (flushed ? 20 : 0));
+                REQUIRE(check_consistency(result));
+            }
+            failing_allocator_fail = false;
+            writer.write(true);
+        }
+        REQUIRE(result.size() == 21);
+        REQUIRE(result.count() == 1);
+        REQUIRE(result.test(20));
+        REQUIRE(check_consistency(result));
+    }
+}
+
+TEMPLATE_TEST_CASE("bit_reader", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
+{
+    using bit_reader = typename sul::dynamic_bitset<TestType>::bit_reader;
+
+    const sul::dynamic_bitset<TestType> bitset =
+      GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
+    CAPTURE(bitset);
+
+    SECTION("fields")
+    {
+        const size_t start = GENERATE_COPY(take(RANDOM_VARIATIONS_TO_TEST, random<size_t>(0, bitset.size())));
+        CAPTURE(start);
+
+        std::minstd_rand engine(static_cast<std::minstd_rand::result_type>(start));
+        bit_reader reader(bitset, start);
+        size_t pos = start;
+        while(pos < bitset.size())
+        {
+            REQUIRE(reader.position() == pos);
+            REQUIRE(reader.remaining() == bitset.size() - pos);
+            const size_t nbits = std::min<size_t>(engine() % (bit_reader::buffer_bits + 1), bitset.size() - pos);
+            CAPTURE(pos, nbits);
+            REQUIRE(reader.read(nbits) == bitset.extract_bits(pos, nbits));
+            pos += nbits;
+        }
+        REQUIRE(reader.position() == bitset.size());
+        REQUIRE(reader.remaining() == 0);
+    }
+
+    SECTION("bits")
+    {
+        bit_reader reader(bitset);
+        for(size_t i = 0; i < bitset.size(); ++i)
+        {
+            CAPTURE(i);
+            REQUIRE(reader.read() == bitset[i]);
+        }
+        REQUIRE(reader.remaining() == 0);
+    }
+
+    SECTION("bit_writer round trip")
+    {
+        sul::dynamic_bitset<TestType> result;
+        {
+            typename sul::dynamic_bitset<TestType>::bit_writer writer(result);
+            bit_reader reader(bitset);
+            while(reader.remaining() > 0)
+            {
+                const size_t nbits = std::min<size_t>(reader.remaining(), 1 + reader.position() % 17);
+                writer.write(reader.read(nbits), nbits);
+            }
+        }
+        REQUIRE(result == bitset);
+    }
 }
 
 TEMPLATE_TEST_CASE("bitwise operators", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
@@ -784,6 +1121,83 @@ TEMPLATE_TEST_CASE("shift operators", "[dynamic_bitset]", uint16_t, uint32_t, ui
     }
 }
 
+TEMPLATE_TEST_CASE("copy_bits or_bits and_bits", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
+{
+    const sul::dynamic_bitset<TestType> src = GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
+    const sul::dynamic_bitset<TestType> dst = GENERATE(take(1, randomDynamicBitset<TestType>()));
+    CAPTURE(src, dst);
+
+    const size_t max_len = std::min(src.size(), dst.size());
+    const size_t len = GENERATE_COPY(take(RANDOM_VARIATIONS_TO_TEST, random<size_t>(0, max_len)));
+    const size_t src_pos = GENERATE_COPY(take(1, random<size_t>(0, src.size() - len)));
+    const size_t dst_pos = GENERATE_COPY(take(1, random<size_t>(0, dst.size() - len)));
+    CAPTURE(len, src_pos, dst_pos);
+
+    SECTION("copy_bits")
+    {
+        sul::dynamic_bitset<TestType> result = dst;
+        sul::copy_bits(result, dst_pos, src, src_pos, len);
+        sul::dynamic_bitset<TestType> expected = dst;
+        for(size_t i = 0; i < len; ++i)
+        {
+            expected[dst_pos + i] = src[src_pos + i];
+        }
+        REQUIRE(result == expected);
+        REQUIRE(check_consistency(result));
+    }
+
+    SECTION("or_bits")
+    {
+        sul::dynamic_bitset<TestType> result = dst;
+        sul::or_bits(result, dst_pos, src, src_pos, len);
+        sul::dynamic_bitset<TestType> expected = dst;
+        for(size_t i = 0; i < len; ++i)
+        {
+            expected[dst_pos + i] |= src[src_pos + i];
+        }
+        REQUIRE(result == expected);
+        REQUIRE(check_consistency(result));
+    }
+
+    SECTION("and_bits")
+    {
+        sul::dynamic_bitset<TestType> result = dst;
+        sul::and_bits(result, dst_pos, src, src_pos, len);
+        sul::dynamic_bitset<TestType> expected = dst;
+        for(size_t i = 0; i < len; ++i)
+        {
+            expected[dst_pos + i] &= src[src_pos + i];
+        }
+        REQUIRE(result == expected);
+        REQUIRE(check_consistency(result));
+    }
+
+    SECTION("overlapping ranges")
+    {
+        const size_t other_pos = GENERATE_COPY(take(1, random<size_t>(0, src.size() - len)));
+        CAPTURE(other_pos);
+
+        sul::dynamic_bitset<TestType> result = src;
+        sul::copy_bits(result, other_pos, result, src_pos, len);
+        sul::dynamic_bitset<TestType> expected = src;
+        for(size_t i = 0; i < len; ++i)
+        {
+            expected[other_pos + i] = src[src_pos + i];
+        }
+        REQUIRE(result == expected);
+
+        result = src;
+        sul::or_bits(result, other_pos, result, src_pos, len);
+        expected = src;
+        for(size_t i = 0; i < len; ++i)
+        {
+            expected[other_pos + i] |= src[src_pos + i];
+        }
+        REQUIRE(result == expected);
+        REQUIRE(check_consistency(result));
+    }
+}
+
 TEMPLATE_TEST_CASE("operator~", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
 {
     const std::tuple<unsigned long long, size_t> values =
@@ -1185,6 +1599,146 @@ TEMPLATE_TEST_CASE("all any none", "[dynamic_bitset]", uint16_t, uint32_t, uint6
     }
 }
 
+TEMPLATE_TEST_CASE("all any none range", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
+{
+    SECTION("empty bitset")
+    {
+        sul::dynamic_bitset<TestType> bitset;
+
+        REQUIRE(bitset.all(0, 0));
+        REQUIRE_FALSE(bitset.any(0, 0));
+        REQUIRE(bitset.none(0, 0));
+    }
+
+    SECTION("non-empty bitset")
+    {
+        const sul::dynamic_bitset<TestType> bitset =
+          GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
+        CAPTURE(bitset);
+
+        const size_t lengths[] = {0, 1, 2, bits_number<TestType>, 2 * bits_number<TestType> + 1};
+        for(size_t pos = 0; pos <= bitset.size(); ++pos)
+        {
+            for(size_t len: lengths)
+            {
+                len = std::min(len, bitset.size() - pos);
+                CAPTURE(pos, len);
+                bool all = true;
+                bool any = false;
+                for(size_t i = pos; i < pos + len; ++i)
+                {
+                    all = all && bitset[i];
+                    any = any || bitset[i];
+                }
+                REQUIRE(bitset.all(pos, len) == all);
+                REQUIRE(bitset.any(pos, len) == any);
+                REQUIRE(bitset.none(pos, len) == !any);
+            }
+        }
+    }
+
+    SECTION("all bits on")
+    {
+        const size_t bitset_size =
+          GENERATE(take(RANDOM_VECTORS_TO_TEST, random<size_t>(3 * bits_number<TestType>, 8 * bits_number<TestType>)));
+        CAPTURE(bitset_size);
+
+        sul::dynamic_bitset<TestType> bitset(bitset_size);
+        bitset.set();
+        REQUIRE(bitset.all(0, bitset_size));
+        REQUIRE(bitset.all(1, bitset_size - 2));
+        bitset.reset(bitset_size / 2);
+        REQUIRE_FALSE(bitset.all(1, bitset_size - 2));
+        REQUIRE(bitset.all(0, bitset_size / 2));
+        REQUIRE(bitset.all(bitset_size / 2 + 1, bitset_size - bitset_size / 2 - 1));
+    }
+}
+
+TEMPLATE_TEST_CASE("slice", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
+{
+    sul::dynamic_bitset<TestType> bitset = GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
+    CAPTURE(bitset);
+    const sul::dynamic_bitset<TestType> bitset_copy = bitset;
+
+    const size_t pos = GENERATE_COPY(take(RANDOM_VARIATIONS_TO_TEST, random<size_t>(0, bitset.size())));
+    const size_t len = GENERATE_COPY(take(1, random<size_t>(0, bitset.size() - pos)));
+    CAPTURE(pos, len);
+
+    sul::dynamic_bitset<TestType> expected;
+    for(size_t i = pos; i < pos + len; ++i)
+    {
+        expected.push_back(bitset[i]);
+    }
+
+    SECTION("queries")
+    {
+        const sul::dynamic_bitset<TestType>& const_bitset = bitset;
+        const typename sul::dynamic_bitset<TestType>::const_slice_view view = const_bitset.slice(pos, len);
+        REQUIRE(view.size() == len);
+        REQUIRE(view.empty() == (len == 0));
+        REQUIRE(view.offset() == pos);
+        for(size_t i = 0; i < len; ++i)
+        {
+            REQUIRE(view[i] == expected[i]);
+            REQUIRE(view.test(i) == expected[i]);
+        }
+        REQUIRE(view.count() == expected.count());
+        REQUIRE(view.all() == expected.all());
+        REQUIRE(view.any() == expected.any());
+        REQUIRE(view.none() == expected.none());
+
+        REQUIRE(view.find_first() == expected.find_first());
+        size_t prev = view.find_first();
+        while(prev != sul::dynamic_bitset<TestType>::npos)
+        {
+            REQUIRE(view.find_next(prev) == expected.find_next(prev));
+            prev = view.find_next(prev);
+        }
+        REQUIRE(view.find_next(len) == sul::dynamic_bitset<TestType>::npos);
+    }
+
+    SECTION("modifications")
+    {
+        typename sul::dynamic_bitset<TestType>::slice_view view = bitset.slice(pos, len);
+        const auto check_outside = [&]() {
+            for(size_t i = 0; i < bitset.size(); ++i)
+            {
+                if(i < pos || i >= pos + len)
+                {
+                    REQUIRE(bitset[i] == bitset_copy[i]);
+                }
+            }
+            REQUIRE(check_consistency(bitset));
+        };
+
+        view.flip();
+        REQUIRE(view.count() == len - expected.count());
+        check_outside();
+
+        view.set();
+        REQUIRE(view.all());
+        check_outside();
+
+        view.reset();
+        REQUIRE(view.none());
+        check_outside();
+
+        for(size_t i = 0; i < len; ++i)
+        {
+            if(expected[i])
+            {
+                view[i] = true;
+                view.flip(i).flip(i).set(i, false).set(i);
+            }
+            else
+            {
+                view.set(i).reset(i);
+            }
+        }
+        REQUIRE(bitset == bitset_copy);
+    }
+}
+
 TEMPLATE_TEST_CASE("array subscript operator", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
 {
     const std::tuple<unsigned long long, size_t> values =
@@ -1521,6 +2075,65 @@ TEMPLATE_TEST_CASE("get_allocator", "[dynamic_bitset]", uint16_t, uint32_t, uint
     static_cast<void>(bitset.get_allocator()); // avoid unused warnings
 }
 
+TEMPLATE_TEST_CASE("aligned_allocator", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
+{
+    using aligned_bitset = sul::dynamic_bitset<TestType, sul::aligned_allocator<TestType>>;
+    using aligned_bitset_128 = sul::dynamic_bitset<TestType, sul::aligned_allocator<TestType, 128>>;
+
+    const sul::dynamic_bitset<TestType> bitset =
+      GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
+    const sul::dynamic_bitset<TestType> other = GENERATE(take(1, randomDynamicBitset<TestType>()));
+    CAPTURE(bitset, other);
+
+    aligned_bitset aligned_1;
+    aligned_bitset_128 aligned_2;
+    for(size_t i = 0; i < bitset.size(); ++i)
+    {
+        aligned_1.push_back(bitset[i]);
+        aligned_2.push_back(bitset[i]);
+    }
+    REQUIRE(aligned_1.to_string() == bitset.to_string());
+    REQUIRE(aligned_2.to_string() == bitset.to_string());
+    REQUIRE(check_consistency(aligned_1));
+    REQUIRE(check_consistency(aligned_2));
+
+    SECTION("alignment")
+    {
+        if(!bitset.empty())
+        {
+            REQUIRE(reinterpret_cast<std::uintptr_t>(aligned_1.data()) % 64 == 0);
+            REQUIRE(reinterpret_cast<std::uintptr_t>(aligned_2.data()) % 128 == 0);
+        }
+        aligned_1.resize(aligned_1.size() + 1000);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(aligned_1.data()) % 64 == 0);
+    }
+
+    SECTION("bitwise operators")
+    {
+        sul::dynamic_bitset<TestType> expected = bitset;
+        expected.resize(other.size());
+        aligned_1.resize(other.size());
+        aligned_bitset aligned_other;
+        for(size_t i = 0; i < other.size(); ++i)
+        {
+            aligned_other.push_back(other[i]);
+        }
+
+        REQUIRE((aligned_1 & aligned_other).to_string() == (expected & other).to_string());
+        REQUIRE((aligned_1 | aligned_other).to_string() == (expected | other).to_string());
+        REQUIRE((aligned_1 ^ aligned_other).to_string() == (expected ^ other).to_string());
+        REQUIRE((aligned_1 - aligned_other).to_string() == (expected - other).to_string());
+    }
+
+    SECTION("allocator")
+    {
+        const sul::aligned_allocator<TestType> allocator = aligned_1.get_allocator();
+        const sul::aligned_allocator<char> rebound(allocator);
+        REQUIRE(rebound == allocator);
+        REQUIRE_FALSE(rebound != allocator);
+    }
+}
+
 TEMPLATE_TEST_CASE("to_string", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
 {
     const std::tuple<unsigned long long, size_t> values =
@@ -1546,6 +2159,56 @@ TEMPLATE_TEST_CASE("to_string", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t
     REQUIRE(bitset.to_string() == string);
 }
 
+TEMPLATE_TEST_CASE("to_string string constructor round trip", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
+{
+    const sul::dynamic_bitset<TestType> bitset =
+      GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>(1, 1000)));
+    CAPTURE(bitset);
+
+    std::string expected(bitset.size(), '.');
+    for(size_t i = 0; i < bitset.size(); ++i)
+    {
+        if(bitset[i])
+        {
+            expected[bitset.size() - 1 - i] = '#';
+        }
+    }
+
+    SECTION("custom characters")
+    {
+        const std::string string = bitset.to_string('.', '#');
+        REQUIRE(string == expected);
+        const sul::dynamic_bitset<TestType> parsed(string, 0, std::string::npos, '.', '#');
+        REQUIRE(parsed == bitset);
+        REQUIRE(check_consistency(parsed));
+    }
+
+    SECTION("characters with the high bit set")
+    {
+        const std::string string = bitset.to_string('\x80', '\xFF');
+        const sul::dynamic_bitset<TestType> parsed(string, 0, std::string::npos, '\x80', '\xFF');
+        REQUIRE(parsed == bitset);
+        REQUIRE(check_consistency(parsed));
+    }
+
+    SECTION("wide characters")
+    {
+        const std::wstring string = bitset.template to_string<wchar_t>(L'.', L'#');
+        REQUIRE(string == std::wstring(expected.begin(), expected.end()));
+        const sul::dynamic_bitset<TestType> parsed(string, 0, std::wstring::npos, L'.', L'#');
+        REQUIRE(parsed == bitset);
+        REQUIRE(check_consistency(parsed));
+    }
+
+    SECTION("substring")
+    {
+        const std::string string = "ab" + bitset.to_string() + "cd";
+        const sul::dynamic_bitset<TestType> parsed(string, 2, bitset.size());
+        REQUIRE(parsed == bitset);
+        REQUIRE(check_consistency(parsed));
+    }
+}
+
 TEMPLATE_TEST_CASE("to_ulong", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
 {
     SECTION("empty bitset")
@@ -1654,6 +2317,30 @@ TEMPLATE_TEST_CASE("to_ullong", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t
     }
 }
 
+TEMPLATE_TEST_CASE("extract_bits", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
+{
+    const sul::dynamic_bitset<TestType> bitset =
+      GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
+    CAPTURE(bitset);
+
+    const size_t ull_bits_number = bits_number<unsigned long long>;
+    const size_t lengths[] = {0, 1, 3, 17, bits_number<TestType>, ull_bits_number - 1, ull_bits_number};
+    for(size_t pos = 0; pos <= bitset.size(); ++pos)
+    {
+        for(size_t nbits: lengths)
+        {
+            nbits = std::min(nbits, bitset.size() - pos);
+            CAPTURE(pos, nbits);
+            unsigned long long expected = 0;
+            for(size_t i = 0; i < nbits; ++i)
+            {
+                expected |= static_cast<unsigned long long>(bitset[pos + i]) << i;
+            }
+            REQUIRE(bitset.extract_bits(pos, nbits) == expected);
+        }
+    }
+}
+
 TEMPLATE_TEST_CASE("iterate_bits_on", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
 {
     const std::tuple<unsigned long long, size_t> values =
@@ -1765,6 +2452,78 @@ TEMPLATE_TEST_CASE("iterate_bits_on", "[dynamic_bitset]", uint16_t, uint32_t, ui
     }
 }
 
+TEMPLATE_TEST_CASE("iterate_bits_on_reverse", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
+{
+    const sul::dynamic_bitset<TestType> bitset =
+      GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
+    CAPTURE(bitset);
+
+    std::vector<size_t> bits_on;
+    bitset.iterate_bits_on([&bits_on](size_t bit_pos) { bits_on.push_back(bit_pos); });
+
+    SECTION("return void")
+    {
+        std::vector<size_t> bits_on_reverse;
+        bitset.iterate_bits_on_reverse([](size_t bit_pos, std::vector<size_t>& bits_on_reverse_)
+                                       { bits_on_reverse_.push_back(bit_pos); },
+                                       bits_on_reverse);
+        REQUIRE(std::equal(bits_on.rbegin(), bits_on.rend(), bits_on_reverse.begin(), bits_on_reverse.end()));
+    }
+
+    SECTION("return bool")
+    {
+        const size_t stop_at_bit = bits_on.size() / 2 + 1;
+        std::vector<size_t> bits_on_reverse;
+        bitset.iterate_bits_on_reverse(
+          [&](size_t bit_pos)
+          {
+              bits_on_reverse.push_back(bit_pos);
+              return bits_on_reverse.size() < stop_at_bit;
+          });
+        REQUIRE(bits_on_reverse.size() == std::min(stop_at_bit, bits_on.size()));
+        REQUIRE(std::equal(bits_on_reverse.begin(), bits_on_reverse.end(), bits_on.rbegin()));
+    }
+}
+
+TEMPLATE_TEST_CASE("iterate_bits_off", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
+{
+    const sul::dynamic_bitset<TestType> bitset =
+      GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
+    CAPTURE(bitset);
+
+    SECTION("return void")
+    {
+        sul::dynamic_bitset<TestType> check_bitset(bitset.size(), 0);
+        bitset.iterate_bits_off([](size_t bit_pos, sul::dynamic_bitset<TestType>& check_bitset_)
+                                { check_bitset_[bit_pos] = true; },
+                                check_bitset);
+        REQUIRE(check_bitset == ~bitset);
+    }
+
+    SECTION("return bool")
+    {
+        const size_t bits_off = bitset.size() - bitset.count();
+        const size_t stop_at_bit = bits_off / 2 + 1;
+        size_t bit_count = 0;
+        size_t current_check_bit = 0;
+        bitset.iterate_bits_off(
+          [&](size_t bit_pos)
+          {
+              while(current_check_bit < bit_pos)
+              {
+                  REQUIRE(bitset[current_check_bit] == true);
+                  ++current_check_bit;
+              }
+              REQUIRE(bitset[bit_pos] == false);
+              ++current_check_bit;
+
+              ++bit_count;
+              return bit_count < stop_at_bit;
+          });
+        REQUIRE(bit_count == std::min(stop_at_bit, bits_off));
+    }
+}
+
 TEMPLATE_TEST_CASE("data", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
 {
     SECTION("const")
@@ -2027,6 +2786,89 @@ TEMPLATE_TEST_CASE("operator< operator<= operator> operator>=", "[dynamic_bitset
     }
 }
 
+#if DYNAMIC_BITSET_CAN_USE_THREE_WAY_COMPARISON
+TEMPLATE_TEST_CASE("operator<=>", "[dynamic_bitset][c++20]", uint16_t, uint32_t, uint64_t)
+{
+    const auto check_ordering = [](const sul::dynamic_bitset<TestType>& lhs, const sul::dynamic_bitset<TestType>& rhs) {
+        const std::strong_ordering expected = lhs < rhs   ? std::strong_ordering::less
+                                              : rhs < lhs ? std::strong_ordering::greater
+                                                          : std::strong_ordering::equal;
+        const std::strong_ordering reversed = lhs < rhs   ? std::strong_ordering::greater
+                                              : rhs < lhs ? std::strong_ordering::less
+                                                          : std::strong_ordering::equal;
+        REQUIRE((lhs <=> rhs) == expected);
+        REQUIRE((rhs <=> lhs) == reversed);
+        REQUIRE(std::is_eq(lhs <=> rhs) == (lhs == rhs));
+    };
+
+    SECTION("empty bitsets")
+    {
+        const sul::dynamic_bitset<TestType> empty_bitset;
+        REQUIRE((empty_bitset <=> empty_bitset) == std::strong_ordering::equal);
+        REQUIRE((empty_bitset <=> sul::dynamic_bitset<TestType>(1)) == std::strong_ordering::less);
+    }
+
+    SECTION("random bitsets")
+    {
+        const sul::dynamic_bitset<TestType> bitset1 =
+          GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>(0, 20 * bits_number<TestType>)));
+        sul::dynamic_bitset<TestType> bitset2 =
+          GENERATE(take(RANDOM_VARIATIONS_TO_TEST, randomDynamicBitset<TestType>(0, 20 * bits_number<TestType>)));
+        CAPTURE(bitset1, bitset2);
+
+        check_ordering(bitset1, bitset1);
+        check_ordering(bitset1, bitset2);
+
+        // same bits with additional zeros, and a difference in the common blocks
+        const size_t additional_zeros = bitset2.size() % (3 * bits_number<TestType>);
+        bitset2 = bitset1;
+        bitset2.resize(bitset1.size() + additional_zeros);
+        check_ordering(bitset1, bitset2);
+        if(!bitset1.empty())
+        {
+            bitset2.flip(bitset1.size() / 3);
+            check_ordering(bitset1, bitset2);
+        }
+
+        // difference in the extra blocks
+        bitset2.push_back(true);
+        check_ordering(bitset1, bitset2);
+    }
+}
+#endif
+
+TEMPLATE_TEST_CASE("hash", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
+{
+    const sul::dynamic_bitset<TestType> bitset =
+      GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
+    CAPTURE(bitset);
+
+    const sul::dynamic_bitset<TestType> copy = bitset;
+    REQUIRE(copy.hash() == bitset.hash());
+    REQUIRE(copy.hash(42) == bitset.hash(42));
+    REQUIRE(std::hash<sul::dynamic_bitset<TestType>>()(copy) == std::hash<sul::dynamic_bitset<TestType>>()(bitset));
+
+    // different content, size or seed
+    for(size_t i = 0; i < bitset.size(); ++i)
+    {
+        sul::dynamic_bitset<TestType> modified = bitset;
+        modified.flip(i);
+        CAPTURE(i);
+        REQUIRE(modified.hash() != bitset.hash());
+    }
+    sul::dynamic_bitset<TestType> longer = bitset;
+    longer.push_back(false);
+    REQUIRE(longer.hash() != bitset.hash());
+    REQUIRE(bitset.hash(1) != bitset.hash(2));
+
+    std::unordered_set<sul::dynamic_bitset<TestType>> set;
+    set.insert(bitset);
+    set.insert(longer);
+    set.insert(copy);
+    REQUIRE(set.size() == 2);
+    REQUIRE(set.count(copy) == 1);
+}
+
 TEMPLATE_TEST_CASE("ostream operator<<", "[dynamic_bitset]", uint16_t, uint32_t, uint64_t)
 {
     sul::dynamic_bitset<TestType> bitset = GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
@@ -0,0 +1,152 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "RandomDynamicBitsetGenerator.hpp"
+#include "config.hpp"
+#include "utils.hpp"
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_adapters.hpp>
+#include <sul/dynamic_bitset.hpp>
+
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    // bitset with the bytes of str, the first character being the first byte
+    template<typename Block>
+    sul::dynamic_bitset<Block> bytes_bitset(std::string_view str)
+    {
+        sul::dynamic_bitset<Block> bitset(8 * str.size());
+        for(size_t i = 0; i < str.size(); ++i)
+        {
+            for(size_t j = 0; j < 8; ++j)
+            {
+                bitset[8 * i + j] = ((static_cast<unsigned char>(str[i]) >> j) & 1) != 0;
+            }
+        }
+        return bitset;
+    }
+} // namespace
+
+TEMPLATE_TEST_CASE("hex encoding", "[dynamic_bitset][encodings]", uint16_t, uint32_t, uint64_t)
+{
+    using bitset_type = sul::dynamic_bitset<TestType>;
+
+    SECTION("known values")
+    {
+        REQUIRE(bitset_type().to_hex_string().empty());
+        REQUIRE(bitset_type(12, 0xABC).to_hex_string() == "abc");
+        REQUIRE(bitset_type(13, 0x1ABC).to_hex_string() == "1abc");
+        REQUIRE(bitset_type(16, 0x00F0).to_hex_string() == "00f0");
+        REQUIRE(bitset_type::from_hex("aBc") == bitset_type(12, 0xABC));
+        REQUIRE(bitset_type::from_hex("1ABC", 13) == bitset_type(13, 0x1ABC));
+        REQUIRE(bitset_type::from_hex("00f0", 100) == bitset_type(100, 0xF0));
+        REQUIRE(bitset_type::from_hex("").empty());
+    }
+
+    SECTION("invalid input")
+    {
+        REQUIRE_THROWS_AS(bitset_type::from_hex("12g4"), std::invalid_argument);
+        REQUIRE_THROWS_AS(bitset_type::from_hex("0x12"), std::invalid_argument);
+        REQUIRE_THROWS_AS(bitset_type::from_hex("2abc", 13), std::invalid_argument);
+        REQUIRE_THROWS_AS(bitset_type::from_hex("1", 0), std::invalid_argument);
+        REQUIRE(bitset_type::from_hex("0", 0).empty());
+    }
+
+    SECTION("round trip")
+    {
+        const bitset_type bitset = GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
+        CAPTURE(bitset);
+
+        const std::string str = bitset.to_hex_string();
+        REQUIRE(str.size() == (bitset.size() + 3) / 4);
+        const bitset_type decoded = bitset_type::from_hex(str, bitset.size());
+        REQUIRE(decoded == bitset);
+        REQUIRE(check_consistency(decoded));
+        REQUIRE(bitset_type::from_hex(str).size() == 4 * str.size());
+    }
+}
+
+TEMPLATE_TEST_CASE("base64 encoding", "[dynamic_bitset][encodings]", uint16_t, uint32_t, uint64_t)
+{
+    using bitset_type = sul::dynamic_bitset<TestType>;
+
+    SECTION("known values")
+    {
+        // RFC 4648 test vectors
+        REQUIRE(bytes_bitset<TestType>("").to_base64().empty());
+        REQUIRE(bytes_bitset<TestType>("f").to_base64() == "Zg==");
+        REQUIRE(bytes_bitset<TestType>("fo").to_base64() == "Zm8=");
+        REQUIRE(bytes_bitset<TestType>("foo").to_base64() == "Zm9v");
+        REQUIRE(bytes_bitset<TestType>("foob").to_base64() == "Zm9vYg==");
+        REQUIRE(bytes_bitset<TestType>("fooba").to_base64() == "Zm9vYmE=");
+        REQUIRE(bytes_bitset<TestType>("foobar").to_base64() == "Zm9vYmFy");
+        REQUIRE(bitset_type::from_base64("Zm9vYmFy") == bytes_bitset<TestType>("foobar"));
+        REQUIRE(bitset_type::from_base64("Zm9vYg==") == bytes_bitset<TestType>("foob"));
+        REQUIRE(bitset_type::from_base64("Zm8=") == bytes_bitset<TestType>("fo"));
+        REQUIRE(bitset_type::from_base64("").empty());
+
+        // bits past the end are 0s
+        REQUIRE(bitset_type(3, 0b101).to_base64() == "BQ==");
+        REQUIRE(bitset_type::from_base64("BQ==", 3) == bitset_type(3, 0b101));
+        REQUIRE(bitset_type::from_base64("BQ==", 64) == bitset_type(64, 0b101));
+        REQUIRE(bitset_type(24, 0xFFFFFF).to_base64() == "////");
+    }
+
+    SECTION("invalid input")
+    {
+        REQUIRE_THROWS_AS(bitset_type::from_base64("Zm9"), std::invalid_argument);
+        REQUIRE_THROWS_AS(bitset_type::from_base64("Zm9*"), std::invalid_argument);
+        REQUIRE_THROWS_AS(bitset_type::from_base64("Zg==Zm9v"), std::invalid_argument);
+        REQUIRE_THROWS_AS(bitset_type::from_base64("Z==="), std::invalid_argument);
+        REQUIRE_THROWS_AS(bitset_type::from_base64("===="), std::invalid_argument);
+        REQUIRE_THROWS_AS(bitset_type::from_base64("Z=g="), std::invalid_argument);
+        REQUIRE_THROWS_AS(bitset_type::from_base64("BQ==", 2), std::invalid_argument);
+    }
+
+    SECTION("round trip")
+    {
+        const bitset_type bitset = GENERATE(take(RANDOM_VECTORS_TO_TEST, randomDynamicBitset<TestType>()));
+        CAPTURE(bitset);
+
+        const std::string str = bitset.to_base64();
+        REQUIRE(str.size() % 4 == 0);
+        const bitset_type decoded = bitset_type::from_base64(str, bitset.size());
+        REQUIRE(decoded == bitset);
+        REQUIRE(check_consistency(decoded));
+        REQUIRE(bitset_type::from_base64(str).size() == 8 * ((bitset.size() + 7) / 8));
+    }
+}
+
+TEMPLATE_TEST_CASE("stream format manipulators", "[dynamic_bitset][encodings]", uint16_t, uint32_t, uint64_t)
+{
+    const sul::dynamic_bitset<TestType> bitset(12, 0xABC);
+
+    std::ostringstream stream;
+    REQUIRE(sul::get_bitset_format(stream) == sul::bitset_format::binary);
+    stream << bitset << ' ' << sul::hex_bitset << bitset << ' ' << sul::base64_bitset << bitset << ' '
+           << sul::binary_bitset << bitset;
+    REQUIRE(stream.str() == "101010111100 abc vAo= 101010111100");
+
+    std::wostringstream wstream;
+    wstream << sul::hex_bitset << bitset << L' ' << sul::base64_bitset << bitset;
+    REQUIRE(wstream.str() == L"abc vAo=");
+    REQUIRE(sul::get_bitset_format(wstream) == sul::bitset_format::base64);
+
+    // the extraction always reads the binary representation
+    std::istringstream input("101010111100");
+    sul::dynamic_bitset<TestType> extracted;
+    input >> sul::hex_bitset >> extracted;
+    REQUIRE(extracted == bitset);
+}